@@ -0,0 +1,511 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltcemu.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTCEMU
+ *
+ * @brief   Emulation of an LTC daisy-chain
+ *
+ * Emulates the commands used by the LTC driver for the LTC6804/6811/6812/6813:
+ * WRCFG, RDCFG, ADCV, ADOW, ADAX, RDCVA..RDCVF, RDAUXA..RDAUXD, WRCOMM,
+ * STCOMM and RDCOMM. Other read commands return zeros with a valid PEC.
+ * The data of device i is in the slot at offset 4+8*i of the frame, for
+ * writing and for reading. Conversions complete immediately, the timing of
+ * the daisy-chain is not emulated.
+ *
+ * The PEC is calculated bitwise, independently of the table-based
+ * implementation of the LTC driver.
+ */
+
+/*================== Includes =============================================*/
+#include "ltcemu.h"
+
+#include <string.h>
+
+/*================== Macros and Definitions ===============================*/
+
+#define LTCEMU_CMD_WRCFG        0x001u
+#define LTCEMU_CMD_RDCFG        0x002u
+#define LTCEMU_CMD_RDCVA        0x004u
+#define LTCEMU_CMD_RDCVB        0x006u
+#define LTCEMU_CMD_RDCVC        0x008u
+#define LTCEMU_CMD_RDCVD        0x00Au
+#define LTCEMU_CMD_RDCVE        0x009u
+#define LTCEMU_CMD_RDCVF        0x00Bu
+#define LTCEMU_CMD_RDAUXA       0x00Cu
+#define LTCEMU_CMD_RDAUXB       0x00Eu
+#define LTCEMU_CMD_RDAUXC       0x00Du
+#define LTCEMU_CMD_RDAUXD       0x00Fu
+#define LTCEMU_CMD_WRCOMM       0x721u
+#define LTCEMU_CMD_RDCOMM       0x722u
+#define LTCEMU_CMD_STCOMM       0x723u
+
+/* conversion commands, without the bits for mode (MD), DCP, PUP and channel selection */
+#define LTCEMU_CMD_ADCV_MASK    0x668u
+#define LTCEMU_CMD_ADCV         0x260u
+#define LTCEMU_CMD_ADOW_MASK    0x628u
+#define LTCEMU_CMD_ADOW         0x228u
+#define LTCEMU_CMD_ADAX_MASK    0x678u
+#define LTCEMU_CMD_ADAX         0x460u
+#define LTCEMU_CMD_ADOW_PUP     0x040u
+
+/* FCOM read back from the COMM register */
+#define LTCEMU_FCOM_ACK         0x07u
+#define LTCEMU_FCOM_NACK        0x0Fu
+
+/* no multiplexer channel selected */
+#define LTCEMU_MUX_OFF          0xFFu
+
+/* second reference, returned at auxiliary index 5 */
+#define LTCEMU_REF2_RAW         30000u
+
+/**
+ * state of one emulated LTC
+ */
+typedef struct {
+    uint16_t cellInput[LTCEMU_NR_OF_CELLS];                                /*!< voltages at the cell inputs                */
+    uint16_t cellResult[LTCEMU_NR_OF_CELLS];                               /*!< cell voltage registers                     */
+    uint16_t auxInput[LTCEMU_NR_OF_AUX];                                   /*!< voltages at the auxiliary inputs           */
+    uint16_t auxResult[LTCEMU_NR_OF_AUX];                                  /*!< auxiliary registers                        */
+    uint16_t muxInput[LTCEMU_NR_OF_MUX][LTCEMU_NR_OF_MUX_CHANNELS];        /*!< voltages at the multiplexer inputs         */
+    uint8_t muxChannel[LTCEMU_NR_OF_MUX];                                  /*!< selected channel or LTCEMU_MUX_OFF         */
+    uint8_t muxPresent;                                                    /*!< bit m set: multiplexer m acknowledges      */
+    uint32_t openWire;                                                     /*!< bit w set: wire w is open                  */
+    uint8_t config[6];                                                     /*!< configuration register                     */
+    uint8_t comm[6];                                                       /*!< COMM register                              */
+    uint16_t pecErrors;                                                    /*!< number of responses still to be corrupted  */
+} LTCEMU_DEVICE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+static LTCEMU_DEVICE_s ltcemu_devices[LTCEMU_MAX_DEVICES];
+static uint16_t ltcemu_nr_of_devices = 0;
+static uint16_t ltcemu_devices_per_chain = 0;
+static LTCEMU_STATISTICS_s ltcemu_statistics;
+
+/*================== Function Prototypes ==================================*/
+
+static uint16_t LTCEMU_PEC(const uint8_t *data, uint8_t len);
+static uint8_t LTCEMU_CheckPEC(const uint8_t *data, uint8_t len);
+static void LTCEMU_ConvertCells(LTCEMU_DEVICE_s *dev, uint8_t ch, uint8_t openwire, uint8_t pup);
+static void LTCEMU_ConvertAux(LTCEMU_DEVICE_s *dev, uint8_t chg);
+static void LTCEMU_ExecuteI2C(LTCEMU_DEVICE_s *dev);
+static void LTCEMU_ReadRegister(LTCEMU_DEVICE_s *dev, uint16_t cmd, uint8_t *slot);
+
+/*================== Function Implementations =============================*/
+
+/*================== Public functions =====================================*/
+
+void LTCEMU_Init(uint16_t nr_of_devices, uint16_t devices_per_chain) {
+    if (nr_of_devices > LTCEMU_MAX_DEVICES) {
+        nr_of_devices = LTCEMU_MAX_DEVICES;
+    }
+    ltcemu_nr_of_devices = nr_of_devices;
+    ltcemu_devices_per_chain = devices_per_chain;
+    memset(ltcemu_devices, 0, sizeof(ltcemu_devices));
+    memset(&ltcemu_statistics, 0, sizeof(ltcemu_statistics));
+
+    for (uint16_t i = 0; i < LTCEMU_MAX_DEVICES; i++) {
+        for (uint8_t c = 0; c < LTCEMU_NR_OF_CELLS; c++) {
+            ltcemu_devices[i].cellInput[c] = 37000u;
+        }
+        for (uint8_t a = 0; a < LTCEMU_NR_OF_AUX; a++) {
+            ltcemu_devices[i].auxInput[a] = 15000u;
+        }
+        ltcemu_devices[i].auxInput[5] = LTCEMU_REF2_RAW;
+        for (uint8_t m = 0; m < LTCEMU_NR_OF_MUX; m++) {
+            for (uint8_t ch = 0; ch < LTCEMU_NR_OF_MUX_CHANNELS; ch++) {
+                ltcemu_devices[i].muxInput[m][ch] = 15000u;
+            }
+            ltcemu_devices[i].muxChannel[m] = LTCEMU_MUX_OFF;
+        }
+        ltcemu_devices[i].muxPresent = (1u << LTCEMU_NR_OF_MUX) - 1u;
+    }
+}
+
+
+void LTCEMU_SetCellVoltage(uint16_t device, uint8_t cell, uint16_t raw) {
+    if ((device < LTCEMU_MAX_DEVICES) && (cell < LTCEMU_NR_OF_CELLS)) {
+        ltcemu_devices[device].cellInput[cell] = raw;
+    }
+}
+
+
+void LTCEMU_SetAuxVoltage(uint16_t device, uint8_t aux, uint16_t raw) {
+    if ((device < LTCEMU_MAX_DEVICES) && (aux < LTCEMU_NR_OF_AUX)) {
+        ltcemu_devices[device].auxInput[aux] = raw;
+    }
+}
+
+
+void LTCEMU_SetMuxVoltage(uint16_t device, uint8_t mux, uint8_t channel, uint16_t raw) {
+    if ((device < LTCEMU_MAX_DEVICES) && (mux < LTCEMU_NR_OF_MUX) && (channel < LTCEMU_NR_OF_MUX_CHANNELS)) {
+        ltcemu_devices[device].muxInput[mux][channel] = raw;
+    }
+}
+
+
+void LTCEMU_SetMuxPresent(uint16_t device, uint8_t mux, uint8_t present) {
+    if ((device < LTCEMU_MAX_DEVICES) && (mux < LTCEMU_NR_OF_MUX)) {
+        if (present == TRUE) {
+            ltcemu_devices[device].muxPresent |= (uint8_t)(1u << mux);
+        } else {
+            ltcemu_devices[device].muxPresent &= (uint8_t)~(1u << mux);
+        }
+    }
+}
+
+
+void LTCEMU_SetOpenWire(uint16_t device, uint8_t wire, uint8_t open) {
+    if ((device < LTCEMU_MAX_DEVICES) && (wire <= LTCEMU_NR_OF_CELLS)) {
+        if (open == TRUE) {
+            ltcemu_devices[device].openWire |= (uint32_t)1u << wire;
+        } else {
+            ltcemu_devices[device].openWire &= ~((uint32_t)1u << wire);
+        }
+    }
+}
+
+
+void LTCEMU_InjectPECError(uint16_t device, uint16_t count) {
+    if (device < LTCEMU_MAX_DEVICES) {
+        ltcemu_devices[device].pecErrors = count;
+    }
+}
+
+
+void LTCEMU_GetStatistics(LTCEMU_STATISTICS_s *statistics) {
+    if (statistics != NULL_PTR) {
+        *statistics = ltcemu_statistics;
+    }
+}
+
+
+STD_RETURN_TYPE_e LTCEMU_Transmit(uint16_t firstDevice, const uint8_t *txData, uint16_t size) {
+    uint16_t cmd = 0;
+    uint16_t nr_of_devices = 0;
+    uint16_t slot = 0;
+    LTCEMU_DEVICE_s *dev = NULL_PTR;
+
+    if (firstDevice >= ltcemu_nr_of_devices) {
+        return E_NOT_OK;
+    }
+    if (size < 4) {
+        return E_OK;  /* wake-up byte */
+    }
+    ltcemu_statistics.frames++;
+    if (LTCEMU_CheckPEC(txData, 2) == FALSE) {
+        ltcemu_statistics.commandPECErrors++;
+        return E_OK;
+    }
+    cmd = (((uint16_t)txData[0] << 8) | txData[1]) & 0x7FFu;
+    nr_of_devices = ltcemu_nr_of_devices - firstDevice;
+    if (ltcemu_devices_per_chain < nr_of_devices) {
+        nr_of_devices = ltcemu_devices_per_chain;
+    }
+    if ((cmd == LTCEMU_CMD_WRCFG) || (cmd == LTCEMU_CMD_WRCOMM)) {
+        /* data slots that are sent to the daisy-chain */
+        if (((size - 4u) / 8u) < nr_of_devices) {
+            nr_of_devices = (size - 4u) / 8u;
+        }
+    }
+
+    for (uint16_t i = 0; i < nr_of_devices; i++) {
+        dev = &ltcemu_devices[firstDevice + i];
+        if ((cmd == LTCEMU_CMD_WRCFG) || (cmd == LTCEMU_CMD_WRCOMM)) {
+            /* the data for the last device is sent first */
+            slot = 4u + (nr_of_devices - 1u - i)*8u;
+            if (LTCEMU_CheckPEC(&txData[slot], 6) == FALSE) {
+                ltcemu_statistics.dataPECErrors++;
+            } else if (cmd == LTCEMU_CMD_WRCFG) {
+                memcpy(dev->config, &txData[slot], 6);
+            } else {
+                memcpy(dev->comm, &txData[slot], 6);
+            }
+        } else if ((cmd & LTCEMU_CMD_ADCV_MASK) == LTCEMU_CMD_ADCV) {
+            LTCEMU_ConvertCells(dev, (uint8_t)(cmd & 0x07u), FALSE, FALSE);
+        } else if ((cmd & LTCEMU_CMD_ADOW_MASK) == LTCEMU_CMD_ADOW) {
+            LTCEMU_ConvertCells(dev, (uint8_t)(cmd & 0x07u), TRUE, ((cmd & LTCEMU_CMD_ADOW_PUP) != 0u) ? TRUE : FALSE);
+        } else if ((cmd & LTCEMU_CMD_ADAX_MASK) == LTCEMU_CMD_ADAX) {
+            LTCEMU_ConvertAux(dev, (uint8_t)(cmd & 0x07u));
+        } else if (cmd == LTCEMU_CMD_STCOMM) {
+            LTCEMU_ExecuteI2C(dev);
+        }
+    }
+
+    if ((cmd & LTCEMU_CMD_ADCV_MASK) == LTCEMU_CMD_ADCV) {
+        ltcemu_statistics.adcv++;
+    } else if ((cmd & LTCEMU_CMD_ADAX_MASK) == LTCEMU_CMD_ADAX) {
+        ltcemu_statistics.adax++;
+    } else if (cmd == LTCEMU_CMD_STCOMM) {
+        ltcemu_statistics.stcomm++;
+    }
+    return E_OK;
+}
+
+
+STD_RETURN_TYPE_e LTCEMU_TransmitReceive(uint16_t firstDevice, const uint8_t *txData, uint8_t *rxData, uint16_t size) {
+    uint16_t cmd = 0;
+    uint16_t pec = 0;
+    uint8_t *slot = NULL_PTR;
+    LTCEMU_DEVICE_s *dev = NULL_PTR;
+
+    if (firstDevice >= ltcemu_nr_of_devices) {
+        return E_NOT_OK;
+    }
+    memset(rxData, 0xFF, size);
+    if (size < 4) {
+        return E_OK;
+    }
+    ltcemu_statistics.frames++;
+    if (LTCEMU_CheckPEC(txData, 2) == FALSE) {
+        ltcemu_statistics.commandPECErrors++;
+        return E_OK;
+    }
+    cmd = (((uint16_t)txData[0] << 8) | txData[1]) & 0x7FFu;
+
+    for (uint16_t i = 0; (i < ltcemu_devices_per_chain) && ((firstDevice + i) < ltcemu_nr_of_devices) && ((4u + (i + 1u)*8u) <= size); i++) {
+        dev = &ltcemu_devices[firstDevice + i];
+        slot = &rxData[4u + i*8u];
+        LTCEMU_ReadRegister(dev, cmd, slot);
+        pec = LTCEMU_PEC(slot, 6);
+        slot[6] = (uint8_t)(pec >> 8);
+        slot[7] = (uint8_t)pec;
+        if (dev->pecErrors > 0) {
+            dev->pecErrors--;
+            ltcemu_statistics.injectedPECErrors++;
+            slot[0] ^= 0x01u;
+        }
+    }
+    return E_OK;
+}
+
+/*================== Static functions =====================================*/
+
+/**
+ * @brief   calculates the PEC (CRC15, polynomial 0x4599, seed 16) bit by bit
+ *
+ * @param   data    data bytes
+ * @param   len     number of data bytes
+ *
+ * @return  PEC as transmitted (remainder shifted left by one)
+ */
+static uint16_t LTCEMU_PEC(const uint8_t *data, uint8_t len) {
+    uint16_t remainder = 16;
+
+    for (uint8_t i = 0; i < len; i++) {
+        for (int8_t bit = 7; bit >= 0; bit--) {
+            uint16_t in = ((data[i] >> bit) & 0x01u) ^ ((remainder >> 14) & 0x01u);
+            remainder = (uint16_t)((remainder << 1) & 0x7FFFu);
+            if (in != 0u) {
+                remainder ^= 0x4599u;
+            }
+        }
+    }
+    return (uint16_t)(remainder << 1);
+}
+
+
+/**
+ * @brief   checks the PEC following len data bytes
+ *
+ * @return  TRUE if the PEC is valid, FALSE otherwise
+ */
+static uint8_t LTCEMU_CheckPEC(const uint8_t *data, uint8_t len) {
+    uint16_t pec = LTCEMU_PEC(data, len);
+
+    if ((data[len] == (uint8_t)(pec >> 8)) && (data[len + 1u] == (uint8_t)pec)) {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+
+/**
+ * @brief   converts the cell voltages (ADCV or ADOW)
+ *
+ * With the pull-up current, an open wire pulls the cell below it up and the
+ * cell above it down, with the pull-down current the other way round. The
+ * LTC driver only evaluates the cell above the wire, and cell 0 with pull-up
+ * or the last cell with pull-down for the outer wires.
+ *
+ * @param   dev         emulated LTC
+ * @param   ch          channel selection (0: all cells, n: cells n, n+6 and n+12)
+ * @param   openwire    TRUE for ADOW
+ * @param   pup         TRUE for ADOW with pull-up current
+ */
+static void LTCEMU_ConvertCells(LTCEMU_DEVICE_s *dev, uint8_t ch, uint8_t openwire, uint8_t pup) {
+    for (uint8_t c = 0; c < LTCEMU_NR_OF_CELLS; c++) {
+        if ((ch == 0u) || ((c % 6u) == (uint8_t)(ch - 1u))) {
+            uint16_t value = dev->cellInput[c];
+            uint8_t below = (uint8_t)((dev->openWire >> c) & 0x01u);
+            uint8_t above = (uint8_t)((dev->openWire >> (c + 1u)) & 0x01u);
+
+            if ((openwire == TRUE) && (pup == TRUE)) {
+                if ((c == 0u) && (below != 0u)) {
+                    value = 0;
+                } else if (below != 0u) {
+                    value = (value > LTCEMU_OPENWIRE_DELTA) ? (uint16_t)(value - LTCEMU_OPENWIRE_DELTA) : 0u;
+                } else if (above != 0u) {
+                    value = (uint16_t)(value + LTCEMU_OPENWIRE_DELTA);
+                }
+            } else if (openwire == TRUE) {
+                if ((c == (LTCEMU_NR_OF_CELLS - 1u)) && (above != 0u)) {
+                    value = 0;
+                } else if (above != 0u) {
+                    value = (value > LTCEMU_OPENWIRE_DELTA) ? (uint16_t)(value - LTCEMU_OPENWIRE_DELTA) : 0u;
+                } else if (below != 0u) {
+                    value = (uint16_t)(value + LTCEMU_OPENWIRE_DELTA);
+                }
+            }
+            dev->cellResult[c] = value;
+        }
+    }
+}
+
+
+/**
+ * @brief   converts the auxiliary inputs (ADAX)
+ *
+ * @param   dev     emulated LTC
+ * @param   chg     channel selection (0: all, 1 to 5: GPIO1 to GPIO5, 6: second reference)
+ */
+static void LTCEMU_ConvertAux(LTCEMU_DEVICE_s *dev, uint8_t chg) {
+    for (uint8_t a = 0; a < LTCEMU_NR_OF_AUX; a++) {
+        if ((chg == 0u) || (a == (uint8_t)(chg - 1u))) {
+            uint16_t value = dev->auxInput[a];
+
+            if ((a == 0u) && (dev->muxChannel[0] != LTCEMU_MUX_OFF)) {
+                value = dev->muxInput[0][dev->muxChannel[0]];
+            } else if (a == 1u) {
+                for (uint8_t m = 1; m < LTCEMU_NR_OF_MUX; m++) {
+                    if (dev->muxChannel[m] != LTCEMU_MUX_OFF) {
+                        value = dev->muxInput[m][dev->muxChannel[m]];
+                    }
+                }
+            }
+            dev->auxResult[a] = value;
+        }
+    }
+}
+
+
+/**
+ * @brief   executes the I2C write stored in the COMM register (STCOMM)
+ *
+ * The first byte is the address of the multiplexer (LTC1380: 0x90, ADG728:
+ * 0x98, plus 2 times the multiplexer index), the second byte selects the
+ * channel. The FCOM nibbles of the COMM register are replaced by the
+ * acknowledge of the multiplexer.
+ *
+ * @param   dev     emulated LTC
+ */
+static void LTCEMU_ExecuteI2C(LTCEMU_DEVICE_s *dev) {
+    uint8_t address = (uint8_t)(((dev->comm[0] & 0x0Fu) << 4) | (dev->comm[1] >> 4));
+    uint8_t data = (uint8_t)(((dev->comm[2] & 0x0Fu) << 4) | (dev->comm[3] >> 4));
+    uint8_t mux = (address >> 1) & 0x03u;
+    uint8_t fcom = LTCEMU_FCOM_NACK;
+
+    if ((((address & 0xF8u) == 0x90u) || ((address & 0xF8u) == 0x98u)) && ((dev->muxPresent & (1u << mux)) != 0u)) {
+        fcom = LTCEMU_FCOM_ACK;
+        dev->muxChannel[mux] = LTCEMU_MUX_OFF;
+        if ((address & 0xF8u) == 0x90u) {
+            /* LTC1380: enable bit and channel number */
+            if ((data & 0x08u) != 0u) {
+                dev->muxChannel[mux] = data & 0x07u;
+            }
+        } else {
+            /* ADG728: one bit per channel */
+            for (uint8_t ch = 0; ch < LTCEMU_NR_OF_MUX_CHANNELS; ch++) {
+                if ((data & (1u << ch)) != 0u) {
+                    dev->muxChannel[mux] = ch;
+                    break;
+                }
+            }
+        }
+    }
+    for (uint8_t i = 1; i < 6; i += 2) {
+        dev->comm[i] = (uint8_t)((dev->comm[i] & 0xF0u) | fcom);
+    }
+}
+
+
+/**
+ * @brief   copies a register group of a device into its slot of the answer
+ *
+ * @param   dev     emulated LTC
+ * @param   cmd     read command
+ * @param   slot    6 data bytes of the answer
+ */
+static void LTCEMU_ReadRegister(LTCEMU_DEVICE_s *dev, uint16_t cmd, uint8_t *slot) {
+    const uint16_t *values = NULL_PTR;
+
+    switch (cmd) {
+        case LTCEMU_CMD_RDCVA: values = &dev->cellResult[0]; break;
+        case LTCEMU_CMD_RDCVB: values = &dev->cellResult[3]; break;
+        case LTCEMU_CMD_RDCVC: values = &dev->cellResult[6]; break;
+        case LTCEMU_CMD_RDCVD: values = &dev->cellResult[9]; break;
+        case LTCEMU_CMD_RDCVE: values = &dev->cellResult[12]; break;
+        case LTCEMU_CMD_RDCVF: values = &dev->cellResult[15]; break;
+        case LTCEMU_CMD_RDAUXA: values = &dev->auxResult[0]; break;
+        case LTCEMU_CMD_RDAUXB: values = &dev->auxResult[3]; break;
+        case LTCEMU_CMD_RDAUXC: values = &dev->auxResult[6]; break;
+        case LTCEMU_CMD_RDAUXD: values = &dev->auxResult[9]; break;
+        case LTCEMU_CMD_RDCFG:
+            memcpy(slot, dev->config, 6);
+            return;
+        case LTCEMU_CMD_RDCOMM:
+            memcpy(slot, dev->comm, 6);
+            return;
+        default:
+            memset(slot, 0, 6);
+            return;
+    }
+    for (uint8_t j = 0; j < 3; j++) {
+        /* little-endian, as read by the LTC driver */
+        slot[2*j] = (uint8_t)values[j];
+        slot[2*j + 1] = (uint8_t)(values[j] >> 8);
+    }
+}
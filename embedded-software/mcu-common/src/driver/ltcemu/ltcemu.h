@@ -0,0 +1,221 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltcemu.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTCEMU
+ *
+ * @brief   Header of the emulation of an LTC daisy-chain
+ *
+ * The emulator answers the SPI frames of the LTC driver instead of the slave
+ * boards. It only depends on general.h, so it can also be compiled for a host.
+ * With several daisy-chains, each daisy-chain is a range of emulated LTCs.
+ *
+ */
+
+#ifndef LTCEMU_H_
+#define LTCEMU_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * maximum number of emulated LTCs in the daisy-chain
+ */
+#define LTCEMU_MAX_DEVICES          128u
+
+/**
+ * number of cell voltage inputs of an LTC (LTC6813: 18)
+ */
+#define LTCEMU_NR_OF_CELLS          18u
+
+/**
+ * number of auxiliary results (auxiliary register groups A to D)
+ */
+#define LTCEMU_NR_OF_AUX            12u
+
+/**
+ * number of I2C multiplexers per LTC and of channels per multiplexer
+ */
+#define LTCEMU_NR_OF_MUX            4u
+#define LTCEMU_NR_OF_MUX_CHANNELS   8u
+
+/**
+ * change of the cell voltage next to an open wire during ADOW, in 100uV
+ * (the LTC driver detects an open wire below -400mV)
+ */
+#define LTCEMU_OPENWIRE_DELTA       10000u
+
+/**
+ * counters of the emulated daisy-chain
+ */
+typedef struct {
+    uint32_t frames;            /*!< number of SPI frames with a command                  */
+    uint32_t adcv;              /*!< number of ADCV commands (cell voltage conversions)   */
+    uint32_t adax;              /*!< number of ADAX commands (GPIO conversions)           */
+    uint32_t stcomm;            /*!< number of STCOMM commands (I2C transfers)            */
+    uint32_t commandPECErrors;  /*!< number of frames ignored because of the command PEC  */
+    uint32_t dataPECErrors;     /*!< number of written registers ignored because of PEC   */
+    uint32_t injectedPECErrors; /*!< number of responses corrupted with LTCEMU_InjectPECError() */
+} LTCEMU_STATISTICS_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   initializes the emulated daisy-chain
+ *
+ * All cells are set to 3.7V, all GPIOs and multiplexer inputs to 1.5V, all
+ * multiplexers are present, no wire is open and the statistics are cleared.
+ *
+ * @param   nr_of_devices       number of LTCs in all daisy-chains (at most LTCEMU_MAX_DEVICES)
+ * @param   devices_per_chain   number of LTCs in each daisy-chain
+ */
+extern void LTCEMU_Init(uint16_t nr_of_devices, uint16_t devices_per_chain);
+
+/**
+ * @brief   sets the voltage at a cell input, returned after the next ADCV or ADOW
+ *
+ * @param   device      position in the daisy-chain
+ * @param   cell        cell index (0 to LTCEMU_NR_OF_CELLS-1)
+ * @param   raw         voltage in 100uV
+ */
+extern void LTCEMU_SetCellVoltage(uint16_t device, uint8_t cell, uint16_t raw);
+
+/**
+ * @brief   sets the voltage of an auxiliary input, returned after the next ADAX
+ *
+ * Index 0 to 4 are GPIO1 to GPIO5, index 5 is the second reference.
+ * GPIO1 and GPIO2 return the multiplexer input instead, if a multiplexer
+ * channel is selected.
+ *
+ * @param   device      position in the daisy-chain
+ * @param   aux         index of the auxiliary result (0 to LTCEMU_NR_OF_AUX-1)
+ * @param   raw         voltage in 100uV
+ */
+extern void LTCEMU_SetAuxVoltage(uint16_t device, uint8_t aux, uint16_t raw);
+
+/**
+ * @brief   sets the voltage of a multiplexer input
+ *
+ * Multiplexer 0 is connected to GPIO1, the other multiplexers to GPIO2.
+ *
+ * @param   device      position in the daisy-chain
+ * @param   mux         multiplexer (0 to LTCEMU_NR_OF_MUX-1)
+ * @param   channel     channel (0 to LTCEMU_NR_OF_MUX_CHANNELS-1)
+ * @param   raw         voltage in 100uV
+ */
+extern void LTCEMU_SetMuxVoltage(uint16_t device, uint8_t mux, uint8_t channel, uint16_t raw);
+
+/**
+ * @brief   sets if a multiplexer answers on the I2C bus
+ *
+ * @param   device      position in the daisy-chain
+ * @param   mux         multiplexer (0 to LTCEMU_NR_OF_MUX-1)
+ * @param   present     TRUE: the multiplexer acknowledges, FALSE: NACK
+ */
+extern void LTCEMU_SetMuxPresent(uint16_t device, uint8_t mux, uint8_t present);
+
+/**
+ * @brief   opens or closes the wire of a cell input
+ *
+ * Wire 0 is the bottom of the first cell, wire LTCEMU_NR_OF_CELLS the top of
+ * the last cell. An open wire changes the results of ADOW, not of ADCV.
+ *
+ * @param   device      position in the daisy-chain
+ * @param   wire        wire index (0 to LTCEMU_NR_OF_CELLS)
+ * @param   open        TRUE: wire is open, FALSE: wire is connected
+ */
+extern void LTCEMU_SetOpenWire(uint16_t device, uint8_t wire, uint8_t open);
+
+/**
+ * @brief   corrupts the next responses of a device, so that their PEC is wrong
+ *
+ * @param   device      position in the daisy-chain
+ * @param   count       number of responses to corrupt
+ */
+extern void LTCEMU_InjectPECError(uint16_t device, uint16_t count);
+
+/**
+ * @brief   copies the counters of the emulated daisy-chain
+ *
+ * @param   statistics  destination of the counters
+ */
+extern void LTCEMU_GetStatistics(LTCEMU_STATISTICS_s *statistics);
+
+/**
+ * @brief   processes a frame sent to the daisy-chain (command or write command)
+ *
+ * As in a real daisy-chain, the first data slot of a write command is
+ * received by the last device.
+ *
+ * @param   firstDevice first device of the daisy-chain
+ * @param   txData      command, command PEC and the data of all devices
+ * @param   size        length of the frame
+ *
+ * @return  E_OK, E_NOT_OK if firstDevice is not emulated
+ */
+extern STD_RETURN_TYPE_e LTCEMU_Transmit(uint16_t firstDevice, const uint8_t *txData, uint16_t size);
+
+/**
+ * @brief   processes a frame sent to the daisy-chain and returns the answer
+ *
+ * The answer of device firstDevice+i is placed at rxData[4+8*i], the first
+ * 4 bytes (command and command PEC) are filled with 0xFF.
+ *
+ * @param   firstDevice first device of the daisy-chain
+ * @param   txData      command and command PEC
+ * @param   rxData      answer of the daisy-chain
+ * @param   size        length of the frame
+ *
+ * @return  E_OK, E_NOT_OK if firstDevice is not emulated
+ */
+extern STD_RETURN_TYPE_e LTCEMU_TransmitReceive(uint16_t firstDevice, const uint8_t *txData, uint8_t *rxData, uint16_t size);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTCEMU_H_ */
@@ -121,6 +121,19 @@ uint32_t MCU_GetTimeBase(void) {
      return (time);
 }
 
+void MCU_EnableCycleCounter(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     /* enable the DWT unit */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                /* start the cycle counter */
+}
+
+uint32_t MCU_GetCycleCounter(void) {
+    return (DWT->CYCCNT);
+}
+
+uint32_t MCU_GetCoreClock(void) {
+    return (SystemCoreClock);
+}
+
 uint32_t MCU_SystemResetStatus(uint32_t* regValue) {
     uint32_t errCode = 0;
     uint32_t csr;
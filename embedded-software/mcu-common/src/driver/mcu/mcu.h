@@ -112,6 +112,27 @@ extern uint32_t MCU_SystemResetStatus(uint32_t* regValue);
  */
 extern uint32_t MCU_GetTimeBase(void);
 
+/**
+ * @brief   starts the cycle counter of the data watchpoint and trace unit (DWT)
+ *
+ * The counter is not reset, it is incremented with the core clock and wraps around.
+ */
+extern void MCU_EnableCycleCounter(void);
+
+/**
+ * @brief   gets the value of the cycle counter, see MCU_EnableCycleCounter()
+ *
+ * @return  number of core clock cycles (32-bit upcounter)
+ */
+extern uint32_t MCU_GetCycleCounter(void);
+
+/**
+ * @brief   gets the frequency of the core clock, which is the frequency of the cycle counter
+ *
+ * @return  core clock in Hz
+ */
+extern uint32_t MCU_GetCoreClock(void);
+
 /**
  * @brief   Get unique device ID
  */
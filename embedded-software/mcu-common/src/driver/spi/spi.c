@@ -64,8 +64,8 @@
  *
  */
 static SPI_STATE_s spi_state = {
-    .transmit_ongoing       = FALSE,
-    .dummyByte_ongoing      = FALSE,
+    .transmit_ongoing       = {FALSE},
+    .dummyByte_ongoing      = {FALSE},
     .counter                = 0,
 };
 
@@ -74,6 +74,8 @@ const uint8_t spi_cmdDummy[1]={0x00};
 /*================== Function Prototypes ==================================*/
 void SPI_Wait(void);
 STD_RETURN_TYPE_e SPI_SendDummyByte(uint8_t busID, SPI_HandleType_s *hspi);
+static uint8_t SPI_GetDeviceIndex(SPI_HandleType_s *hspi);
+static void SPI_TransferCompleted(SPI_HandleType_s *hspi);
 
 /*================== Function Implementations =============================*/
 
@@ -118,15 +120,9 @@ void SPI_Init(SPI_HandleType_s *hspi) {
 
 
 void HAL_SPI_TxRxCpltCallback(SPI_HandleType_s *hspi) {
-    if (hspi  ==  &spi_devices[0]) {
-        /* Iso-SPI Main */
-        SPI_UnsetCS(1);
-        if (spi_state.dummyByte_ongoing == TRUE) {
-            spi_state.dummyByte_ongoing = FALSE;
-        } else {
-            spi_state.transmit_ongoing = FALSE;
-        }
-    }
+    /* Iso-SPI */
+    SPI_TransferCompleted(hspi);
+
     if (hspi  ==  &spi_devices[1]) {
         /* Eeprom */
     #ifdef SPI_HASEEPROM
@@ -137,18 +133,8 @@ void HAL_SPI_TxRxCpltCallback(SPI_HandleType_s *hspi) {
 
 
 void HAL_SPI_TxCpltCallback(SPI_HandleType_s *hspi) {
-    if (hspi  ==  &spi_devices[0]) {
-        /* Iso-SPI Main */
-        SPI_UnsetCS(1);
-        /* if currently dummy byte was transmitted: reset dummy byte flag,
-         * otherwise reset normal SPI transmission flag
-         */
-        if (spi_state.dummyByte_ongoing == TRUE) {
-            spi_state.dummyByte_ongoing = FALSE;
-        } else {
-            spi_state.transmit_ongoing = FALSE;
-        }
-    }
+    /* Iso-SPI */
+    SPI_TransferCompleted(hspi);
 
     if (hspi  ==  &spi_devices[1]) {
         /* Eeprom */
@@ -234,21 +220,29 @@ void SPI_UnsetCS(uint8_t busID) {
 STD_RETURN_TYPE_e SPI_Transmit(SPI_HandleType_s *hspi, uint8_t *pData, uint16_t Size) {
     HAL_StatusTypeDef statusSPI = HAL_ERROR;
     STD_RETURN_TYPE_e retVal = E_OK;
+    uint8_t index = SPI_GetDeviceIndex(hspi);
+
+    if (index >= spi_number_of_used_SPI_channels) {
+        return E_NOT_OK;
+    }
 
 #if SPI_TRANSMIT_WAKEUP  ==  TRUE
-    SPI_SetCS(1);
-    retVal = SPI_SendDummyByte(0x01, hspi);
+    SPI_SetCS(index+1);
+    retVal = SPI_SendDummyByte(index+1, hspi);
     if (retVal != E_OK) {
         return E_NOT_OK;
     }
     SPI_Wait();
 #endif
 
-    SPI_SetCS(1);
+    SPI_SetCS(index+1);
+    spi_state.transmit_ongoing[index] = TRUE;
     statusSPI = HAL_SPI_Transmit_DMA(hspi, pData, Size);
     if (statusSPI != HAL_OK) {
+        spi_state.transmit_ongoing[index] = FALSE;
         retVal = E_NOT_OK;
     }
+
     return retVal;
 }
 
@@ -256,19 +250,26 @@ STD_RETURN_TYPE_e SPI_Transmit(SPI_HandleType_s *hspi, uint8_t *pData, uint16_t
 STD_RETURN_TYPE_e SPI_TransmitReceive(SPI_HandleType_s *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size) {
     HAL_StatusTypeDef statusSPI = HAL_ERROR;
     STD_RETURN_TYPE_e retVal = E_OK;
+    uint8_t index = SPI_GetDeviceIndex(hspi);
+
+    if (index >= spi_number_of_used_SPI_channels) {
+        return E_NOT_OK;
+    }
 
 #if SPI_TRANSMIT_WAKEUP  ==  TRUE
-    SPI_SetCS(1);
-    retVal = SPI_SendDummyByte(0x01, hspi);
+    SPI_SetCS(index+1);
+    retVal = SPI_SendDummyByte(index+1, hspi);
     if (retVal != E_OK) {
         return E_NOT_OK;
     }
     SPI_Wait();
 #endif
 
-    SPI_SetCS(1);
+    SPI_SetCS(index+1);
+    spi_state.transmit_ongoing[index] = TRUE;
     statusSPI = HAL_SPI_TransmitReceive_DMA(hspi, pTxData, pRxData, Size);
     if (statusSPI != HAL_OK) {
+        spi_state.transmit_ongoing[index] = FALSE;
         retVal = E_NOT_OK;
     }
 
@@ -287,11 +288,13 @@ STD_RETURN_TYPE_e SPI_SendDummyByte(uint8_t busID, SPI_HandleType_s *hspi) {
     HAL_StatusTypeDef statusSPI;
     STD_RETURN_TYPE_e retVal = E_OK;
 
-    spi_state.dummyByte_ongoing = TRUE;
+    spi_state.dummyByte_ongoing[busID-1] = TRUE;
 
     statusSPI = HAL_SPI_Transmit_DMA(hspi, (uint8_t *)spi_cmdDummy, 1);
-    if (statusSPI != HAL_OK)
+    if (statusSPI != HAL_OK) {
+        spi_state.dummyByte_ongoing[busID-1] = FALSE;
         retVal = E_NOT_OK;
+    }
 
     return retVal;
 }
@@ -307,12 +310,56 @@ void SPI_Wait(void) {
 
 extern STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void) {
     STD_RETURN_TYPE_e retval = FALSE;
+    uint8_t i = 0;
 
-    retval    =  spi_state.transmit_ongoing;
+    for (i=0; i < spi_number_of_used_SPI_channels; i++) {
+        if (spi_state.transmit_ongoing[i] == TRUE) {
+            retval = TRUE;
+        }
+    }
 
     return (retval);
 }
 
-extern void SPI_SetTransmitOngoing(void) {
-    spi_state.transmit_ongoing = TRUE;
+
+/**
+ * @brief   gets the index of a SPI device in spi_devices[].
+ *
+ * @param   *hspi      pointer to SPI hardware handle
+ *
+ * @return  index of the device, spi_number_of_used_SPI_channels if the handle is not in spi_devices[]
+ */
+static uint8_t SPI_GetDeviceIndex(SPI_HandleType_s *hspi) {
+    uint8_t i = 0;
+
+    for (i=0; i < spi_number_of_used_SPI_channels; i++) {
+        if (hspi == &spi_devices[i]) {
+            break;
+        }
+    }
+    return i;
+}
+
+
+/**
+ * @brief   ends a transmission started with SPI_Transmit() or SPI_TransmitReceive().
+ *
+ * Sets CS high. If currently the dummy byte was transmitted, the dummy byte
+ * flag is reset, otherwise the transmission flag of the device.
+ * Devices without ongoing transmission (e.g., the EEPROM) are not affected.
+ *
+ * @param   *hspi      pointer to SPI hardware handle
+ */
+static void SPI_TransferCompleted(SPI_HandleType_s *hspi) {
+    uint8_t index = SPI_GetDeviceIndex(hspi);
+
+    if (index < spi_number_of_used_SPI_channels) {
+        if (spi_state.dummyByte_ongoing[index] == TRUE) {
+            SPI_UnsetCS(index+1);
+            spi_state.dummyByte_ongoing[index] = FALSE;
+        } else if (spi_state.transmit_ongoing[index] == TRUE) {
+            SPI_UnsetCS(index+1);
+            spi_state.transmit_ongoing[index] = FALSE;
+        }
+    }
 }
@@ -59,14 +59,22 @@
 
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * Maximum number of SPI devices in spi_devices[]
+ */
+#define SPI_MAX_NR_OF_DEVICES       6
+
 /**
  * This structure contains variables relevant for the SPI driver.
  *
+ * The transfers of the devices run in parallel, so the status is stored per
+ * device in spi_devices[]. The chip select of spi_devices[i] is busID i+1
+ * (SPI_NSS_PORT<i+1>).
  */
 typedef struct {
-    uint8_t transmit_ongoing;         /*!< time in ms before the state machine processes the next state, e.g. in counts of 1ms    */
-    uint8_t dummyByte_ongoing;        /*!< SPI dummy byte is currently transmitted */
-    uint8_t counter;                  /*!< general purpose counter */
+    uint8_t transmit_ongoing[SPI_MAX_NR_OF_DEVICES];    /*!< SPI transmission started with SPI_Transmit() or SPI_TransmitReceive() is ongoing */
+    uint8_t dummyByte_ongoing[SPI_MAX_NR_OF_DEVICES];   /*!< SPI dummy byte is currently transmitted */
+    uint8_t counter;                                    /*!< general purpose counter */
 } SPI_STATE_s;
 
 /*================== Constant and Variable Definitions ====================*/
@@ -142,17 +150,13 @@ extern void SPI_UnsetCS(uint8_t busID);
 /**
  * @brief   gets the SPI transmit status.
  *
- * @return  retval  TRUE if transmission still ongoing, FALSE otherwise
+ * The status is set by SPI_Transmit() and SPI_TransmitReceive() and reset in
+ * the callback of the transmission.
  *
- */
-extern STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void);
-
-
-/**
- * @brief   sets the SPI transmit status.
+ * @return  retval  TRUE if a transmission is still ongoing on any device, FALSE otherwise
  *
  */
-extern void SPI_SetTransmitOngoing(void);
+extern STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void);
 
 
 
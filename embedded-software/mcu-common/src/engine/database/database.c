@@ -54,6 +54,7 @@
 /*================== Includes ===============================================*/
 #include "database.h"
 
+#include "database_history.h"
 #include "diag.h"
 #include <string.h>
 
@@ -73,11 +74,64 @@
  */
 #define DATA_QUEUE_ITEM_SIZE    sizeof(DATA_QUEUE_MESSAGE_s)
 
+/**
+ * @brief Maximum number of lock-free read attempts in DB_ReadBlock()
+ *
+ * If the block is updated by DATA_Task() during every attempt, the read falls
+ * back to a copy with the scheduler suspended.
+ */
+#define DATA_READ_MAX_RETRIES   (3u)
+
+/**
+ * @brief Maximum number of buffers of a data block (double buffering)
+ */
+#define DATA_MAX_BUFFERS        (2u)
+
+/**
+ * @brief Compiler barrier, prevents reordering of memory accesses around the
+ *        sequence counter updates
+ */
+#define DATA_MEMORY_BARRIER()   __asm volatile("" : : : "memory")
+
 /*================== Static Constant and Variable Definitions ===============*/
 /* FIXME Some uninitialized variables */
 static DATA_BLOCK_ACCESS_s data_block_access[DATA_MAX_BLOCK_NR];
 QueueHandle_t data_queue;
 
+/**
+ * @brief sequence counter of each data block
+ *
+ * Incremented by DATA_Task() before and after a block is updated. An odd value
+ * signals that an update is in progress. Readers copy the block lock-free and
+ * retry if the counter changed during the copy.
+ */
+static volatile uint32_t data_block_sequence[DATA_MAX_BLOCK_NR];
+
+/**
+ * @brief number of active borrows of each buffer of a data block
+ *
+ * A borrowed buffer is pinned: DATA_Task() does not write into it until all
+ * borrows of the buffer are released, see DB_BorrowBlock().
+ */
+static volatile uint8_t data_block_borrows[DATA_MAX_BLOCK_NR][DATA_MAX_BUFFERS];
+
+/**
+ * @brief change-notification subscriptions, see DB_Subscribe()
+ */
+static DATA_SUBSCRIPTION_s data_subscriptions[DATA_MAX_SUBSCRIPTIONS];
+
+/**
+ * @brief number of valid entries in #data_subscriptions
+ */
+static volatile uint8_t data_nr_of_subscriptions = 0;
+
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+/**
+ * @brief access statistics of the database, see DB_GetStatistics()
+ */
+static DATA_STATISTICS_s data_statistics;
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
 
 /**
  * @brief size of Queue storage
@@ -95,8 +149,144 @@ static StaticQueue_t dataQueueStructure;
 /*================== Extern Constant and Variable Definitions ===============*/
 
 /*================== Static Function Prototypes =============================*/
+static STD_RETURN_TYPE_e DATA_CopySnapshot(const DATA_READ_REQUEST_s *requests, uint8_t nr_of_requests);
+static uint8_t DATA_GetBufferIndex(DATA_BLOCK_ID_TYPE_e blockID, const void *bufferptr);
+static void DATA_WaitForRelease(DATA_BLOCK_ID_TYPE_e blockID, const void *bufferptr);
+static void DATA_NotifySubscribers(DATA_BLOCK_ID_TYPE_e blockID);
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+static void DATA_CountReads(const DATA_READ_REQUEST_s *requests, uint8_t nr_of_requests);
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
 /*================== Static Function Implementations ========================*/
+/**
+ * @brief   copies a consistent snapshot of one or more data blocks
+ *
+ * Copies the published data blocks without involving DATA_Task(). The sum of
+ * the sequence counters of all requested blocks is taken before and after the
+ * copy. As the counters only increase, an unchanged sum means that none of
+ * the blocks has been updated in between and all copies belong to the same
+ * generation; otherwise the copy is discarded and repeated.
+ *
+ * @param   requests        list of data blocks and receive buffers
+ * @param   nr_of_requests  number of entries in requests
+ *
+ * @return  E_OK if a consistent copy was made, otherwise E_NOT_OK
+ */
+static STD_RETURN_TYPE_e DATA_CopySnapshot(const DATA_READ_REQUEST_s *requests, uint8_t nr_of_requests) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    uint32_t sequence_start = 0;
+    uint32_t sequence_end = 0;
+    uint32_t sequence = 0;
+    uint8_t update_in_progress = FALSE;
+
+    for (uint8_t i = 0; i < DATA_READ_MAX_RETRIES; i++) {
+        sequence_start = 0;
+        update_in_progress = FALSE;
+        for (uint8_t j = 0; j < nr_of_requests; j++) {
+            sequence = data_block_sequence[requests[j].blockID];
+            if ((sequence & 1u) != 0u) {
+                update_in_progress = TRUE;
+            }
+            sequence_start += sequence;
+        }
+        if (update_in_progress == FALSE) {
+            DATA_MEMORY_BARRIER();
+            for (uint8_t j = 0; j < nr_of_requests; j++) {
+                memcpy(requests[j].dataptrtoReceiver, data_block_access[requests[j].blockID].RDptr,
+                        (data_base_dev.blockheaderptr + requests[j].blockID)->datalength);
+            }
+            DATA_MEMORY_BARRIER();
+            sequence_end = 0;
+            for (uint8_t j = 0; j < nr_of_requests; j++) {
+                sequence_end += data_block_sequence[requests[j].blockID];
+            }
+            if (sequence_end == sequence_start) {
+                retVal = E_OK;
+                break;
+            }
+        }
+    }
+
+    if (retVal != E_OK) {
+        /*
+         * Blocks are continuously updated: copy them with the scheduler
+         * suspended, so that DATA_Task() cannot update them. Interrupts stay
+         * enabled during the copy of large blocks.
+         */
+        vTaskSuspendAll();
+        for (uint8_t j = 0; j < nr_of_requests; j++) {
+            memcpy(requests[j].dataptrtoReceiver, data_block_access[requests[j].blockID].RDptr,
+                    (data_base_dev.blockheaderptr + requests[j].blockID)->datalength);
+        }
+        (void)xTaskResumeAll();
+        retVal = E_OK;
+    }
+
+    return retVal;
+}
+
+/**
+ * @brief   gets the index of a buffer of a data block
+ *
+ * @param   blockID     ID of the data block
+ * @param   bufferptr   buffer of the data block
+ *
+ * @return  1 for the second buffer of a double-buffered data block, otherwise 0
+ */
+static uint8_t DATA_GetBufferIndex(DATA_BLOCK_ID_TYPE_e blockID, const void *bufferptr) {
+    return (bufferptr == (data_base_dev.blockheaderptr + blockID)->blockptr2) ? 1u : 0u;
+}
+
+/**
+ * @brief   waits until a buffer of a data block is not borrowed anymore
+ *
+ * DATA_Task() has the highest priority, the borrowers continue while it waits.
+ * As no borrower runs between the return of this function and the end of the
+ * update, the buffer cannot be borrowed again during the update.
+ *
+ * @param   blockID     ID of the data block
+ * @param   bufferptr   buffer that is going to be written
+ */
+static void DATA_WaitForRelease(DATA_BLOCK_ID_TYPE_e blockID, const void *bufferptr) {
+    uint8_t buffer = DATA_GetBufferIndex(blockID, bufferptr);
+
+    while (data_block_borrows[blockID][buffer] > 0u) {
+        OS_taskDelay(1u);
+    }
+}
+
+/**
+ * @brief   notifies all tasks subscribed to a data block
+ *
+ * @param   blockID     ID of the data block that has been updated
+ */
+static void DATA_NotifySubscribers(DATA_BLOCK_ID_TYPE_e blockID) {
+    for (uint8_t i = 0; i < data_nr_of_subscriptions; i++) {
+        if (data_subscriptions[i].blockID == blockID) {
+            xTaskNotify(data_subscriptions[i].taskHandle, data_subscriptions[i].notifyBits, eSetBits);
+        }
+    }
+}
+
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+/**
+ * @brief   counts the read accesses of the requested data blocks
+ *
+ * Readers run in different tasks, so the counters are updated inside a
+ * critical section.
+ *
+ * @param   requests        list of data blocks that have been read
+ * @param   nr_of_requests  number of entries in requests
+ */
+static void DATA_CountReads(const DATA_READ_REQUEST_s *requests, uint8_t nr_of_requests) {
+    OS_TaskEnter_Critical();
+    for (uint8_t i = 0; i < nr_of_requests; i++) {
+        data_statistics.block[requests[i].blockID].reads++;
+        data_statistics.bytes_copied += (data_base_dev.blockheaderptr + requests[i].blockID)->datalength;
+    }
+    OS_TaskExit_Critical();
+}
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
 /*================== Extern Function Implementations ========================*/
 void DATA_Init(void) {
@@ -109,10 +299,14 @@ void DATA_Init(void) {
 
     /* Iterate over database and set respective read/write pointer for each database entry */
     for (uint16_t i = 0; i < data_base_dev.nr_of_blockheader; i++) {
-        /* Set write pointer to database entry */
-        data_block_access[i].WRptr = (void*)*(uint32_t*)(data_base_dev.blockheaderptr + i);
-        /* Set read pointer: read = write pointer */
-        data_block_access[i].RDptr = data_block_access[i].WRptr;
+        /* Set read pointer to the published buffer of the database entry */
+        data_block_access[i].RDptr = (data_base_dev.blockheaderptr + i)->blockptr;
+        /* Set write pointer: second buffer if double buffering is used, otherwise read = write pointer */
+        if ((data_base_dev.blockheaderptr + i)->blockptr2 != NULL_PTR) {
+            data_block_access[i].WRptr = (data_base_dev.blockheaderptr + i)->blockptr2;
+        } else {
+            data_block_access[i].WRptr = data_block_access[i].RDptr;
+        }
 
         /* Initialize database entry with 0, set read and write pointer in case double
          * buffering is used for database entries */
@@ -129,8 +323,16 @@ void DATA_Init(void) {
             *startDatabaseEntryRD = 0;
             startDatabaseEntryRD++;
         }
+        data_block_sequence[i] = 0;
+        for (uint8_t j = 0; j < DATA_MAX_BUFFERS; j++) {
+            data_block_borrows[i][j] = 0;
+        }
     }
 
+#if DATA_HISTORY_NR > 0
+    DATA_HistoryInit();
+#endif /* DATA_HISTORY_NR > 0 */
+
     /* Create queue to transfer data to/from database */
 
     /* Create a queue capable of containing a pointer of type DATA_QUEUE_MESSAGE_s
@@ -154,6 +356,11 @@ void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID) {
        note: xQueueSend() always takes message variable by value */
     DATA_QUEUE_MESSAGE_s data_send_msg;
     TickType_t queuetimeout;
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    uint32_t waitStart = 0;
+    uint32_t waitTime = 0;
+    BaseType_t sent = pdFALSE;
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
     queuetimeout = DATA_QUEUE_TIMEOUT_MS / portTICK_RATE_MS;
     if (queuetimeout == 0) {
@@ -166,7 +373,23 @@ void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID) {
     data_send_msg.accesstype = WRITE_ACCESS;
     /* Send a pointer to a message object and
        maximum block time: queuetimeout */
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    waitStart = OS_getOSSysTick();
+    sent = xQueueSend(data_queue, (void *) &data_send_msg, queuetimeout);
+    waitTime = OS_getOSSysTick() - waitStart;
+
+    OS_TaskEnter_Critical();
+    if (sent != pdPASS) {
+        /* data_queue stayed full for the whole timeout, the write is lost */
+        data_statistics.queue_full_drops++;
+    }
+    if (waitTime > data_statistics.max_queue_wait) {
+        data_statistics.max_queue_wait = waitTime;
+    }
+    OS_TaskExit_Critical();
+#else
     xQueueSend(data_queue, (void *) &data_send_msg, queuetimeout);
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 }
 
 
@@ -190,12 +413,14 @@ void DATA_Task(void) {
                     /* write access to data blocks */
                     datalength = (data_base_dev.blockheaderptr + blockID)->datalength;
                     dstdataptr = data_block_access[blockID].WRptr;
+                    /* A borrowed buffer does not change until it is released */
+                    DATA_WaitForRelease(blockID, dstdataptr);
 
                         uint32_t *previousTimestampptr = NULL_PTR;
                         uint32_t *timestampptr = NULL_PTR;
 
-                        /* Set timestamp pointer */
-                        timestampptr = (uint32_t *)dstdataptr;
+                        /* Set timestamp pointer to the published data */
+                        timestampptr = (uint32_t *)data_block_access[blockID].RDptr;
                         /* Set previous timestampptr */
                         previousTimestampptr = (uint32_t *)srcdataptr;
                         previousTimestampptr++;
@@ -205,7 +430,30 @@ void DATA_Task(void) {
                         /* Write timestamp */
                         *(uint32_t *)srcdataptr = OS_getOSSysTick();
 
+#if DATA_HISTORY_NR > 0
+                        /* The published block still holds the previous record */
+                        DATA_HistoryAppend(blockID, srcdataptr, data_block_access[blockID].RDptr, datalength);
+#endif /* DATA_HISTORY_NR > 0 */
+
+                        /* Publish the new data: odd sequence marks the update as in progress */
+                        data_block_sequence[blockID]++;
+                        DATA_MEMORY_BARRIER();
                         memcpy(dstdataptr, srcdataptr, datalength);
+                        if (dstdataptr != data_block_access[blockID].RDptr) {
+                            /* Double buffering: publish the written buffer, the next write uses the other one */
+                            data_block_access[blockID].WRptr = data_block_access[blockID].RDptr;
+                            data_block_access[blockID].RDptr = dstdataptr;
+                        }
+                        DATA_MEMORY_BARRIER();
+                        data_block_sequence[blockID]++;
+
+                        DATA_NotifySubscribers(blockID);
+
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+                        /* DATA_Task() has the highest priority, no lower task interrupts the update */
+                        data_statistics.block[blockID].writes++;
+                        data_statistics.bytes_copied += datalength;
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
                 } else if (accesstype == READ_ACCESS) {
                     /* Read access to data blocks */
@@ -221,30 +469,126 @@ void DATA_Task(void) {
                 }
             }
         }
+#if DATA_HISTORY_NR > 0
+        DATA_HistoryUpdate();
+#endif /* DATA_HISTORY_NR > 0 */
         DIAG_SysMonNotify(DIAG_SYSMON_DATABASE_ID, 0);        /* task is running, state = ok */
     }
 }
 
 
 STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID) {
-    DATA_QUEUE_MESSAGE_s data_send_msg;
-    TickType_t queuetimeout;
+    DATA_READ_REQUEST_s request = {dataptrtoReceiver, blockID};
 
-    queuetimeout = DATA_QUEUE_TIMEOUT_MS / portTICK_RATE_MS;
-    if (queuetimeout  ==  0) {
-        queuetimeout = 1;
+    return DB_ReadBlocks(&request, 1u);
+}
+
+
+STD_RETURN_TYPE_e DB_ReadBlocks(const DATA_READ_REQUEST_s *requests, uint8_t nr_of_requests) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    /* plausibility check */
+    if ((requests != NULL_PTR) && (nr_of_requests > 0u)) {
+        retVal = E_OK;
+        for (uint8_t i = 0; i < nr_of_requests; i++) {
+            if ((requests[i].blockID >= DATA_MAX_BLOCK_NR) || (requests[i].dataptrtoReceiver == NULL_PTR) ||
+                    (data_block_access[requests[i].blockID].RDptr == NULL_PTR)) {
+                retVal = E_NOT_OK;
+            }
+        }
     }
 
-    /* prepare send message with attributes of data block */
-    data_send_msg.blockID = blockID;
-    data_send_msg.value.voidptr = dataptrtoReceiver;
-    data_send_msg.accesstype = READ_ACCESS;
+    if (retVal == E_OK) {
+        retVal = DATA_CopySnapshot(requests, nr_of_requests);
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+        DATA_CountReads(requests, nr_of_requests);
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+    }
+
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e DB_Subscribe(DATA_BLOCK_ID_TYPE_e blockID, TaskHandle_t taskHandle, uint32_t notifyBits) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    /* plausibility check */
+    if ((blockID < DATA_MAX_BLOCK_NR) && (taskHandle != NULL_PTR) && (notifyBits != 0u)) {
+        OS_TaskEnter_Critical();
+        if (data_nr_of_subscriptions < DATA_MAX_SUBSCRIPTIONS) {
+            data_subscriptions[data_nr_of_subscriptions].taskHandle = taskHandle;
+            data_subscriptions[data_nr_of_subscriptions].notifyBits = notifyBits;
+            data_subscriptions[data_nr_of_subscriptions].blockID = blockID;
+            /* Entry is complete before it becomes visible to DATA_Task() */
+            data_nr_of_subscriptions++;
+            retVal = E_OK;
+        }
+        OS_TaskExit_Critical();
+    }
+
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e DB_BorrowBlock(DATA_BLOCK_BORROW_s *borrow, DATA_BLOCK_ID_TYPE_e blockID) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    uint8_t buffer = 0;
+
+    if (borrow != NULL_PTR) {
+        borrow->dataptr = NULL_PTR;
+        /* plausibility check */
+        if ((blockID < DATA_MAX_BLOCK_NR) && (data_block_access[blockID].RDptr != NULL_PTR)) {
+            /* DATA_Task() does not publish between taking the buffer and pinning it */
+            OS_TaskEnter_Critical();
+            buffer = DATA_GetBufferIndex(blockID, data_block_access[blockID].RDptr);
+            if (data_block_borrows[blockID][buffer] < UINT8_MAX) {
+                data_block_borrows[blockID][buffer]++;
+                borrow->dataptr = data_block_access[blockID].RDptr;
+                borrow->buffer = buffer;
+                borrow->blockID = blockID;
+                retVal = E_OK;
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+                data_statistics.block[blockID].reads++;
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+            }
+            OS_TaskExit_Critical();
+        }
+    }
+
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e DB_ReleaseBlock(DATA_BLOCK_BORROW_s *borrow) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    if ((borrow != NULL_PTR) && (borrow->dataptr != NULL_PTR)) {
+        OS_TaskEnter_Critical();
+        data_block_borrows[borrow->blockID][borrow->buffer]--;
+        OS_TaskExit_Critical();
+        borrow->dataptr = NULL_PTR;
+        retVal = E_OK;
+    }
+
+    return retVal;
+}
+
+
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+void DB_GetStatistics(DATA_STATISTICS_s *statistics) {
+    if (statistics != NULL_PTR) {
+        OS_TaskEnter_Critical();
+        memcpy(statistics, &data_statistics, sizeof(DATA_STATISTICS_s));
+        OS_TaskExit_Critical();
+    }
+}
 
-    /* Send a pointer to a message object and */
-    /* maximum block time: queuetimeout */
-    xQueueSend(data_queue, (void *) &data_send_msg, queuetimeout);
 
-    return E_OK;
+void DB_ResetStatistics(void) {
+    OS_TaskEnter_Critical();
+    memset(&data_statistics, 0, sizeof(DATA_STATISTICS_s));
+    OS_TaskExit_Critical();
 }
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
 /*================== Static functions =====================================*/
@@ -60,6 +60,16 @@
 #include "os.h"
 
 /*================== Macros and Definitions =================================*/
+#ifndef BUILD_DIAG_ENABLE_DB_STATISTICS
+/**
+ * @brief Enable database statistics
+ *
+ * If this define is set to 1, the accesses to the database are counted
+ * and can be read with DB_GetStatistics().
+ */
+#define BUILD_DIAG_ENABLE_DB_STATISTICS 0
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
 /**
  * struct for database queue, contains pointer to data, database entry and access type
  */
@@ -83,6 +93,52 @@ typedef struct {
     void *WRptr;
 } DATA_BLOCK_ACCESS_s;
 
+/**
+ * request to read a data block, see DB_ReadBlocks()
+ */
+typedef struct {
+    void *dataptrtoReceiver;            /*!< buffer of the caller the data block is copied to   */
+    DATA_BLOCK_ID_TYPE_e blockID;       /*!< ID of the data block                               */
+} DATA_READ_REQUEST_s;
+
+/**
+ * handle of a borrowed data block, see DB_BorrowBlock()
+ */
+typedef struct {
+    const void *dataptr;                /*!< read-only pointer to the published data block      */
+    uint8_t buffer;                     /*!< index of the pinned buffer of the data block       */
+    DATA_BLOCK_ID_TYPE_e blockID;       /*!< ID of the borrowed data block                      */
+} DATA_BLOCK_BORROW_s;
+
+/**
+ * change-notification subscription of a task to a data block, see DB_Subscribe()
+ */
+typedef struct {
+    TaskHandle_t taskHandle;            /*!< task to be notified                                */
+    uint32_t notifyBits;                /*!< bits set in the notification value of the task     */
+    DATA_BLOCK_ID_TYPE_e blockID;       /*!< ID of the data block                               */
+} DATA_SUBSCRIPTION_s;
+
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+/**
+ * access counters of a data block, see DB_GetStatistics()
+ */
+typedef struct {
+    uint32_t reads;                     /*!< number of reads (copies and borrows)               */
+    uint32_t writes;                    /*!< number of writes published by DATA_Task()          */
+} DATA_BLOCK_STATISTICS_s;
+
+/**
+ * access statistics of the database, see DB_GetStatistics()
+ */
+typedef struct {
+    DATA_BLOCK_STATISTICS_s block[DATA_MAX_BLOCK_NR];   /*!< access counters per data block     */
+    uint32_t bytes_copied;              /*!< bytes copied by reads and writes                   */
+    uint32_t queue_full_drops;          /*!< writes dropped because data_queue stayed full      */
+    uint32_t max_queue_wait;            /*!< longest wait of DB_WriteBlock() for data_queue in ms */
+} DATA_STATISTICS_s;
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
 /*================== Static Constant and Variable Definitions ===============*/
 
 /*================== Extern Constant and Variable Definitions ===============*/
@@ -107,14 +163,93 @@ extern void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID
 /**
  * @brief   Reads a datablock in database by value.
  *
+ * The data block is copied synchronously into the buffer of the caller. The
+ * copy is lock-free and validated against the sequence counter of the data
+ * block, so the caller always receives a consistent snapshot of the last data
+ * published by DATA_Task().
+ *
  * Do not call this function from inside a critical section, as it is
  * computationally complex.
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
  * @param   dataptrtoReceiver (type: void *)
- * @return  STD_RETURN_TYPE_e
+ * @return  E_OK if the data block was copied, E_NOT_OK for an invalid blockID or pointer
  */
 extern STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID);
 
+/**
+ * @brief   Reads several datablocks in database by value.
+ *
+ * All requested data blocks are copied synchronously and belong to the same
+ * generation: none of them is updated by DATA_Task() while the blocks are
+ * copied. Use this function instead of consecutive calls of DB_ReadBlock() if
+ * the data blocks have to be consistent to each other.
+ *
+ * Do not call this function from inside a critical section, as it is
+ * computationally complex.
+ * @param   requests (type: const DATA_READ_REQUEST_s *)
+ * @param   nr_of_requests (type: uint8_t)
+ * @return  E_OK if all data blocks were copied, E_NOT_OK if any request is
+ *          invalid (no data block is copied in that case)
+ */
+extern STD_RETURN_TYPE_e DB_ReadBlocks(const DATA_READ_REQUEST_s *requests, uint8_t nr_of_requests);
+
+/**
+ * @brief   Borrows a read-only pointer to a datablock in database.
+ *
+ * No data is copied. The caller may read the data block through
+ * borrow->dataptr until DB_ReleaseBlock() is called. The borrowed buffer is
+ * pinned and does not change until it is released: DATA_Task() publishes new
+ * data of a double-buffered data block (buffers: 2 in database_cfg.yml) in
+ * the other buffer, writes to a single-buffered data block wait for the
+ * release.
+ *
+ * Keep the borrow short and do not wait for a write of the same data block
+ * while it is borrowed.
+ *
+ * @param   borrow (type: DATA_BLOCK_BORROW_s *)
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @return  E_OK if the data block was borrowed, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e DB_BorrowBlock(DATA_BLOCK_BORROW_s *borrow, DATA_BLOCK_ID_TYPE_e blockID);
+
+/**
+ * @brief   Releases a datablock borrowed with DB_BorrowBlock().
+ *
+ * @param   borrow (type: DATA_BLOCK_BORROW_s *)
+ * @return  E_OK if the data block was released, E_NOT_OK if it was not borrowed
+ */
+extern STD_RETURN_TYPE_e DB_ReleaseBlock(DATA_BLOCK_BORROW_s *borrow);
+
+/**
+ * @brief   Subscribes a task to write accesses of a datablock.
+ *
+ * Every time DATA_Task() has published new data of the data block, the
+ * notifyBits are set in the notification value of the task (FreeRTOS task
+ * notification with eSetBits). The task can wait for new data with
+ * xTaskNotifyWait() instead of polling the timestamps of the data block.
+ *
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @param   taskHandle (type: TaskHandle_t)
+ * @param   notifyBits (type: uint32_t)
+ * @return  E_OK if the subscription was added, E_NOT_OK if the parameters are
+ *          invalid or #DATA_MAX_SUBSCRIPTIONS is exceeded
+ */
+extern STD_RETURN_TYPE_e DB_Subscribe(DATA_BLOCK_ID_TYPE_e blockID, TaskHandle_t taskHandle, uint32_t notifyBits);
+
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+/**
+ * @brief   Copies the access statistics of the database.
+ *
+ * @param   statistics (type: DATA_STATISTICS_s *)
+ */
+extern void DB_GetStatistics(DATA_STATISTICS_s *statistics);
+
+/**
+ * @brief   Resets the access statistics of the database.
+ */
+extern void DB_ResetStatistics(void);
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
  /**
   * @brief   trigger of database manager
   */
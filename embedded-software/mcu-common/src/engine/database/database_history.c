@@ -0,0 +1,354 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    database_history.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  DATA
+ *
+ * @brief   History of database blocks
+ *
+ * Every write access to a data block listed with a history in
+ * database_cfg.yml is appended as a record to the ring buffer of the block.
+ * A record is either the complete data block (key record) or the difference
+ * to the previous record (delta record): for every halfword of the data block
+ * a 2 bit tag tells whether it is unchanged, changed by a signed 8 bit value
+ * or stored completely. A key record is stored every
+ * #DATA_HISTORY_KEYFRAME_INTERVAL records. When the ring is full, the oldest
+ * records are overwritten. A record is assembled in data_history_record[] in
+ * internal RAM and copied into the ring (external SDRAM) in one piece, two
+ * at the end of the ring.
+ *
+ * Record layout:
+ *  - byte 0:       record type (DATA_HISTORY_RECORD_TYPE_e)
+ *  - byte 1..2:    payload length, little-endian
+ *  - key record:   the data block
+ *  - delta record: the tags (4 halfwords per byte, first halfword in bits 0..1),
+ *                  followed by the data of the changed halfwords
+ */
+
+/*================== Includes ===============================================*/
+#include "database_history.h"
+
+#include "os.h"
+#include <string.h>
+
+#if DATA_HISTORY_NR > 0
+/*================== Macros and Definitions =================================*/
+/**
+ * @brief marks a data block without history in #data_history_index
+ */
+#define DATA_HISTORY_NONE       (0xFFu)
+
+/**
+ * management of one history ring
+ */
+typedef struct {
+    uint32_t head;          /*!< position of the next record                            */
+    uint32_t tail;          /*!< position of the oldest record                          */
+    uint32_t used;          /*!< bytes of records in the ring                           */
+    uint32_t records;       /*!< number of records in the ring                          */
+    uint16_t sinceKey;      /*!< number of delta records since the last key record      */
+} DATA_HISTORY_RING_s;
+
+/*================== Static Constant and Variable Definitions ===============*/
+/**
+ * @brief index in data_history_cfg[] of every data block
+ */
+static uint8_t data_history_index[DATA_MAX_BLOCK_NR];
+
+/**
+ * @brief management of the history rings, the records are stored in
+ *        data_history_cfg[].ringptr
+ */
+static DATA_HISTORY_RING_s data_history_ring[DATA_HISTORY_NR];
+
+/**
+ * @brief recording state of all history rings
+ */
+static DATA_HISTORY_STATUS_s data_history_status;
+
+/*================== Extern Constant and Variable Definitions ===============*/
+
+/*================== Static Function Prototypes =============================*/
+static uint32_t DATA_HistoryAdvance(const DATA_HISTORY_CFG_s *cfg, uint32_t position, uint32_t length);
+static void DATA_HistoryWrite(const DATA_HISTORY_CFG_s *cfg, uint32_t position, const uint8_t *data, uint32_t length);
+static void DATA_HistoryMakeRoom(uint8_t historyIdx, uint32_t length);
+
+/*================== Static Function Implementations ========================*/
+/**
+ * @brief   moves a position in a history ring
+ *
+ * @param   cfg         configuration of the history ring
+ * @param   position    position in the ring
+ * @param   length      number of bytes to move, less than the size of the ring
+ *
+ * @return  new position
+ */
+static uint32_t DATA_HistoryAdvance(const DATA_HISTORY_CFG_s *cfg, uint32_t position, uint32_t length) {
+    position += length;
+    if (position >= cfg->ringsize) {
+        position -= cfg->ringsize;
+    }
+    return position;
+}
+
+/**
+ * @brief   copies data into a history ring, wraps at the end of the ring
+ *
+ * @param   cfg         configuration of the history ring
+ * @param   position    position in the ring
+ * @param   data        data to be stored
+ * @param   length      number of bytes, less than the size of the ring
+ */
+static void DATA_HistoryWrite(const DATA_HISTORY_CFG_s *cfg, uint32_t position, const uint8_t *data, uint32_t length) {
+    uint32_t firstpart = cfg->ringsize - position;
+
+    if (firstpart >= length) {
+        memcpy(&cfg->ringptr[position], data, length);
+    } else {
+        memcpy(&cfg->ringptr[position], data, firstpart);
+        memcpy(&cfg->ringptr[0], &data[firstpart], length - firstpart);
+    }
+}
+
+/**
+ * @brief   overwrites the oldest records until the ring has enough free space
+ *
+ * @param   historyIdx  index in data_history_cfg[]
+ * @param   length      free space needed in bytes
+ */
+static void DATA_HistoryMakeRoom(uint8_t historyIdx, uint32_t length) {
+    const DATA_HISTORY_CFG_s *cfg = &data_history_cfg[historyIdx];
+    DATA_HISTORY_RING_s *ring = &data_history_ring[historyIdx];
+    uint32_t position = 0;
+    uint32_t recordlength = 0;
+
+    while ((cfg->ringsize - ring->used) < length) {
+        position = DATA_HistoryAdvance(cfg, ring->tail, 1u);
+        recordlength = cfg->ringptr[position];
+        position = DATA_HistoryAdvance(cfg, position, 1u);
+        recordlength |= (uint32_t)cfg->ringptr[position] << 8;
+        recordlength += DATA_HISTORY_RECORD_HEADER_SIZE;
+
+        ring->tail = DATA_HistoryAdvance(cfg, ring->tail, recordlength);
+        ring->used -= recordlength;
+        ring->records--;
+    }
+}
+
+/*================== Extern Function Implementations ========================*/
+void DATA_HistoryInit(void) {
+    memset(data_history_index, DATA_HISTORY_NONE, sizeof(data_history_index));
+    for (uint8_t i = 0; i < DATA_HISTORY_NR; i++) {
+        data_history_index[data_history_cfg[i].blockID] = i;
+    }
+    memset(data_history_ring, 0, sizeof(data_history_ring));
+    data_history_status.state = DATA_HISTORY_RECORDING;
+    data_history_status.trigger = 0;
+    data_history_status.triggerTimestamp = 0;
+}
+
+
+void DATA_HistoryAppend(DATA_BLOCK_ID_TYPE_e blockID, const void *newdataptr, const void *olddataptr, uint16_t datalength) {
+    const uint8_t *newdata = (const uint8_t *)newdataptr;
+    const uint8_t *olddata = (const uint8_t *)olddataptr;
+    uint8_t *record = &data_history_record[0];
+    const DATA_HISTORY_CFG_s *cfg = NULL_PTR;
+    DATA_HISTORY_RING_s *ring = NULL_PTR;
+    uint8_t historyIdx = data_history_index[blockID];
+    uint32_t position = DATA_HISTORY_RECORD_HEADER_SIZE;
+    uint32_t tagposition = 0;
+    uint16_t payload = 0;
+    uint16_t newvalue = 0;
+    uint16_t oldvalue = 0;
+    int16_t delta = 0;
+    uint8_t tags = 0;
+    uint8_t type = DATA_HISTORY_RECORD_DELTA;
+
+    if ((historyIdx == DATA_HISTORY_NONE) || (data_history_status.state == DATA_HISTORY_FROZEN)) {
+        return;
+    }
+    cfg = &data_history_cfg[historyIdx];
+    ring = &data_history_ring[historyIdx];
+
+    if ((ring->records == 0u) || (ring->sinceKey >= DATA_HISTORY_KEYFRAME_INTERVAL)) {
+        type = DATA_HISTORY_RECORD_KEY;
+        memcpy(&record[position], newdata, datalength);
+        position += datalength;
+        payload = datalength;
+        ring->sinceKey = 0;
+    } else {
+        /* Tags are stored in front of the data, reserve their space */
+        tagposition = position;
+        payload = ((datalength / 2u) + 3u) / 4u;
+        position += payload;
+        for (uint16_t i = 0; i < (datalength / 2u); i++) {
+            /* Halfwords are assembled bytewise, the data block may contain packed members */
+            newvalue = (uint16_t)newdata[2u * i] | ((uint16_t)newdata[(2u * i) + 1u] << 8);
+            oldvalue = (uint16_t)olddata[2u * i] | ((uint16_t)olddata[(2u * i) + 1u] << 8);
+            delta = (int16_t)(uint16_t)(newvalue - oldvalue);
+            if (delta == 0) {
+                /* DATA_HISTORY_TAG_UNCHANGED, nothing to be stored */
+            } else if ((delta >= INT8_MIN) && (delta <= INT8_MAX)) {
+                tags |= (uint8_t)(DATA_HISTORY_TAG_DELTA8 << (2u * (i % 4u)));
+                record[position++] = (uint8_t)delta;
+                payload += 1u;
+            } else {
+                tags |= (uint8_t)(DATA_HISTORY_TAG_LITERAL << (2u * (i % 4u)));
+                record[position++] = (uint8_t)newvalue;
+                record[position++] = (uint8_t)(newvalue >> 8);
+                payload += 2u;
+            }
+
+            if (((i % 4u) == 3u) || (i == ((datalength / 2u) - 1u))) {
+                record[tagposition++] = tags;
+                tags = 0;
+            }
+        }
+        ring->sinceKey++;
+    }
+
+    /* Header is written last, the payload length is known now */
+    record[0] = type;
+    record[1] = (uint8_t)payload;
+    record[2] = (uint8_t)(payload >> 8);
+
+    /* The complete record is copied into the ring at once */
+    DATA_HistoryMakeRoom(historyIdx, position);
+    DATA_HistoryWrite(cfg, ring->head, record, position);
+    ring->head = DATA_HistoryAdvance(cfg, ring->head, position);
+    ring->used += position;
+    ring->records++;
+}
+
+
+void DATA_HistoryUpdate(void) {
+    if ((data_history_status.state == DATA_HISTORY_TRIGGERED) &&
+            ((OS_getOSSysTick() - data_history_status.triggerTimestamp) >= DATA_HISTORY_POST_TRIGGER_MS)) {
+        data_history_status.state = DATA_HISTORY_FROZEN;
+    }
+}
+
+
+void DB_TriggerHistoryFreeze(uint32_t trigger) {
+    OS_TaskEnter_Critical();
+    if (data_history_status.state == DATA_HISTORY_RECORDING) {
+        data_history_status.trigger = trigger;
+        data_history_status.triggerTimestamp = OS_getOSSysTick();
+        data_history_status.state = DATA_HISTORY_TRIGGERED;
+    }
+    OS_TaskExit_Critical();
+}
+
+
+void DB_GetHistoryStatus(DATA_HISTORY_STATUS_s *status) {
+    if (status != NULL_PTR) {
+        OS_TaskEnter_Critical();
+        *status = data_history_status;
+        OS_TaskExit_Critical();
+    }
+}
+
+
+STD_RETURN_TYPE_e DB_GetHistoryInfo(uint8_t historyIdx, DATA_HISTORY_INFO_s *info) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    if ((historyIdx < DATA_HISTORY_NR) && (info != NULL_PTR)) {
+        info->blockID = data_history_cfg[historyIdx].blockID;
+        info->datalength = (data_base_dev.blockheaderptr + info->blockID)->datalength;
+        OS_TaskEnter_Critical();
+        info->length = data_history_ring[historyIdx].used;
+        info->records = data_history_ring[historyIdx].records;
+        OS_TaskExit_Critical();
+        retVal = E_OK;
+    }
+
+    return retVal;
+}
+
+
+uint16_t DB_ReadHistory(uint8_t historyIdx, uint32_t offset, uint8_t *buffer, uint16_t length) {
+    const DATA_HISTORY_CFG_s *cfg = NULL_PTR;
+    const DATA_HISTORY_RING_s *ring = NULL_PTR;
+    uint32_t position = 0;
+    uint32_t firstpart = 0;
+
+    /* The ring is only stable while DATA_Task() does not record */
+    if ((historyIdx >= DATA_HISTORY_NR) || (buffer == NULL_PTR) ||
+            (data_history_status.state != DATA_HISTORY_FROZEN)) {
+        return 0;
+    }
+    cfg = &data_history_cfg[historyIdx];
+    ring = &data_history_ring[historyIdx];
+    if (offset >= ring->used) {
+        return 0;
+    }
+
+    if (length > (ring->used - offset)) {
+        length = ring->used - offset;
+    }
+    position = DATA_HistoryAdvance(cfg, ring->tail, offset);
+    firstpart = cfg->ringsize - position;
+    if (firstpart >= length) {
+        memcpy(buffer, &cfg->ringptr[position], length);
+    } else {
+        memcpy(buffer, &cfg->ringptr[position], firstpart);
+        memcpy(&buffer[firstpart], &cfg->ringptr[0], length - firstpart);
+    }
+
+    return length;
+}
+
+
+void DB_RestartHistory(void) {
+    OS_TaskEnter_Critical();
+    memset(data_history_ring, 0, sizeof(data_history_ring));
+    data_history_status.state = DATA_HISTORY_RECORDING;
+    data_history_status.trigger = 0;
+    data_history_status.triggerTimestamp = 0;
+    OS_TaskExit_Critical();
+}
+#endif /* DATA_HISTORY_NR > 0 */
+
+/*================== Static functions =====================================*/
@@ -0,0 +1,208 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    database_history.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup ENGINE
+ * @prefix  DATA
+ *
+ * @brief   Header of the history of database blocks
+ *
+ * Provides interfaces to record the past values of selected data blocks, to
+ * freeze the recording on a diagnosis event and to read the records for a
+ * post-mortem analysis.
+ *
+ */
+
+#ifndef DATABASE_HISTORY_H_
+#define DATABASE_HISTORY_H_
+
+/*================== Includes ===============================================*/
+#include "database_cfg.h"
+
+/*================== Macros and Definitions =================================*/
+/**
+ * @brief size of the header of a record: record type and payload length
+ */
+#define DATA_HISTORY_RECORD_HEADER_SIZE         (3u)
+
+/**
+ * @brief maximum size of a record of a data block with datalength bytes
+ *
+ * Header, 2 bit tag per halfword and every halfword stored completely.
+ */
+#define DATA_HISTORY_MAX_RECORD_SIZE(datalength)    \
+    (DATA_HISTORY_RECORD_HEADER_SIZE + ((((datalength) / 2u) + 3u) / 4u) + (datalength))
+
+/**
+ * @brief trigger value of a freeze requested by the user
+ */
+#define DATA_HISTORY_TRIGGER_MANUAL             (0xFFFFFFFFu)
+
+/**
+ * type of a record in the history ring
+ */
+typedef enum {
+    DATA_HISTORY_RECORD_KEY     = 0x4B,     /*!< complete data block                                */
+    DATA_HISTORY_RECORD_DELTA   = 0x44,     /*!< difference to the previous record                  */
+} DATA_HISTORY_RECORD_TYPE_e;
+
+/**
+ * encoding of a halfword in a delta record (2 bit tag)
+ */
+typedef enum {
+    DATA_HISTORY_TAG_UNCHANGED  = 0,        /*!< halfword equals the previous record, no data       */
+    DATA_HISTORY_TAG_DELTA8     = 1,        /*!< signed 8 bit difference to the previous record     */
+    DATA_HISTORY_TAG_LITERAL    = 2,        /*!< new halfword, 2 bytes little-endian                */
+} DATA_HISTORY_TAG_e;
+
+/**
+ * recording state of the history
+ */
+typedef enum {
+    DATA_HISTORY_RECORDING      = 0,        /*!< every write access is recorded                     */
+    DATA_HISTORY_TRIGGERED      = 1,        /*!< freeze triggered, recording until post-trigger time */
+    DATA_HISTORY_FROZEN         = 2,        /*!< recording stopped, records can be read             */
+} DATA_HISTORY_STATE_e;
+
+/**
+ * recording state and trigger of the history, see DB_GetHistoryStatus()
+ */
+typedef struct {
+    DATA_HISTORY_STATE_e state;             /*!< recording state                                    */
+    uint32_t trigger;                       /*!< diagnosis channel or DATA_HISTORY_TRIGGER_MANUAL   */
+    uint32_t triggerTimestamp;              /*!< time of the trigger in ms                          */
+} DATA_HISTORY_STATUS_s;
+
+/**
+ * content of one history ring, see DB_GetHistoryInfo()
+ */
+typedef struct {
+    DATA_BLOCK_ID_TYPE_e blockID;           /*!< recorded data block                                */
+    uint16_t datalength;                    /*!< size of the data block in bytes                    */
+    uint32_t length;                        /*!< bytes of records in the ring                       */
+    uint32_t records;                       /*!< number of records in the ring                      */
+} DATA_HISTORY_INFO_s;
+
+/*================== Static Constant and Variable Definitions ===============*/
+
+/*================== Extern Constant and Variable Definitions ===============*/
+
+/*================== Extern Function Prototypes =============================*/
+#if DATA_HISTORY_NR > 0
+/**
+ * @brief   Initialization of the history rings
+ */
+extern void DATA_HistoryInit(void);
+
+/**
+ * @brief   Appends a write access of a data block to its history ring.
+ *
+ * Called by DATA_Task() before the new data is published, so olddataptr
+ * still points to the previous record of the data block.
+ *
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @param   newdataptr (type: const void *)
+ * @param   olddataptr (type: const void *)
+ * @param   datalength (type: uint16_t)
+ */
+extern void DATA_HistoryAppend(DATA_BLOCK_ID_TYPE_e blockID, const void *newdataptr, const void *olddataptr, uint16_t datalength);
+
+/**
+ * @brief   Freezes the history after the post-trigger time has elapsed.
+ *
+ * Called cyclically by DATA_Task().
+ */
+extern void DATA_HistoryUpdate(void);
+
+/**
+ * @brief   Triggers the freeze of the history.
+ *
+ * The history keeps recording for #DATA_HISTORY_POST_TRIGGER_MS and is
+ * frozen afterwards. Only the first trigger is stored, further triggers are
+ * ignored until DB_RestartHistory() is called.
+ *
+ * @param   trigger (type: uint32_t) diagnosis channel or DATA_HISTORY_TRIGGER_MANUAL
+ */
+extern void DB_TriggerHistoryFreeze(uint32_t trigger);
+
+/**
+ * @brief   Copies the recording state and trigger of the history.
+ *
+ * @param   status (type: DATA_HISTORY_STATUS_s *)
+ */
+extern void DB_GetHistoryStatus(DATA_HISTORY_STATUS_s *status);
+
+/**
+ * @brief   Copies the content information of a history ring.
+ *
+ * @param   historyIdx (type: uint8_t) index in data_history_cfg[]
+ * @param   info (type: DATA_HISTORY_INFO_s *)
+ * @return  E_OK if historyIdx is valid, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e DB_GetHistoryInfo(uint8_t historyIdx, DATA_HISTORY_INFO_s *info);
+
+/**
+ * @brief   Reads the records of a frozen history ring.
+ *
+ * The records are read oldest first, offset 0 is the start of the oldest
+ * record. The first records may be differences to records that have already
+ * been overwritten; decoding has to start at the first complete record
+ * (#DATA_HISTORY_RECORD_KEY).
+ *
+ * @param   historyIdx (type: uint8_t) index in data_history_cfg[]
+ * @param   offset (type: uint32_t)
+ * @param   buffer (type: uint8_t *)
+ * @param   length (type: uint16_t) size of buffer
+ * @return  number of bytes copied, 0 if the history is not frozen or offset
+ *          is beyond the last record
+ */
+extern uint16_t DB_ReadHistory(uint8_t historyIdx, uint32_t offset, uint8_t *buffer, uint16_t length);
+
+/**
+ * @brief   Discards all records and restarts the recording.
+ */
+extern void DB_RestartHistory(void);
+#endif /* DATA_HISTORY_NR > 0 */
+
+#endif /* DATABASE_HISTORY_H_ */
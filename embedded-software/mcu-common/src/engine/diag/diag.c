@@ -59,6 +59,7 @@
 #include "contactor.h"
 #endif
 #include "com.h"
+#include "database_history.h"
 #include "os.h"
 #if BUILD_MODULE_ENABLE_NVRAM == 1
 #include "nvramhandler.h"
@@ -203,6 +204,19 @@ STD_RETURN_TYPE_e DIAG_Init(DIAG_DEV_s *diag_dev_pointer, STD_RETURN_TYPE_e bkpr
     /* take over configured error enable masks*/
     for (c = 0; c < (DIAG_ID_MAX+31)/32; c++) {
         diag.err_enableflag[c] = ~tmperr_Check[c];
+        diag.history_triggerflag[c] = 0;
+    }
+
+    /* Fill array history_triggerflag */
+    for (c = 0; c < diag_dev_pointer->nr_of_history_triggers; c++) {
+        id_nr = diag_dev_pointer->history_trigger[c];
+        if (id_nr < DIAG_ID_MAX) {
+            diag.history_triggerflag[id_nr/32] |= 1 << (id_nr % 32);
+        } else {
+            /* Configuration error -> set retval to E_NOT_OK */
+            checkfail |= 0x40;
+            retval = E_NOT_OK;
+        }
     }
 
     diag.state = DIAG_STATE_INITIALIZED;
@@ -469,6 +483,13 @@ DIAG_RETURNTYPE_e DIAG_Handler(DIAG_CH_ID_e diag_ch_id, DIAG_EVENT_e event, uint
                     DIAG_EntryWrite(diag_ch_id, event, item_nr);
                 }
 
+#if DATA_HISTORY_NR > 0
+                /* Keep the records that led to the error */
+                if (diag.history_triggerflag[err_enable_idx] & err_enable_bitmask) {
+                    DB_TriggerHistoryFreeze(diag_ch_id);
+                }
+#endif /* DATA_HISTORY_NR > 0 */
+
                 /* Call callback function and set error */
                 diag_ch_cfg[diag.id2ch[diag_ch_id]].callbackfunc(diag_ch_id, DIAG_EVENT_NOK);
                 /* Function returns an error-message! */
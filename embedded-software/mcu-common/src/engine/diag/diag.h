@@ -147,6 +147,7 @@ typedef struct {
     uint32_t errflag[(DIAG_ID_MAX+31)/32];         /*!< detected error   flags (bit_nr = diag_id) */
     uint32_t warnflag[(DIAG_ID_MAX+31)/32];        /*!< detected warning flags (bit_nr = diag_id) */
     uint32_t err_enableflag[(DIAG_ID_MAX+31)/32];   /*!< enabled error flags (bit_nr = diag_id)    */
+    uint32_t history_triggerflag[(DIAG_ID_MAX+31)/32];  /*!< errors freezing the database history (bit_nr = diag_id) */
 } DIAG_s;
 
 /*================== Constant and Variable Definitions ====================*/
@@ -58,6 +58,10 @@
 #include "ltc_pec.h"
 #include "os.h"
 #include "slaveplausibility.h"
+#if BUILD_MODULE_ENABLE_LTC_EMULATION == 1
+#include "ltcemu.h"
+#endif
+#include <stdlib.h>
 
 /*================== Macros and Definitions ===============================*/
 
@@ -106,6 +110,8 @@ static DATA_BLOCK_OPENWIRE_s ltc_openwire;
 static uint16_t ltc_openwire_pup_buffer[BS_NR_OF_BAT_CELLS];
 static uint16_t ltc_openwire_pdown_buffer[BS_NR_OF_BAT_CELLS];
 static int32_t ltc_openwire_delta[BS_NR_OF_BAT_CELLS];
+static uint8_t ltc_openwire_evidence[BS_NR_OF_MODULES * (BS_NR_OF_BAT_CELLS_PER_MODULE+1)];  /* consecutive detections per wire */
+static uint8_t ltc_openwire_cellGroup = 0;  /* cell group checked by the distributed open-wire check */
 
 static LTC_ERRORTABLE_s LTC_ErrorTable[LTC_N_LTC];  /* init in LTC_ResetErrorTable-function */
 
@@ -133,10 +139,30 @@ static LTC_STATE_s ltc_state = {
     .muxmeas_seqptr          = NULL_PTR,
     .muxmeas_seqendptr       = NULL_PTR,
     .muxmeas_nr_end          = 0,
+    .muxmeas_selectptr       = NULL_PTR,
+    .muxStepsInCycle         = 0,
     .first_measurement_made  = FALSE,
     .ltc_muxcycle_finished   = E_NOT_OK,
     .check_spi_flag          = FALSE,
-    .balance_control_done     = FALSE,
+    .activeJob                = LTC_JOB_NONE,
+    .jobStartTime             = 0,
+    .conversionEndTime        = 0,
+    .muxConversionPending     = FALSE,
+    .voltageReadPending       = FALSE,
+};
+
+static LTC_JOB_STATE_s ltc_job_state[LTC_JOB_NR_OF_JOBS];            /* init in LTC_ResetJobStatistics-function */
+static LTC_JOB_STATISTICS_s ltc_job_statistics[LTC_JOB_NR_OF_JOBS];
+static uint32_t ltc_job_minCycleTime = 0xFFFFFFFF;  /* shortest measurement part of a cycle (voltages and multiplexer) in ms */
+
+static DATA_BLOCK_CURRENT_SENSOR_s ltc_current_sensor;
+static LTC_ADCMODE_POLICY_s ltc_adcmode_policy = {
+    .voltageMode        = LTC_VOLTAGE_MEASUREMENT_MODE,
+    .lastCurrent_mA     = 0,
+    .lastCurrentTime    = 0,
+    .fastModeUntil      = 0,
+    .restSince          = 0,
+    .atRest             = FALSE,
 };
 
 static const uint8_t ltc_cmdDummy[1]={0x00};
@@ -208,6 +234,12 @@ static uint8_t ltc_RXPECbuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
 static uint8_t ltc_TXPECbuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
 static uint8_t ltc_TXBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION_DATA_ONLY];
 
+#if LTC_N_CHAINS > 1
+/* frames of the daisy-chains that cannot be sent or received in place */
+static uint8_t ltc_chainTXPECbuffer[LTC_N_CHAINS-1][LTC_N_BYTES_FOR_CHAIN_TRANSMISSION];
+static uint8_t ltc_chainRXPECbuffer[LTC_N_CHAINS-1][LTC_N_BYTES_FOR_CHAIN_TRANSMISSION];
+#endif
+
 static uint8_t ltc_TXBufferClock[4+9];
 static uint8_t ltc_TXPECBufferClock[4+9];
 
@@ -228,15 +260,24 @@ static void LTC_ResetErrorTable(void);
 
 static STD_RETURN_TYPE_e LTC_StartVoltageMeasurement(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
 static STD_RETURN_TYPE_e LTC_StartGPIOMeasurement(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
-static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uint8_t PUP);
+static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uint8_t PUP, uint8_t cellGroup);
+static uint8_t LTC_GetOpenWireCellGroup(void);
+static void LTC_EvaluateOpenWire(uint8_t cellGroup);
+static void LTC_AccumulateOpenWire(uint16_t wire, uint8_t detected);
 
 static uint16_t LTC_Get_MeasurementTCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
+static void LTC_StartConversionTimer(void);
+static uint16_t LTC_GetConversionTimeLeft(void);
 static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer);
 static void LTC_SaveRXtoGPIOBuffer(uint8_t registerSet, uint8_t *rxBuffer);
 
 static STD_RETURN_TYPE_e LTC_RX_PECCheck(uint8_t *DataBufferSPI_RX_with_PEC);
 static STD_RETURN_TYPE_e LTC_RX(uint8_t *Command, uint8_t *DataBufferSPI_RX_with_PEC);
 static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC);
+static STD_RETURN_TYPE_e LTC_TransmitAllChains(uint8_t *txbuf, uint16_t size);
+static STD_RETURN_TYPE_e LTC_TransmitDataAllChains(uint8_t *DataBufferSPI_TX_with_PEC);
+static STD_RETURN_TYPE_e LTC_ReceiveDataAllChains(uint8_t *txbuf, uint8_t *DataBufferSPI_RX_with_PEC);
+static void LTC_MergeChains(uint8_t *DataBufferSPI_RX_with_PEC);
 static void LTC_SetMUXChCommand(uint8_t *DataBufferSPI_TX, uint8_t mux, uint8_t channel);
 static uint8_t LTC_SendEEPROMReadCommand(uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC, uint8_t step);
 static void LTC_SetEEPROMReadCommand(uint8_t step, uint8_t *DataBufferSPI_TX);
@@ -258,6 +299,10 @@ static STD_RETURN_TYPE_e LTC_Send_I2C_Command(uint8_t *DataBufferSPI_TX, uint8_t
 static uint8_t LTC_I2CCheckACK(uint8_t *DataBufferSPI_RX, int mux);
 
 static void LTC_SaveMuxMeasurement(uint8_t *DataBufferSPI_RX, LTC_MUX_CH_CFG_s  *muxseqptr);
+static uint8_t LTC_GetMuxGPIO(uint8_t muxID);
+static uint8_t LTC_MuxStepJoinsConversion(LTC_MUX_CH_CFG_s *muxseqptr);
+static uint8_t LTC_GetMuxSelectionSubstate(void);
+static void LTC_ContinueMuxMeasurement(void);
 
 
 static uint32_t LTC_GetSPIClock(void);
@@ -267,6 +312,14 @@ static LTC_RETURN_TYPE_e LTC_CheckStateRequest(LTC_STATE_REQUEST_e statereq);
 
 static STD_RETURN_TYPE_e LTC_TimerElapsedAndSPITransmitOngoing(uint16_t timer);
 
+static LTC_JOB_e LTC_GetJobOfRequest(LTC_STATE_REQUEST_e statereq);
+static LTC_RETURN_TYPE_e LTC_SetJobRequest(LTC_JOB_e job, LTC_STATE_REQUEST_e statereq);
+static void LTC_RecordJobStart(LTC_JOB_e job, uint32_t timestamp);
+static void LTC_FinishJobSlice(uint32_t timestamp);
+static void LTC_StartNextJob(void);
+static uint32_t LTC_GetVoltagePeriod(void);
+static LTC_ADCMODE_e LTC_SelectVoltageADCMode(uint32_t timestamp);
+
 /*================== Function Implementations =============================*/
 
 /*================== Public functions =====================================*/
@@ -287,6 +340,10 @@ static void LTC_Initialize_Database(void) {
         ltc_openwire_pdown_buffer[i] = 0;
         ltc_openwire_delta[i] = 0;
     }
+    for (i=0; i < (BS_NR_OF_MODULES * (BS_NR_OF_BAT_CELLS_PER_MODULE+1)); i++) {
+        ltc_openwire_evidence[i] = 0;
+    }
+    ltc_openwire_cellGroup = 0;
 
     for (i=0; i < (LTC_N_MUX_CHANNELS_PER_MUX*LTC_N_USER_MUX_PER_LTC*BS_NR_OF_MODULES); i++) {
         ltc_user_mux.value[i] = 0;
@@ -380,45 +437,72 @@ static void LTC_CondBasedStateTransition(STD_RETURN_TYPE_e retVal, DIAG_CH_ID_e
  * At each write iteration, the variable named "state" and related to voltages in the
  * database is incremented.
  *
+ * The measurement range plausibility check, the sum and the minimum and maximum of the
+ * valid cell voltages are done in one pass over all cells. The spread plausibility check
+ * needs the mean voltage and visits the cells a second time only if the lowest or highest
+ * cell voltage deviates too much from the mean.
+ *
  */
 extern void LTC_SaveVoltages(void) {
     uint16_t i = 0;
     uint16_t j = 0;
+    uint16_t voltage = 0;
     uint16_t min = UINT16_MAX;
     uint16_t max = 0;
+    uint16_t min_all = UINT16_MAX;
+    uint16_t max_all = 0;
     uint32_t mean = 0;
     uint32_t sum = 0;
+    uint32_t valid_volt = 0;
+    uint32_t cellmask = 0;
     uint8_t module_number_min = 0;
     uint8_t module_number_max = 0;
     uint8_t cell_number_min = 0;
     uint8_t cell_number_max = 0;
     uint16_t nrValidCellVoltages = 0;
-    STD_RETURN_TYPE_e retval_PLminmax = E_NOT_OK;
-    STD_RETURN_TYPE_e retval_PLspread = E_NOT_OK;
+    const uint16_t *ptrVoltage = ltc_cellvoltage.voltage;
+    STD_RETURN_TYPE_e retval_PLminmax = E_OK;
+    STD_RETURN_TYPE_e retval_PLspread = E_OK;
     STD_RETURN_TYPE_e result = E_NOT_OK;
 
-    /* Perform min/max voltage plausibility check */
-    retval_PLminmax = PL_CheckVoltageMinMax(&ltc_cellvoltage);
-
-    /* Use only valid cell voltages for calculating mean voltage */
     for (i=0; i < BS_NR_OF_MODULES; i++) {
+        valid_volt = ltc_cellvoltage.valid_volt[i];
+        cellmask = 0x01;
         for (j=0; j < BS_NR_OF_BAT_CELLS_PER_MODULE; j++) {
-            if ((ltc_cellvoltage.valid_volt[i] & (0x01 << j)) == 0) {
+            voltage = *ptrVoltage++;
+
+            /* Cell voltage above measurement range -> set invalid flag (same as PL_CheckVoltageMinMax()) */
+            if (voltage > SPL_MAX_CELL_VOLTAGE_LIMIT_mV) {
+                valid_volt |= cellmask;
+                retval_PLminmax = E_NOT_OK;
+            }
+
+            if ((valid_volt & cellmask) == 0) {
                 /* Cell voltage is valid -> use this voltage for subsequent calculations */
                 nrValidCellVoltages++;
-                sum += ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-                if (ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] < min) {
-                    min = ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
+                sum += voltage;
+                if (voltage < min) {
+                    min = voltage;
                     module_number_min = i;
                     cell_number_min = j;
                 }
-                if (ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] > max) {
-                    max = ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
+                if (voltage > max) {
+                    max = voltage;
                     module_number_max = i;
                     cell_number_max = j;
                 }
             }
+
+            /* The spread check includes the invalid cell voltages */
+            if (voltage < min_all) {
+                min_all = voltage;
+            }
+            if (voltage > max_all) {
+                max_all = voltage;
+            }
+            cellmask <<= 1;
         }
+        ltc_cellvoltage.valid_volt[i] = valid_volt;
     }
 
     ltc_cellvoltage.packVoltage_mV = sum;
@@ -428,8 +512,10 @@ extern void LTC_SaveVoltages(void) {
         mean = sum/nrValidCellVoltages;
     }
 
-    /* Perform voltage spread plausibility check */
-    retval_PLspread = PL_CheckVoltageSpread(&ltc_cellvoltage, mean);
+    /* Perform voltage spread plausibility check, if any cell voltage is outside of the tolerance */
+    if ((((uint32_t)min_all + SPL_CELL_VOLTAGE_AVG_TOLERANCE_mV) < mean) || (max_all > (mean + SPL_CELL_VOLTAGE_AVG_TOLERANCE_mV))) {
+        retval_PLspread = PL_CheckVoltageSpread(&ltc_cellvoltage, mean);
+    }
 
     /* Set flag if plausibility error detected */
     if ((retval_PLminmax == E_OK) && (retval_PLspread == E_OK)) {
@@ -449,6 +535,9 @@ extern void LTC_SaveVoltages(void) {
     ltc_minmax.voltage_module_number_max = module_number_max;
     ltc_minmax.voltage_cell_number_max = cell_number_max;
 
+    ltc_cellvoltage.adcMode = ltc_adcmode_policy.voltageMode;
+    ltc_cellvoltage.measurementPeriod_ms = (ltc_job_statistics[LTC_JOB_VOLTAGE].lastPeriod_ms > UINT16_MAX) ?
+            UINT16_MAX : ltc_job_statistics[LTC_JOB_VOLTAGE].lastPeriod_ms;
     DB_WriteBlock(&ltc_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
     DB_WriteBlock(&ltc_minmax, DATA_BLOCK_ID_MINMAX);
 }
@@ -507,6 +596,8 @@ extern void LTC_SaveTemperatures(void) {
         mean = sum/nrValidTemperatures;
     }
 
+    ltc_celltemperature.refreshTime_ms = (ltc_job_statistics[LTC_JOB_MUX_SEQUENCE].lastPeriod_ms > UINT16_MAX) ?
+            UINT16_MAX : ltc_job_statistics[LTC_JOB_MUX_SEQUENCE].lastPeriod_ms;
     ltc_celltemperature.state++;
     ltc_minmax.state++;
     ltc_minmax.temperature_mean = mean;
@@ -650,12 +741,22 @@ LTC_STATE_REQUEST_e LTC_TransferStateRequest(uint8_t *busIDptr, LTC_ADCMODE_e *a
 LTC_RETURN_TYPE_e LTC_SetStateRequest(LTC_STATE_REQUEST_e statereq) {
     LTC_RETURN_TYPE_e retVal = LTC_STATE_NO_REQUEST;
 
+    LTC_JOB_e job = LTC_GetJobOfRequest(statereq);
+
     OS_TaskEnter_Critical();
     retVal = LTC_CheckStateRequest(statereq);
 
     if (retVal == LTC_OK || retVal == LTC_BUSY_OK || retVal == LTC_OK_FROM_ERROR) {
+        if (job == LTC_JOB_NONE) {
             ltc_state.statereq   = statereq;
+        } else if (ltc_state.state == LTC_STATEMACH_UNINITIALIZED) {
+            /* jobs are only started by the scheduler of the initialized state machine */
+            retVal = LTC_ILLEGAL_REQUEST;
+        } else {
+            /* started by the scheduler at the end of a measurement cycle */
+            retVal = LTC_SetJobRequest(job, statereq);
         }
+    }
     OS_TaskExit_Critical();
 
     return (retVal);
@@ -667,6 +768,7 @@ void LTC_Trigger(void) {
     uint8_t tmpbusID = 0;
     LTC_ADCMODE_e tmpadcMode = LTC_ADCMODE_UNDEFINED;
     LTC_ADCMEAS_CHAN_e tmpadcMeasCh = LTC_ADCMEAS_UNDEFINED;
+    uint32_t timestamp = 0;
 
     /* Check re-entrance of function */
     if (LTC_CheckReEntrance())
@@ -699,6 +801,9 @@ void LTC_Trigger(void) {
             statereq = LTC_TransferStateRequest(&tmpbusID, &tmpadcMode, &tmpadcMeasCh);
             if (statereq == LTC_STATE_INIT_REQUEST) {
                 LTC_SAVELASTSTATES();
+#if BUILD_MODULE_ENABLE_LTC_EMULATION == 1
+                LTCEMU_Init(LTC_N_LTC, LTC_N_LTC_PER_CHAIN);
+#endif
                 LTC_StateTransition(LTC_STATEMACH_INITIALIZATION, LTC_ENTRY_UNINITIALIZED, LTC_STATEMACH_SHORTTIME);
                 ltc_state.adcMode = tmpadcMode;
                 ltc_state.adcMeasCh = tmpadcMeasCh;
@@ -742,6 +847,7 @@ void LTC_Trigger(void) {
                 LTC_SAVELASTSTATES();
                 LTC_Initialize_Database();
                 LTC_ResetErrorTable();
+                LTC_ResetJobStatistics();
                 LTC_StateTransition(LTC_STATEMACH_INITIALIZED, LTC_ENTRY_INITIALIZATION, LTC_STATEMACH_SHORTTIME);
             }
             break;
@@ -759,14 +865,33 @@ void LTC_Trigger(void) {
         /****************************START MEASUREMENT*******************************/
         case LTC_STATEMACH_STARTMEAS:
 
-            ltc_state.adcMode = LTC_VOLTAGE_MEASUREMENT_MODE;
+            timestamp = OS_getOSSysTick();
+            LTC_FinishJobSlice(timestamp);
+            LTC_RecordJobStart(LTC_JOB_VOLTAGE, timestamp);
+
+            /* the ADC mode only changes between two measurement cycles, no conversion is ongoing */
+            if (LTC_ADAPTIVE_ADC_MODE == TRUE) {
+                ltc_adcmode_policy.voltageMode = LTC_SelectVoltageADCMode(timestamp);
+            }
+            ltc_state.adcMode = ltc_adcmode_policy.voltageMode;
             ltc_state.adcMeasCh = LTC_ADCMEAS_ALLCHANNEL;
 
+            ltc_state.muxStepsInCycle = 0;
             ltc_state.check_spi_flag = FALSE;
             retVal = LTC_StartVoltageMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
-            LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
-                                      LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, (ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)),
-                                      LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, LTC_STATEMACH_SHORTTIME);
+            if (LTC_PIPELINED_MEASUREMENT == TRUE) {
+                /* configure the multiplexer while the cell voltages are converted */
+                LTC_StartConversionTimer();
+                ltc_state.muxConversionPending = FALSE;
+                ltc_state.voltageReadPending = TRUE;
+                LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
+                                          LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXCONFIGURATION_INIT, ltc_state.commandTransferTime,
+                                          LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, LTC_STATEMACH_SHORTTIME);
+            } else {
+                LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
+                                          LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, (ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)),
+                                          LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, LTC_STATEMACH_SHORTTIME);
+            }
             break;
 
         /****************************READ VOLTAGE************************************/
@@ -774,7 +899,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVA), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -786,7 +910,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoVoltagebuffer(0, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVB), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -798,7 +921,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoVoltagebuffer(1, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVC), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -810,7 +932,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoVoltagebuffer(2, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVD), ltc_RXPECbuffer);
                 if (BS_MAX_SUPPORTED_CELLS > 12) {
                     LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
@@ -828,7 +949,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoVoltagebuffer(3, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVE), ltc_RXPECbuffer);
                  if (BS_MAX_SUPPORTED_CELLS > 15) {
                     LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
@@ -846,7 +966,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoVoltagebuffer(4, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDCVF), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_READVOLTAGE, LTC_EXIT_READVOLTAGE, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -868,7 +987,17 @@ void LTC_Trigger(void) {
                  * e.g. open-wire check...                                */
                 if (ltc_state.reusageMeasurementMode == LTC_NOT_REUSED) {
                     LTC_SaveVoltages();
-                    LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXCONFIGURATION_INIT, LTC_STATEMACH_SHORTTIME);
+                    ltc_state.voltageReadPending = FALSE;
+                    if (LTC_PIPELINED_MEASUREMENT == FALSE) {
+                        LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXCONFIGURATION_INIT, LTC_STATEMACH_SHORTTIME);
+                    } else if (ltc_state.muxConversionPending == TRUE) {
+                        /* the multiplexer input was converted while the cell voltages were read */
+                        ltc_state.muxConversionPending = FALSE;
+                        LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_READMUXMEASUREMENT, LTC_GetConversionTimeLeft());
+                    } else {
+                        /* no multiplexer input converted (multiplexer switched off or SPI error) */
+                        LTC_ContinueMuxMeasurement();
+                    }
                 } else if (ltc_state.reusageMeasurementMode == LTC_REUSE_READVOLT_FOR_ADOW_PUP) {
                     LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_READ_VOLTAGES_PULLUP_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
                 } else if (ltc_state.reusageMeasurementMode == LTC_REUSE_READVOLT_FOR_ADOW_PDOWN) {
@@ -893,15 +1022,16 @@ void LTC_Trigger(void) {
                     ltc_state.muxmeas_nr_end = ltc_mux_seq.nr_of_steps;
                     ltc_state.muxmeas_seqendptr = ((LTC_MUX_CH_CFG_s *)ltc_mux_seq.seqptr)+ltc_mux_seq.nr_of_steps;  /* last sequence + 1 */
 
+                    LTC_RecordJobStart(LTC_JOB_MUX_SEQUENCE, OS_getOSSysTick());
                     LTC_SaveTemperatures();
 
                     if (LTC_IsFirstMeasurementCycleFinished() == FALSE) {
                         LTC_SetFirstMeasurementCycleFinished();
                     }
                 }
+                ltc_state.muxmeas_selectptr = ltc_state.muxmeas_seqptr;
 
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SetMuxChannel(ltc_TXBuffer, ltc_TXPECbuffer,
                                             ltc_state.muxmeas_seqptr->muxID,  /* mux */
                                             ltc_state.muxmeas_seqptr->muxCh  /* channel */);
@@ -915,6 +1045,23 @@ void LTC_Trigger(void) {
                 }
                 break;
 
+            } else if (ltc_state.substate == LTC_STATEMACH_MUXCONFIGURATION_NEXT) {
+                /* batched measurement: select the channel of the next step for the same conversion */
+                ltc_state.check_spi_flag = TRUE;
+                retVal = LTC_SetMuxChannel(ltc_TXBuffer, ltc_TXPECbuffer,
+                                            (ltc_state.muxmeas_selectptr+1)->muxID,  /* mux */
+                                            (ltc_state.muxmeas_selectptr+1)->muxCh  /* channel */);
+                if (retVal != E_OK) {
+                    /* convert the steps selected so far, this step is selected again for the next conversion */
+                    DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_NOK, 0);
+                    LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_SHORTTIME);
+                } else {
+                    DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
+                    ++ltc_state.muxmeas_selectptr;
+                    LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_SEND_CLOCK_STCOMM_MUXMEASUREMENT_CONFIG, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT));
+                }
+                break;
+
             } else if (ltc_state.substate == LTC_SEND_CLOCK_STCOMM_MUXMEASUREMENT_CONFIG) {
                 if (ltc_state.timer == 0 && SPI_IsTransmitOngoing() == TRUE) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_NOK, 0);
@@ -922,7 +1069,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 if (LTC_GOTO_MUX_CHECK == TRUE) {
                     LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
@@ -930,8 +1076,8 @@ void LTC_Trigger(void) {
                                               LTC_STATEMACH_MUXMEASUREMENT, LTC_READ_I2C_TRANSMISSION_RESULT_RDCOMM_MUXMEASUREMENT_CONFIG, LTC_STATEMACH_SHORTTIME);;
                 } else {
                     LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
-                                              LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXMEASUREMENT, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
-                                              LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_SHORTTIME);
+                                              LTC_STATEMACH_MUXMEASUREMENT, LTC_GetMuxSelectionSubstate(), (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
+                                              LTC_STATEMACH_MUXMEASUREMENT, LTC_GetMuxSelectionSubstate(), LTC_STATEMACH_SHORTTIME);
                 }
                 break;
 
@@ -942,7 +1088,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_MUXMEASUREMENT, LTC_READ_I2C_TRANSMISSION_CHECK_MUXMEASUREMENT_CONFIG, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -960,9 +1105,9 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
 
                 /* if CRC OK: check multiplexer answer on i2C bus */
-                retVal = LTC_I2CCheckACK(ltc_RXPECbuffer, ltc_state.muxmeas_seqptr->muxID);
+                retVal = LTC_I2CCheckACK(ltc_RXPECbuffer, ltc_state.muxmeas_selectptr->muxID);
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_MUX, 0);
-                LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_SHORTTIME);
+                LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_GetMuxSelectionSubstate(), LTC_STATEMACH_SHORTTIME);
                 break;
 
             } else if (ltc_state.substate == LTC_STATEMACH_MUXMEASUREMENT) {
@@ -970,7 +1115,18 @@ void LTC_Trigger(void) {
                     /* actual multiplexer is switched off, so do not make a measurement and follow up with next step (mux configuration) */
                     ++ltc_state.muxmeas_seqptr;         /*  go further with next step of sequence
                                                             ltc_state.numberOfMeasuredMux not decremented, this does not count as a measurement */
-                    LTC_StateTransition(LTC_STATEMACH_STARTMEAS, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
+                    if ((LTC_PIPELINED_MEASUREMENT == TRUE) && (ltc_state.voltageReadPending == TRUE)) {
+                        /* read the cell voltages as soon as their conversion is finished */
+                        ltc_state.check_spi_flag = FALSE;
+                        LTC_StateTransition(LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, LTC_GetConversionTimeLeft());
+                    } else {
+                        LTC_ContinueMuxMeasurement();
+                    }
+                    break;
+                } else if ((LTC_PIPELINED_MEASUREMENT == TRUE) && (LTC_GetConversionTimeLeft() > 0u)) {
+                    /* the ADC is still busy with the cell voltages, wait before starting the next conversion */
+                    ltc_state.check_spi_flag = FALSE;
+                    LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXMEASUREMENT, LTC_GetConversionTimeLeft());
                     break;
                 } else {
                     if (LTC_GOTO_MUX_CHECK == FALSE) {
@@ -982,22 +1138,36 @@ void LTC_Trigger(void) {
                     }
 
                     ltc_state.check_spi_flag = FALSE;
-                    /* user multiplexer type -> connected to GPIO2! */
-                    if (ltc_state.muxmeas_seqptr->muxID == 1 || ltc_state.muxmeas_seqptr->muxID == 2) {
-                        retVal = LTC_StartGPIOMeasurement(ltc_state.adcMode, LTC_ADCMEAS_SINGLECHANNEL_GPIO2);
+                    if (ltc_state.muxmeas_selectptr > ltc_state.muxmeas_seqptr) {
+                        /* batched measurement: GPIO1 and GPIO2 are converted together */
+                        ltc_state.adcMeasCh = LTC_ADCMEAS_ALLCHANNEL;
+                    } else if (LTC_GetMuxGPIO(ltc_state.muxmeas_seqptr->muxID) == 2) {
+                        /* user multiplexer type -> connected to GPIO2! */
+                        ltc_state.adcMeasCh = LTC_ADCMEAS_SINGLECHANNEL_GPIO2;
                     } else {
-                        retVal = LTC_StartGPIOMeasurement(ltc_state.adcMode, LTC_ADCMEAS_SINGLECHANNEL_GPIO1);
+                        ltc_state.adcMeasCh = LTC_ADCMEAS_SINGLECHANNEL_GPIO1;
                     }
+                    retVal = LTC_StartGPIOMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
+                }
+                if ((LTC_PIPELINED_MEASUREMENT == TRUE) && (ltc_state.voltageReadPending == TRUE)) {
+                    /* read the cell voltages while the multiplexer input is converted */
+                    LTC_StartConversionTimer();
+                    if (retVal == E_OK) {
+                        ltc_state.muxConversionPending = TRUE;
+                    }
+                    LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
+                                              LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, ltc_state.commandTransferTime,
+                                              LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, LTC_STATEMACH_SHORTTIME);
+                } else {
+                    LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
+                                              LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_READMUXMEASUREMENT, (ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)),  /*  wait, ADAX-Command */
+                                              LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_READMUXMEASUREMENT, LTC_STATEMACH_SHORTTIME);
                 }
-                LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
-                                          LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_READMUXMEASUREMENT, (ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, LTC_ADCMEAS_SINGLECHANNEL_GPIO2)),  /*  wait, ADAX-Command */
-                                          LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_READMUXMEASUREMENT, LTC_STATEMACH_SHORTTIME);
                 break;
 
             } else if (ltc_state.substate == LTC_STATEMACH_READMUXMEASUREMENT) {
                 ltc_state.check_spi_flag = TRUE;
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXA), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_STOREMUXMEASUREMENT, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1013,49 +1183,15 @@ void LTC_Trigger(void) {
 
                 retVal = LTC_RX_PECCheck(ltc_RXPECbuffer);
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
-                LTC_SaveMuxMeasurement(ltc_RXPECbuffer, ltc_state.muxmeas_seqptr);
-
-                ++ltc_state.muxmeas_seqptr;
-
-                if (ltc_state.balance_control_done == TRUE) {
-                    statereq = LTC_TransferStateRequest(&tmpbusID, &tmpadcMode, &tmpadcMeasCh);
-                    if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_CONTROL, LTC_USER_IO_SET_OUTPUT_REGISTER, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_FEEDBACK, LTC_USER_IO_READ_INPUT_REGISTER, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST_TI) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_CONTROL_TI, LTC_USER_IO_SET_DIRECTION_REGISTER_TI, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST_TI) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_SET_DIRECTION_REGISTER_TI, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_READ_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_READ_DATA1, LTC_STATEMACH_SHORTTIME);
-                    } else if (statereq == LTC_STATE_EEPROM_WRITE_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_EEPROM_WRITE, LTC_EEPROM_WRITE_DATA1, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_TEMP_SENS_READ_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_TEMP_SENS_READ, LTC_TEMP_SENS_SEND_DATA1, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATEMACH_BALANCEFEEDBACK_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_BALANCEFEEDBACK, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    }   else if (statereq == LTC_STATE_OPENWIRE_CHECK_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
-                        /* Send ADOW command with PUP two times */
-                        ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
-                        ltc_state.balance_control_done = FALSE;
-                    } else {
-                        LTC_StateTransition(LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG_BALANCECONTROL, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = TRUE;
-                    }
-                } else {
-                    LTC_StateTransition(LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG_BALANCECONTROL, LTC_STATEMACH_SHORTTIME);
-                    ltc_state.balance_control_done = TRUE;
+                /* all steps selected for this conversion were measured */
+                while (ltc_state.muxmeas_seqptr <= ltc_state.muxmeas_selectptr) {
+                    LTC_SaveMuxMeasurement(ltc_RXPECbuffer, ltc_state.muxmeas_seqptr);
+                    ++ltc_state.muxmeas_seqptr;
+                    ltc_state.muxStepsInCycle++;
                 }
 
+                LTC_ContinueMuxMeasurement();
+
                 break;
             }
 
@@ -1066,7 +1202,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_CONFIG_BALANCECONTROL) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_BalanceControl(0);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG2_BALANCECONTROL, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1083,7 +1218,6 @@ void LTC_Trigger(void) {
                 }
 
                 if (BS_NR_OF_BAT_CELLS_PER_MODULE > 12) {
-                    SPI_SetTransmitOngoing();
                     retVal = LTC_BalanceControl(1);
                     LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                             LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG2_BALANCECONTROL_END, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1130,7 +1264,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_READ_AUXILIARY_REGISTER_A_RDAUXA) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXA), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_READALLGPIO, LTC_READ_AUXILIARY_REGISTER_B_RDAUXB, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1142,7 +1275,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoGPIOBuffer(0, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXB), ltc_RXPECbuffer);
 
                 if (BS_MAX_SUPPORTED_CELLS > 12) {
@@ -1161,7 +1293,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoGPIOBuffer(1, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXC), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_READALLGPIO, LTC_READ_AUXILIARY_REGISTER_D_RDAUXD, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1173,7 +1304,6 @@ void LTC_Trigger(void) {
                 DIAG_checkEvent(retVal, DIAG_CH_LTC_PEC, 0);
                 LTC_SaveRXtoGPIOBuffer(2, ltc_RXPECbuffer);
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)(ltc_cmdRDAUXD), ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_READALLGPIO, LTC_EXIT_READAUXILIARY_ALLGPIOS, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1192,45 +1322,8 @@ void LTC_Trigger(void) {
 
                 LTC_SaveAllGPIOMeasurement();
 
-                if (ltc_state.balance_control_done == TRUE) {
-                    statereq = LTC_TransferStateRequest(&tmpbusID, &tmpadcMode, &tmpadcMeasCh);
-                    if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_CONTROL, LTC_USER_IO_SET_OUTPUT_REGISTER, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_FEEDBACK, LTC_USER_IO_READ_INPUT_REGISTER, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST_TI) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_CONTROL_TI, LTC_USER_IO_SET_DIRECTION_REGISTER_TI, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_USER_IO_READ_REQUEST_TI) {
-                        LTC_StateTransition(LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_SET_DIRECTION_REGISTER_TI, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_READ_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_READ_DATA1, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_EEPROM_WRITE_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_EEPROM_WRITE, LTC_EEPROM_WRITE_DATA1, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATE_TEMP_SENS_READ_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_TEMP_SENS_READ, LTC_TEMP_SENS_SEND_DATA1, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    } else if (statereq == LTC_STATEMACH_BALANCEFEEDBACK_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_BALANCEFEEDBACK, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = FALSE;
-                    }  else if (statereq == LTC_STATE_OPENWIRE_CHECK_REQUEST) {
-                        LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
-                        /* Send ADOW command with PUP two times */
-                        ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
-                        ltc_state.balance_control_done = FALSE;
-                    } else {
-                        LTC_StateTransition(LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG_BALANCECONTROL, LTC_STATEMACH_SHORTTIME);
-                        ltc_state.balance_control_done = TRUE;
-                    }
-                } else {
-                    LTC_StateTransition(LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG_BALANCECONTROL, LTC_STATEMACH_SHORTTIME);
-                    ltc_state.balance_control_done = TRUE;
-                }
+                /* end of the measurement cycle, start the next job */
+                LTC_StartNextJob();
             }
 
             break;
@@ -1252,7 +1345,6 @@ void LTC_Trigger(void) {
 
             } else if (ltc_state.substate == LTC_READ_FEEDBACK_BALANCECONTROL) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)ltc_cmdRDAUXA, ltc_RXPECbuffer);  /* read AUXA register */
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_BALANCEFEEDBACK, LTC_SAVE_FEEDBACK_BALANCECONTROL, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1283,7 +1375,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_TEMP_SENS_SEND_DATA1) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_Send_I2C_Command(ltc_TXBuffer, ltc_TXPECbuffer, (uint8_t*)ltc_I2CcmdTempSens0);
 
                 if (retVal != E_OK) {
@@ -1306,7 +1397,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_TEMP_SENS_READ, LTC_TEMP_SENS_READ_DATA1, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1322,7 +1412,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_Send_I2C_Command(ltc_TXBuffer, ltc_TXPECbuffer, (uint8_t*)ltc_I2CcmdTempSens1);
 
                 if (retVal != E_OK) {
@@ -1345,7 +1434,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_TEMP_SENS_READ, LTC_TEMP_SENS_READ_I2C_TRANSMISSION_RESULT_RDCOMM, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1360,7 +1448,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_TEMP_SENS_READ, LTC_TEMP_SENS_SAVE_TEMP, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1393,7 +1480,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_USER_IO_SET_OUTPUT_REGISTER) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SetPortExpander(ltc_TXBuffer, ltc_TXPECbuffer);
 
                 if (retVal != E_OK) {
@@ -1429,7 +1515,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_USER_IO_READ_INPUT_REGISTER) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_Send_I2C_Command(ltc_TXBuffer, ltc_TXPECbuffer, (uint8_t*)ltc_I2CcmdPortExpander1);
 
                 if (retVal != E_OK) {
@@ -1468,7 +1553,6 @@ void LTC_Trigger(void) {
                         DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                     }
 
-                    SPI_SetTransmitOngoing();
                     retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_RXPECbuffer);
                     LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                               LTC_STATEMACH_USER_IO_FEEDBACK, LTC_USER_IO_SAVE_DATA, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1502,7 +1586,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_USER_IO_SET_DIRECTION_REGISTER_TI) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SetPortExpanderDirection_TI(LTC_PORT_EXPANDER_TI_OUTPUT, ltc_TXBuffer, ltc_TXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                     LTC_STATEMACH_USER_IO_CONTROL_TI, LTC_USER_IO_SEND_CLOCK_STCOMM_TI, LTC_STATEMACH_SHORTTIME,
@@ -1528,7 +1611,6 @@ void LTC_Trigger(void) {
 
             } else if (ltc_state.substate == LTC_USER_IO_SET_OUTPUT_REGISTER_TI) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SetPortExpander_Output_TI(ltc_TXBuffer, ltc_TXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_USER_IO_CONTROL_TI, LTC_USER_IO_READ_I2C_TRANSMISSION_RESULT_RDCOMM_TI_SECOND, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1558,7 +1640,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_USER_IO_SET_DIRECTION_REGISTER_TI) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SetPortExpanderDirection_TI(LTC_PORT_EXPANDER_TI_INPUT, ltc_TXBuffer, ltc_TXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                     LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_SEND_CLOCK_STCOMM_TI, LTC_STATEMACH_SHORTTIME,
@@ -1584,7 +1665,6 @@ void LTC_Trigger(void) {
 
             } else if (ltc_state.substate == LTC_USER_IO_READ_INPUT_REGISTER_TI_FIRST) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_GetPortExpander_Input_TI(0, ltc_TXBuffer, ltc_TXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                         LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_READ_I2C_TRANSMISSION_RESULT_RDCOMM_TI_SECOND, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1608,7 +1688,6 @@ void LTC_Trigger(void) {
                 break;
             } else if (ltc_state.substate == LTC_USER_IO_READ_INPUT_REGISTER_TI_SECOND) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_GetPortExpander_Input_TI(1, ltc_TXBuffer, ltc_TXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                     LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_READ_I2C_TRANSMISSION_RESULT_RDCOMM_TI_THIRD, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1639,7 +1718,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                     LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_SAVE_DATA_TI, ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT,
@@ -1673,7 +1751,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_EEPROM_READ_DATA1) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SendEEPROMReadCommand(ltc_TXBuffer, ltc_TXPECbuffer, 0);
 
                 if (retVal != E_OK) {
@@ -1696,7 +1773,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_READ_DATA2, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1712,7 +1788,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SendEEPROMReadCommand(ltc_TXBuffer, ltc_TXPECbuffer, 1);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_SEND_CLOCK_STCOMM2, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1728,7 +1803,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_READ_I2C_TRANSMISSION_RESULT_RDCOMM, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1743,7 +1817,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_RXPECbuffer);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_SAVE_READ, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1776,7 +1849,6 @@ void LTC_Trigger(void) {
 
             if (ltc_state.substate == LTC_EEPROM_WRITE_DATA1) {
                 ltc_state.check_spi_flag = TRUE;
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SendEEPROMWriteCommand(ltc_TXBuffer, ltc_TXPECbuffer, 0);
 
                 if (retVal != E_OK) {
@@ -1799,7 +1871,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_WRITE, LTC_EEPROM_WRITE_DATA2, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1815,7 +1886,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_SendEEPROMWriteCommand(ltc_TXBuffer, ltc_TXPECbuffer, 1);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_WRITE, LTC_EEPROM_SEND_CLOCK_STCOMM4, (ltc_state.commandDataTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1831,7 +1901,6 @@ void LTC_Trigger(void) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
                 }
 
-                SPI_SetTransmitOngoing();
                 retVal = LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
                 LTC_CondBasedStateTransition(retVal, DIAG_CH_LTC_SPI,
                                           LTC_STATEMACH_EEPROM_WRITE, LTC_EEPROM_FINISHED, (ltc_state.gpioClocksTransferTime+LTC_TRANSMISSION_TIMEOUT),
@@ -1856,18 +1925,19 @@ void LTC_Trigger(void) {
             if (ltc_state.substate == LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK) {
                 /* Run ADOW command with PUP = 1 */
                 ltc_state.adcMode = LTC_OW_MEASUREMENT_MODE;
+                ltc_state.adcMeasCh = (LTC_GetOpenWireCellGroup() == 0) ? LTC_ADCMEAS_ALLCHANNEL : LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS;
                 ltc_state.check_spi_flag = FALSE;
 
-                retVal = LTC_StartOpenWireMeasurement(ltc_state.adcMode, 1);
+                retVal = LTC_StartOpenWireMeasurement(ltc_state.adcMode, 1, LTC_GetOpenWireCellGroup());
                 if (retVal == E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
-                    LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, LTC_ADCMEAS_ALLCHANNEL)));
+                    LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)));
                     ltc_state.resendCommandCounter--;
 
                     /* Check how many retries are left */
                     if (ltc_state.resendCommandCounter == 0) {
                         /* Switch to read voltage state to read cell voltages */
-                        LTC_StateTransition(LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, LTC_ADCMEAS_ALLCHANNEL)));
+                        LTC_StateTransition(LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)));
                         /* Reuse read voltage register */
                         ltc_state.reusageMeasurementMode = LTC_REUSE_READVOLT_FOR_ADOW_PUP;
                     }
@@ -1884,25 +1954,26 @@ void LTC_Trigger(void) {
                     ltc_openwire_pup_buffer[i] = ltc_cellvoltage.voltage[i];
                 }
 
-                /* Set number of ADOW retries - send ADOW command with pull-down two times */
-                ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
-                LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLDOWN_CURRENT_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
+                /* End of the pull-up slice, the pull-down slice is started by the scheduler in a later cycle */
+                ltc_job_state[LTC_JOB_OPENWIRE_CHECK].slice = 1;
+                LTC_StateTransition(LTC_STATEMACH_STARTMEAS, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
 
             } else if (ltc_state.substate == LTC_REQUEST_PULLDOWN_CURRENT_OPENWIRE_CHECK) {
                 /* Run ADOW command with PUP = 0 */
                 ltc_state.adcMode = LTC_OW_MEASUREMENT_MODE;
+                ltc_state.adcMeasCh = (LTC_GetOpenWireCellGroup() == 0) ? LTC_ADCMEAS_ALLCHANNEL : LTC_ADCMEAS_SINGLECHANNEL_TWOCELLS;
                 ltc_state.check_spi_flag = FALSE;
 
-                retVal = LTC_StartOpenWireMeasurement(ltc_state.adcMode, 0);
+                retVal = LTC_StartOpenWireMeasurement(ltc_state.adcMode, 0, LTC_GetOpenWireCellGroup());
                 if (retVal == E_OK) {
                     DIAG_Handler(DIAG_CH_LTC_SPI, DIAG_EVENT_OK, 0);
-                    LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLDOWN_CURRENT_OPENWIRE_CHECK, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, LTC_ADCMEAS_ALLCHANNEL)));
+                    LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLDOWN_CURRENT_OPENWIRE_CHECK, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)));
                     ltc_state.resendCommandCounter--;
 
                     /* Check how many retries are left */
                     if (ltc_state.resendCommandCounter == 0) {
                         /* Switch to read voltage state to read cell voltages */
-                        LTC_StateTransition(LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, LTC_ADCMEAS_ALLCHANNEL)));
+                        LTC_StateTransition(LTC_STATEMACH_READVOLTAGE, LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE, (ltc_state.commandDataTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh)));
                         /* Reuse read voltage register */
                         ltc_state.reusageMeasurementMode = LTC_REUSE_READVOLT_FOR_ADOW_PDOWN;
                     }
@@ -1921,33 +1992,27 @@ void LTC_Trigger(void) {
                 LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_PERFORM_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
             } else if (ltc_state.substate == LTC_PERFORM_OPENWIRE_CHECK) {
                 /* Perform actual open-wire check */
-                for (uint8_t m = 0; m < BS_NR_OF_MODULES; m++) {
-                    /* Open-wire at C0: cell_pup(0) == 0 */
-                    if (ltc_openwire_pup_buffer[0 + (m*BS_NR_OF_BAT_CELLS_PER_MODULE)] == 0) {
-                        ltc_openwire.openwire[0 + (m*(BS_NR_OF_BAT_CELLS_PER_MODULE))] = 1;
-                    }
-                    /* Open-wire at Cmax: cell_pdown(BS_NR_OF_BAT_CELLS_PER_MODULE-1) == 0 */
-                    if (ltc_openwire_pdown_buffer[((BS_NR_OF_BAT_CELLS_PER_MODULE-1) + (m*BS_NR_OF_BAT_CELLS_PER_MODULE))] == 0) {
-                        ltc_openwire.openwire[BS_NR_OF_BAT_CELLS_PER_MODULE + (m*BS_NR_OF_BAT_CELLS_PER_MODULE)] = 1;
-                    }
-                }
-
-                /* Take difference between pull-up and pull-down measurement */
-                for (uint16_t i = 1; i < BS_NR_OF_BAT_CELLS; i++) {
-                    ltc_openwire_delta[i] = (int32_t)(ltc_openwire_pup_buffer[i] - ltc_openwire_pdown_buffer[i]);
-                }
-
-                /* Open-wire at C(N): delta cell(n+1) < -400mV */
-                for (uint8_t m = 0; m < BS_NR_OF_MODULES; m++) {
-                    for (uint8_t c = 1; c < BS_NR_OF_BAT_CELLS_PER_MODULE-1; c++) {
-                        if (ltc_openwire_delta[c + (m*BS_NR_OF_BAT_CELLS_PER_MODULE)] < -400) {
-                            ltc_openwire.openwire[c + (m*BS_NR_OF_BAT_CELLS_PER_MODULE)] = 1;
-                        }
+                LTC_EvaluateOpenWire(LTC_GetOpenWireCellGroup());
+
+                if (LTC_OPENWIRE_DISTRIBUTED == TRUE) {
+                    /* next cell group, the pack is covered when all groups were checked */
+                    ltc_openwire_cellGroup++;
+                    if (ltc_openwire_cellGroup >= LTC_OPENWIRE_NR_OF_CELL_GROUPS) {
+                        ltc_openwire_cellGroup = 0;
+                        ltc_openwire.completed_checks++;
                     }
+                } else {
+                    ltc_openwire.completed_checks++;
                 }
 
                 /* Write database entry */
                 DB_WriteBlock(&ltc_openwire, DATA_BLOCK_ID_OPEN_WIRE);
+
+                OS_TaskEnter_Critical();
+                ltc_job_state[LTC_JOB_OPENWIRE_CHECK].slice = 0;
+                ltc_job_state[LTC_JOB_OPENWIRE_CHECK].pending = FALSE;
+                OS_TaskExit_Critical();
+
                 /* Start new measurement cycle */
                 LTC_StateTransition(LTC_STATEMACH_STARTMEAS, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
             }
@@ -2009,11 +2074,11 @@ static void LTC_SaveMuxMeasurement(uint8_t *rxBuffer, LTC_MUX_CH_CFG_s  *muxseqp
             if (sensor_idx >= BS_NR_OF_TEMP_SENSORS_PER_MODULE)
                 return;
             /* Set bitmask for valid flags */
-            bitmask |= 1 < sensor_idx;
+            bitmask = 1u << sensor_idx;
             /* Check LTC PEC error */
             if (LTC_ErrorTable[i].PEC_valid == TRUE) {
-                bitmask = ~bitmask;  /* negate bitmask to only validate flags of this cell voltage */
-                ltc_celltemperature.valid_temperature[i] &= bitmask;
+                /* only validate the flag of this sensor */
+                ltc_celltemperature.valid_temperature[i] &= ~bitmask;
                 ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+sensor_idx] = temperature;
             } else {
                 ltc_celltemperature.valid_temperature[i] |= bitmask;
@@ -2023,6 +2088,93 @@ static void LTC_SaveMuxMeasurement(uint8_t *rxBuffer, LTC_MUX_CH_CFG_s  *muxseqp
 }
 
 
+/**
+ * @brief   gets the GPIO of the LTC the multiplexer is connected to.
+ *
+ * @param   muxID   ID of the multiplexer
+ *
+ * @return  2 for the user multiplexers, 1 for the temperature multiplexers
+ */
+static uint8_t LTC_GetMuxGPIO(uint8_t muxID) {
+    uint8_t gpio = 1;
+
+    if (muxID == 1 || muxID == 2) {
+        gpio = 2;
+    }
+    return gpio;
+}
+
+
+/**
+ * @brief   checks if a step of the multiplexer sequence is converted together with the selected steps.
+ *
+ * In batched measurement, the steps from ltc_state.muxmeas_seqptr to ltc_state.muxmeas_selectptr
+ * are converted with one ADAX command. A further step joins this conversion if its multiplexer
+ * is connected to another GPIO than the multiplexers of the selected steps and the number of
+ * multiplexer measurements per cycle is not exceeded. Steps switching a multiplexer off are
+ * always executed alone.
+ *
+ * @param   muxseqptr   step of the multiplexer sequence
+ *
+ * @return  TRUE if the step joins the conversion, FALSE otherwise
+ */
+static uint8_t LTC_MuxStepJoinsConversion(LTC_MUX_CH_CFG_s *muxseqptr) {
+    LTC_MUX_CH_CFG_s *selectedptr = NULL_PTR;
+    uint8_t retVal = TRUE;
+
+    if (LTC_MUX_BATCHED_MEASUREMENT == FALSE || muxseqptr >= ltc_state.muxmeas_seqendptr) {
+        retVal = FALSE;
+    } else if (muxseqptr->muxCh == 0xFF || ltc_state.muxmeas_seqptr->muxCh == 0xFF) {
+        retVal = FALSE;
+    } else if (ltc_state.muxStepsInCycle + (muxseqptr - ltc_state.muxmeas_seqptr) >= LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE) {
+        retVal = FALSE;
+    } else {
+        for (selectedptr = ltc_state.muxmeas_seqptr; selectedptr < muxseqptr; selectedptr++) {
+            if (LTC_GetMuxGPIO(selectedptr->muxID) == LTC_GetMuxGPIO(muxseqptr->muxID)) {
+                retVal = FALSE;
+            }
+        }
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   gets the substate after a multiplexer channel was selected.
+ *
+ * @return  LTC_STATEMACH_MUXCONFIGURATION_NEXT if the next step of the sequence joins the
+ *          conversion, LTC_STATEMACH_MUXMEASUREMENT to start the conversion otherwise
+ */
+static uint8_t LTC_GetMuxSelectionSubstate(void) {
+    /* The conversion substate uses the value of the state, like in LTC_Trigger() */
+    uint8_t substate = LTC_STATEMACH_MUXMEASUREMENT;
+
+    if (LTC_MuxStepJoinsConversion(ltc_state.muxmeas_selectptr+1) == TRUE) {
+        substate = LTC_STATEMACH_MUXCONFIGURATION_NEXT;
+    }
+    return substate;
+}
+
+
+/**
+ * @brief   continues the multiplexer sequence or ends the measurement cycle.
+ *
+ * Without batched measurement, one step of the multiplexer sequence is measured per cycle.
+ * In batched measurement, the sequence continues until LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE
+ * steps were measured or the end of the sequence is reached.
+ */
+static void LTC_ContinueMuxMeasurement(void) {
+    if ((LTC_MUX_BATCHED_MEASUREMENT == TRUE) &&
+            (ltc_state.muxStepsInCycle < LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE) &&
+            (ltc_state.muxmeas_seqptr < ltc_state.muxmeas_seqendptr)) {
+        LTC_StateTransition(LTC_STATEMACH_MUXMEASUREMENT, LTC_STATEMACH_MUXCONFIGURATION_INIT, LTC_STATEMACH_SHORTTIME);
+    } else {
+        /* end of the measurement cycle, start the next job */
+        LTC_StartNextJob();
+    }
+}
+
+
 
 /**
  * @brief   saves the voltage values read from the LTC daisy-chain.
@@ -2287,7 +2439,6 @@ static STD_RETURN_TYPE_e LTC_Init(void) {
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
     STD_RETURN_TYPE_e retVal = E_OK;
 
-    uint8_t PEC_Check[6];
     uint16_t PEC_result = 0;
     uint16_t i = 0;
 
@@ -2311,14 +2462,14 @@ static STD_RETURN_TYPE_e LTC_Init(void) {
     ltc_TXPECbuffer[3] = ltc_cmdWRCFG[3];
 
     for (i=0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = ltc_TXPECbuffer[4+i*8] = ltc_TXBuffer[0+i*6];
-        PEC_Check[1] = ltc_TXPECbuffer[5+i*8] = ltc_TXBuffer[1+i*6];
-        PEC_Check[2] = ltc_TXPECbuffer[6+i*8] = ltc_TXBuffer[2+i*6];
-        PEC_Check[3] = ltc_TXPECbuffer[7+i*8] = ltc_TXBuffer[3+i*6];
-        PEC_Check[4] = ltc_TXPECbuffer[8+i*8] = ltc_TXBuffer[4+i*6];
-        PEC_Check[5] = ltc_TXPECbuffer[9+i*8] = ltc_TXBuffer[5+i*6];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
+        ltc_TXPECbuffer[4+i*8] = ltc_TXBuffer[0+i*6];
+        ltc_TXPECbuffer[5+i*8] = ltc_TXBuffer[1+i*6];
+        ltc_TXPECbuffer[6+i*8] = ltc_TXBuffer[2+i*6];
+        ltc_TXPECbuffer[7+i*8] = ltc_TXBuffer[3+i*6];
+        ltc_TXPECbuffer[8+i*8] = ltc_TXBuffer[4+i*6];
+        ltc_TXPECbuffer[9+i*8] = ltc_TXBuffer[5+i*6];
+
+        PEC_result = LTC_pec15_calcFrame(&ltc_TXPECbuffer[4+i*8]);
         ltc_TXPECbuffer[10+i*8]=(uint8_t)((PEC_result>>8)&0xff);
         ltc_TXPECbuffer[11+i*8]=(uint8_t)(PEC_result&0xff);
     }  /* end for */
@@ -2509,6 +2660,36 @@ static uint16_t LTC_Get_MeasurementTCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHA
 }
 
 
+/**
+ * @brief   stores the time at which the ADC conversion that has just been started is finished
+ *
+ * Used by the pipelined measurement cycle, the conversion time depends on
+ * ltc_state.adcMode and ltc_state.adcMeasCh.
+ */
+static void LTC_StartConversionTimer(void) {
+    ltc_state.conversionEndTime = OS_getOSSysTick() + ltc_state.commandTransferTime +
+            LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh);
+}
+
+
+/**
+ * @brief   gets the remaining time of the ADC conversion started with LTC_StartConversionTimer()
+ *
+ * The time is taken from the OS tick, so it does not depend on the period
+ * with which LTC_Trigger() is called.
+ *
+ * @return  remaining conversion time in ms, 0 if the conversion is finished
+ */
+static uint16_t LTC_GetConversionTimeLeft(void) {
+    int32_t timeLeft = (int32_t)(ltc_state.conversionEndTime - OS_getOSSysTick());
+
+    if (timeLeft <= 0) {
+        return 0;
+    }
+    return (uint16_t)timeLeft;
+}
+
+
 /**
  * @brief   tells the LTC daisy-chain to start measuring the voltage on all cells.
  *
@@ -2623,35 +2804,132 @@ static STD_RETURN_TYPE_e LTC_StartGPIOMeasurement(LTC_ADCMODE_e adcMode, LTC_ADC
  *
  * @param   adcMode     LTC ADCmeasurement mode (fast, normal or filtered)
  * @param   PUP         pull-up bit for pull-up or pull-down current (0: pull-down, 1: pull-up)
+ * @param   cellGroup   0: all cells, n: only the cell group n (channel selection CH of the ADOW command)
  *
  * @return  retVal      E_OK if command was sent correctly by SPI, E_NOT_OK otherwise
  *
  */
-static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uint8_t PUP) {
+static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uint8_t PUP, uint8_t cellGroup) {
     STD_RETURN_TYPE_e retval = E_NOT_OK;
+    const uint8_t *command = NULL_PTR;
+    uint8_t groupCommand[4] = {0, 0, 0, 0};
+    uint16_t pec = 0;
+
     if (PUP == 0) {
         /* pull-down current */
         if (adcMode == LTC_ADCMODE_NORMAL_DCP0) {
-            retval = LTC_SendCmd(ltc2_BC_cmdADOW_PDOWN_normal_DCP0);
+            command = ltc2_BC_cmdADOW_PDOWN_normal_DCP0;
         } else if (adcMode == LTC_ADCMODE_FILTERED_DCP0) {
-            retval = LTC_SendCmd(ltc2_BC_cmdADOW_PDOWN_filtered_DCP0);
-        } else {
-            retval = E_NOT_OK;
+            command = ltc2_BC_cmdADOW_PDOWN_filtered_DCP0;
         }
     } else if (PUP == 1) {
         /* pull-up current */
         if (adcMode == LTC_ADCMODE_NORMAL_DCP0) {
-            retval = LTC_SendCmd(ltc2_BC_cmdADOW_PUP_normal_DCP0);
+            command = ltc2_BC_cmdADOW_PUP_normal_DCP0;
         } else if (adcMode == LTC_ADCMODE_FILTERED_DCP0) {
-            retval = LTC_SendCmd(ltc2_BC_cmdADOW_PUP_filtered_DCP0);
-        } else {
-            retval = E_NOT_OK;
+            command = ltc2_BC_cmdADOW_PUP_filtered_DCP0;
         }
     }
+
+    if (command == NULL_PTR) {
+        retval = E_NOT_OK;
+    } else if (cellGroup == 0) {
+        retval = LTC_SendCmd(command);
+    } else {
+        /* channel selection in the lowest bits of the command, the PEC has to be recalculated */
+        groupCommand[0] = command[0];
+        groupCommand[1] = command[1] | (cellGroup & 0x07);
+        pec = LTC_pec15_calc(2, groupCommand);
+        groupCommand[2] = (uint8_t)(pec >> 8);
+        groupCommand[3] = (uint8_t)(pec & 0xFF);
+        retval = LTC_SendCmd(groupCommand);
+    }
     return retval;
 }
 
 
+/**
+ * @brief   gets the cell group measured by the open-wire check.
+ *
+ * @return  0 for the complete open-wire check, the channel selection (1 to
+ *          LTC_OPENWIRE_NR_OF_CELL_GROUPS) of the current cell group for the
+ *          distributed open-wire check
+ */
+static uint8_t LTC_GetOpenWireCellGroup(void) {
+    uint8_t cellGroup = 0;
+
+    if (LTC_OPENWIRE_DISTRIBUTED == TRUE) {
+        cellGroup = ltc_openwire_cellGroup + 1;
+    }
+    return cellGroup;
+}
+
+
+/**
+ * @brief   evaluates the pull-up and pull-down measurements of the open-wire check.
+ *
+ * Open-wire at C0: cell_pup(0) == 0, open-wire at Cmax:
+ * cell_pdown(BS_NR_OF_BAT_CELLS_PER_MODULE-1) == 0, open-wire at C(N):
+ * cell_pup(N) - cell_pdown(N) < -400mV. Only the wires decided by the cells of
+ * the given cell group are evaluated.
+ *
+ * @param   cellGroup   0: all cells, n: cell group n (channel selection CH of the ADOW command)
+ */
+static void LTC_EvaluateOpenWire(uint8_t cellGroup) {
+    uint8_t cell = 0;
+    uint16_t i = 0;
+
+    for (uint8_t m = 0; m < BS_NR_OF_MODULES; m++) {
+        cell = 0;
+        for (uint8_t input = 0; input < BS_MAX_SUPPORTED_CELLS; input++) {
+            if (ltc_voltage_input_used[input] != 1) {
+                continue;
+            }
+            if (cellGroup == 0 || (input % LTC_OPENWIRE_NR_OF_CELL_GROUPS) == (cellGroup - 1)) {
+                i = cell + (m*BS_NR_OF_BAT_CELLS_PER_MODULE);
+                if (cell == 0) {
+                    LTC_AccumulateOpenWire(m*(BS_NR_OF_BAT_CELLS_PER_MODULE+1), (ltc_openwire_pup_buffer[i] == 0) ? TRUE : FALSE);
+                }
+                if (cell == (BS_NR_OF_BAT_CELLS_PER_MODULE-1)) {
+                    LTC_AccumulateOpenWire(BS_NR_OF_BAT_CELLS_PER_MODULE + m*(BS_NR_OF_BAT_CELLS_PER_MODULE+1), (ltc_openwire_pdown_buffer[i] == 0) ? TRUE : FALSE);
+                } else if (cell > 0) {
+                    ltc_openwire_delta[i] = (int32_t)(ltc_openwire_pup_buffer[i] - ltc_openwire_pdown_buffer[i]);
+                    LTC_AccumulateOpenWire(cell + m*(BS_NR_OF_BAT_CELLS_PER_MODULE+1), (ltc_openwire_delta[i] < -400) ? TRUE : FALSE);
+                }
+            }
+            cell++;
+        }
+    }
+}
+
+
+/**
+ * @brief   accumulates the result of the open-wire check of one wire.
+ *
+ * The distributed open-wire check sets a wire open after
+ * LTC_OPENWIRE_CONFIRMATIONS consecutive detections, the complete open-wire
+ * check at the first detection. An open wire stays set until the driver is
+ * reinitialized.
+ *
+ * @param   wire        index of the wire in DATA_BLOCK_OPENWIRE_s
+ * @param   detected    TRUE if the wire was detected open in this check
+ */
+static void LTC_AccumulateOpenWire(uint16_t wire, uint8_t detected) {
+    uint8_t confirmations = (LTC_OPENWIRE_DISTRIBUTED == TRUE) ? LTC_OPENWIRE_CONFIRMATIONS : 1;
+
+    if (detected == FALSE) {
+        ltc_openwire_evidence[wire] = 0;
+    } else {
+        if (ltc_openwire_evidence[wire] < UINT8_MAX) {
+            ltc_openwire_evidence[wire]++;
+        }
+        if (ltc_openwire_evidence[wire] >= confirmations) {
+            ltc_openwire.openwire[wire] = 1;
+        }
+    }
+}
+
+
 
 /**
  * @brief   checks if the data received from the daisy-chain is not corrupt.
@@ -2669,34 +2947,22 @@ static STD_RETURN_TYPE_e LTC_StartOpenWireMeasurement(LTC_ADCMODE_e adcMode, uin
 static STD_RETURN_TYPE_e LTC_RX_PECCheck(uint8_t *DataBufferSPI_RX_with_PEC) {
     uint16_t i = 0;
     STD_RETURN_TYPE_e retVal = E_OK;
-    uint8_t PEC_TX[2];
-    uint16_t PEC_result = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    uint32_t PEC_valid[LTC_PEC_MASK_WORDS(LTC_N_LTC)];
 
-    /* check all PECs and put data without command and PEC in DataBufferSPI_RX (easier to use) */
-    for (i=0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = DataBufferSPI_RX_with_PEC[4+i*8];
-        PEC_Check[1] = DataBufferSPI_RX_with_PEC[5+i*8];
-        PEC_Check[2] = DataBufferSPI_RX_with_PEC[6+i*8];
-        PEC_Check[3] = DataBufferSPI_RX_with_PEC[7+i*8];
-        PEC_Check[4] = DataBufferSPI_RX_with_PEC[8+i*8];
-        PEC_Check[5] = DataBufferSPI_RX_with_PEC[9+i*8];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
-        PEC_TX[0]=(uint8_t)((PEC_result>>8)&0xff);
-        PEC_TX[1]=(uint8_t)(PEC_result&0xff);
-
-        /* if calculated PEC not equal to received PEC */
-        if ((PEC_TX[0] != DataBufferSPI_RX_with_PEC[10+i*8]) || (PEC_TX[1] != DataBufferSPI_RX_with_PEC[11+i*8])) {
-            /* update error table of the corresponding LTC only if PEC check is activated */
-            if (LTC_DISCARD_PEC == FALSE) {
-                LTC_ErrorTable[i].PEC_valid = FALSE;
-            }
-            retVal = E_NOT_OK;
+    LTC_MergeChains(DataBufferSPI_RX_with_PEC);
 
-        } else {
+    /* check the PECs of the whole daisy-chain, the data of the first LTC starts after command and command PEC */
+    if (LTC_pec15_checkFrames(&DataBufferSPI_RX_with_PEC[4], LTC_N_LTC, PEC_valid) != 0) {
+        retVal = E_NOT_OK;
+    }
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        if ((PEC_valid[i/32] & ((uint32_t)1 << (i%32))) != 0) {
             /* update error table of the corresponding LTC */
             LTC_ErrorTable[i].PEC_valid = TRUE;
+        } else if (LTC_DISCARD_PEC == FALSE) {
+            /* update error table of the corresponding LTC only if PEC check is activated */
+            LTC_ErrorTable[i].PEC_valid = FALSE;
         }
     }
 
@@ -2780,7 +3046,6 @@ static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uin
     uint16_t i = 0;
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
     uint16_t PEC_result = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
     /*  DataBufferSPI_TX contains the data to send.
         The transmission function calculates the needed PEC.
@@ -2797,14 +3062,14 @@ static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uin
 
     /* Calculate PEC of all data (1 PEC value for 6 bytes) */
     for (i=0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = DataBufferSPI_TX_with_PEC[4+i*8] = DataBufferSPI_TX[0+i*6];
-        PEC_Check[1] = DataBufferSPI_TX_with_PEC[5+i*8] = DataBufferSPI_TX[1+i*6];
-        PEC_Check[2] = DataBufferSPI_TX_with_PEC[6+i*8] = DataBufferSPI_TX[2+i*6];
-        PEC_Check[3] = DataBufferSPI_TX_with_PEC[7+i*8] = DataBufferSPI_TX[3+i*6];
-        PEC_Check[4] = DataBufferSPI_TX_with_PEC[8+i*8] = DataBufferSPI_TX[4+i*6];
-        PEC_Check[5] = DataBufferSPI_TX_with_PEC[9+i*8] = DataBufferSPI_TX[5+i*6];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
+        DataBufferSPI_TX_with_PEC[4+i*8] = DataBufferSPI_TX[0+i*6];
+        DataBufferSPI_TX_with_PEC[5+i*8] = DataBufferSPI_TX[1+i*6];
+        DataBufferSPI_TX_with_PEC[6+i*8] = DataBufferSPI_TX[2+i*6];
+        DataBufferSPI_TX_with_PEC[7+i*8] = DataBufferSPI_TX[3+i*6];
+        DataBufferSPI_TX_with_PEC[8+i*8] = DataBufferSPI_TX[4+i*6];
+        DataBufferSPI_TX_with_PEC[9+i*8] = DataBufferSPI_TX[5+i*6];
+
+        PEC_result = LTC_pec15_calcFrame(&DataBufferSPI_TX_with_PEC[4+i*8]);
         DataBufferSPI_TX_with_PEC[10+i*8]=(uint8_t)((PEC_result>>8)&0xff);
         DataBufferSPI_TX_with_PEC[11+i*8]=(uint8_t)(PEC_result&0xff);
     }
@@ -2818,6 +3083,134 @@ static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uin
     }
 }
 
+/**
+ * @brief   sends the same frame to all daisy-chains.
+ *
+ * Used for commands, the wake-up byte and the I2C clocks. The daisy-chains
+ * are served one after the other: SPI_Transmit() waits for the wake-up of the
+ * isoSPI before it starts the DMA, so only the DMA transfers of the
+ * daisy-chains overlap. The SPI transmission is ongoing until all are finished.
+ *
+ * @param   *txbuf      frame to be sent
+ * @param   size        size of the frame
+ *
+ * @return              E_OK if all SPI transmissions are OK, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_TransmitAllChains(uint8_t *txbuf, uint16_t size) {
+    STD_RETURN_TYPE_e retVal = E_OK;
+    uint8_t chain = 0;
+
+    for (chain=0; chain < LTC_N_CHAINS; chain++) {
+        if (LTC_ChainTransmit(chain, txbuf, size) != E_OK) {
+            retVal = E_NOT_OK;
+        }
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   sends a command with data to all daisy-chains.
+ *
+ * DataBufferSPI_TX_with_PEC contains the data of all LTC_N_LTC LTCs in the
+ * order of the write commands: the data of the last module first. The last
+ * daisy-chain gets the first LTC_N_LTC_PER_CHAIN data slots, which directly
+ * follow the command, the data slots of the other daisy-chains are copied
+ * behind a copy of the command.
+ *
+ * @param   *DataBufferSPI_TX_with_PEC  command and data of all LTCs with PEC
+ *
+ * @return                              E_OK if all SPI transmissions are OK, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_TransmitDataAllChains(uint8_t *DataBufferSPI_TX_with_PEC) {
+    STD_RETURN_TYPE_e retVal = E_OK;
+    uint8_t *frame = DataBufferSPI_TX_with_PEC;
+    uint8_t chain = 0;
+#if LTC_N_CHAINS > 1
+    uint16_t i = 0;
+    uint16_t offset = 0;
+#endif
+
+    for (chain=0; chain < LTC_N_CHAINS; chain++) {
+#if LTC_N_CHAINS > 1
+        if (chain < LTC_N_CHAINS-1) {
+            frame = ltc_chainTXPECbuffer[chain];
+            offset = 8*(LTC_N_CHAINS-1-chain)*LTC_N_LTC_PER_CHAIN;
+            for (i=0; i < 4; i++) {
+                frame[i] = DataBufferSPI_TX_with_PEC[i];
+            }
+            for (i=4; i < LTC_N_BYTES_FOR_CHAIN_TRANSMISSION; i++) {
+                frame[i] = DataBufferSPI_TX_with_PEC[offset+i];
+            }
+        } else {
+            frame = DataBufferSPI_TX_with_PEC;
+        }
+#endif
+        if (LTC_ChainTransmit(chain, frame, LTC_N_BYTES_FOR_CHAIN_TRANSMISSION) != E_OK) {
+            retVal = E_NOT_OK;
+        }
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   sends a read command to all daisy-chains and receives their data.
+ *
+ * The first daisy-chain receives in place, the other daisy-chains in
+ * separate buffers. The data is copied to DataBufferSPI_RX_with_PEC with
+ * LTC_MergeChains() when the transmission is finished.
+ *
+ * @param   *txbuf                      command, followed by the bytes sent while receiving
+ * @param   *DataBufferSPI_RX_with_PEC  data received from all LTCs
+ *
+ * @return                              E_OK if all SPI transmissions are OK, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_ReceiveDataAllChains(uint8_t *txbuf, uint8_t *DataBufferSPI_RX_with_PEC) {
+    STD_RETURN_TYPE_e retVal = E_OK;
+    uint8_t *frame = DataBufferSPI_RX_with_PEC;
+    uint8_t chain = 0;
+
+    for (chain=0; chain < LTC_N_CHAINS; chain++) {
+#if LTC_N_CHAINS > 1
+        if (chain > 0) {
+            frame = ltc_chainRXPECbuffer[chain-1];
+        }
+#endif
+        if (LTC_ChainTransmitReceive(chain, txbuf, frame, LTC_N_BYTES_FOR_CHAIN_TRANSMISSION) != E_OK) {
+            retVal = E_NOT_OK;
+        }
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   copies the data received from the daisy-chains 1 to LTC_N_CHAINS-1
+ *          behind the data of the first daisy-chain.
+ *
+ * Afterwards, the data of module i is at 4+8*i as with a single daisy-chain.
+ *
+ * @param   *DataBufferSPI_RX_with_PEC  data received with LTC_ReceiveDataAllChains()
+ */
+static void LTC_MergeChains(uint8_t *DataBufferSPI_RX_with_PEC) {
+#if LTC_N_CHAINS > 1
+    uint16_t i = 0;
+    uint16_t offset = 0;
+    uint8_t chain = 0;
+
+    for (chain=1; chain < LTC_N_CHAINS; chain++) {
+        offset = 8*chain*LTC_N_LTC_PER_CHAIN;
+        for (i=4; i < LTC_N_BYTES_FOR_CHAIN_TRANSMISSION; i++) {
+            DataBufferSPI_RX_with_PEC[offset+i] = ltc_chainRXPECbuffer[chain-1][i];
+        }
+    }
+#else
+    /* a single daisy-chain is received completely in DataBufferSPI_RX_with_PEC */
+    (void)DataBufferSPI_RX_with_PEC;
+#endif
+}
+
 /**
  * @brief   configures the data that will be sent to the LTC daisy-chain to configure multiplexer channels.
  *
@@ -3442,7 +3835,7 @@ static void LTC_SetTransferTimes(void) {
     /* Transmission of a command and data */
     /* Multiplication by 1000*1000 to get us */
     transferTime_us = (8*1000*1000)/(SPI_Clock);
-    transferTime_us *= LTC_N_BYTES_FOR_DATA_TRANSMISSION;
+    transferTime_us *= LTC_N_BYTES_FOR_CHAIN_TRANSMISSION;
     transferTime_us = transferTime_us + SPI_WAKEUP_WAIT_TIME;
     ltc_state.commandDataTransferTime = (transferTime_us/1000)+1;
 
@@ -3489,6 +3882,361 @@ static LTC_RETURN_TYPE_e LTC_CheckStateRequest(LTC_STATE_REQUEST_e statereq) {
     }
 }
 
+/**
+ * @brief   gets the scheduler job that executes a state request.
+ *
+ * @param   statereq    state request
+ *
+ * @return  job of the state request, LTC_JOB_NONE if the request is executed directly by the state machine
+ */
+static LTC_JOB_e LTC_GetJobOfRequest(LTC_STATE_REQUEST_e statereq) {
+    LTC_JOB_e job = LTC_JOB_NONE;
+
+    if (statereq == LTC_STATE_USER_IO_WRITE_REQUEST || statereq == LTC_STATE_USER_IO_READ_REQUEST ||
+            statereq == LTC_STATE_USER_IO_WRITE_REQUEST_TI || statereq == LTC_STATE_USER_IO_READ_REQUEST_TI) {
+        job = LTC_JOB_USER_IO;
+    } else if (statereq == LTC_STATE_EEPROM_READ_REQUEST || statereq == LTC_STATE_EEPROM_WRITE_REQUEST) {
+        job = LTC_JOB_EEPROM;
+    } else if (statereq == LTC_STATE_TEMP_SENS_READ_REQUEST) {
+        job = LTC_JOB_TEMP_SENS;
+    } else if (statereq == LTC_STATE_BALANCEFEEDBACK_REQUEST) {
+        job = LTC_JOB_BALANCEFEEDBACK;
+    } else if (statereq == LTC_STATE_OPENWIRE_CHECK_REQUEST) {
+        job = LTC_JOB_OPENWIRE_CHECK;
+    }
+
+    return job;
+}
+
+/**
+ * @brief   marks a job as requested.
+ *
+ * Must be called in a critical section. Each job holds one request, a second
+ * request is rejected until the job was started.
+ *
+ * @param   job         requested job
+ * @param   statereq    state request that is executed by the job
+ *
+ * @return  LTC_OK if the request was accepted, LTC_REQUEST_PENDING otherwise
+ */
+static LTC_RETURN_TYPE_e LTC_SetJobRequest(LTC_JOB_e job, LTC_STATE_REQUEST_e statereq) {
+    if (ltc_job_state[job].pending == TRUE) {
+        return LTC_REQUEST_PENDING;
+    }
+
+    ltc_job_state[job].pending = TRUE;
+    ltc_job_state[job].request = statereq;
+    ltc_job_state[job].dueTime = OS_getOSSysTick();
+
+    return LTC_OK;
+}
+
+/**
+ * @brief   records the start of a job in the job statistics.
+ *
+ * The latency is the time from the moment the job became due until its start.
+ * For the cell voltages and the multiplexer sequence, which are measured in
+ * every cycle, the job is due one period after its last start. A latency
+ * longer than the deadline is reported to the diagnosis module with the job
+ * as item number.
+ *
+ * @param   job         started job
+ * @param   timestamp   current time in ms
+ */
+static void LTC_RecordJobStart(LTC_JOB_e job, uint32_t timestamp) {
+    LTC_JOB_STATE_s *jobState = &ltc_job_state[job];
+    LTC_JOB_STATISTICS_s *statistics = &ltc_job_statistics[job];
+    uint32_t period = timestamp - jobState->lastStart;
+    uint32_t latency = 0;
+
+    if (job == LTC_JOB_VOLTAGE || job == LTC_JOB_MUX_SEQUENCE) {
+        jobState->dueTime = (statistics->starts > 0) ?
+                (jobState->lastStart + ((job == LTC_JOB_VOLTAGE) ? LTC_GetVoltagePeriod() : ltc_job_cfg[job].period_ms)) : timestamp;
+    }
+    if ((int32_t)(timestamp - jobState->dueTime) > 0) {
+        latency = timestamp - jobState->dueTime;
+    }
+
+    if (statistics->starts > 0) {
+        statistics->lastPeriod_ms = period;
+        if (period > statistics->maxPeriod_ms) {
+            statistics->maxPeriod_ms = period;
+        }
+    }
+    if (latency > statistics->maxLatency_ms) {
+        statistics->maxLatency_ms = latency;
+    }
+    if (latency > ltc_job_cfg[job].deadline_ms) {
+        statistics->deadlineMisses++;
+        DIAG_Handler(DIAG_CH_LTC_JOB_DEADLINE, DIAG_EVENT_NOK, job);
+    } else {
+        DIAG_Handler(DIAG_CH_LTC_JOB_DEADLINE, DIAG_EVENT_OK, job);
+    }
+    statistics->starts++;
+    jobState->lastStart = timestamp;
+}
+
+/**
+ * @brief   measures the duration of the slice started in the last measurement cycle.
+ *
+ * The estimated slice time of the job is raised to the longest measured
+ * duration, so that the scheduler does not start a slice that does not fit
+ * again.
+ *
+ * @param   timestamp   current time in ms
+ */
+static void LTC_FinishJobSlice(uint32_t timestamp) {
+    uint32_t duration = 0;
+    LTC_JOB_e job = ltc_state.activeJob;
+
+    if (job == LTC_JOB_NONE) {
+        return;
+    }
+
+    duration = timestamp - ltc_state.jobStartTime;
+    if (duration > 0xFFFF) {
+        duration = 0xFFFF;
+    }
+    if (duration > ltc_job_statistics[job].maxSliceTime_ms) {
+        ltc_job_statistics[job].maxSliceTime_ms = duration;
+    }
+    if (duration > ltc_job_state[job].sliceTime_ms) {
+        ltc_job_state[job].sliceTime_ms = duration;
+    }
+    ltc_state.activeJob = LTC_JOB_NONE;
+}
+
+/**
+ * @brief   starts the next job at the end of a measurement cycle.
+ *
+ * Periodic jobs become due when their period has elapsed, the other jobs when
+ * they are requested. A due job is started if its slice still fits into the
+ * target period of the cell voltages (ltc_job_cfg[LTC_JOB_VOLTAGE]). A job
+ * that is later than its deadline may also use the deadline of the cell
+ * voltages, whose target period is extended by the longer conversion time of
+ * an adaptively selected ADC mode. Late jobs are preferred, then the job with the highest priority,
+ * then the job that has been due for the longest time.
+ *
+ * A slice that would not even fit into the shortest measurement cycle seen so
+ * far is started as soon as its job is late, the missed cell voltage deadline
+ * is reported. The job table must be configured so that this does not happen.
+ *
+ * If no job is started, the next cell voltage measurement is started
+ * immediately.
+ */
+static void LTC_StartNextJob(void) {
+    uint32_t timestamp = OS_getOSSysTick();
+    uint32_t elapsed = timestamp - ltc_job_state[LTC_JOB_VOLTAGE].lastStart;
+    uint32_t targetPeriod = LTC_GetVoltagePeriod();
+    uint32_t maxPeriod = targetPeriod + ltc_job_cfg[LTC_JOB_VOLTAGE].deadline_ms;
+    LTC_JOB_e next = LTC_JOB_NONE;
+    uint8_t nextLate = FALSE;
+    uint8_t late = FALSE;
+    uint8_t slice = 0;
+    LTC_STATE_REQUEST_e request = LTC_STATE_NO_REQUEST;
+
+    if (elapsed < ltc_job_minCycleTime) {
+        ltc_job_minCycleTime = elapsed;
+    }
+
+    OS_TaskEnter_Critical();
+    /* cell voltages and multiplexer sequence are measured in every cycle and not scheduled */
+    for (uint8_t j = LTC_JOB_BALANCECONTROL; j < LTC_JOB_NR_OF_JOBS; j++) {
+        LTC_JOB_STATE_s *jobState = &ltc_job_state[j];
+
+        if (jobState->pending == FALSE && ltc_job_cfg[j].period_ms > 0) {
+            if (ltc_job_statistics[j].starts == 0) {
+                jobState->pending = TRUE;
+                jobState->dueTime = timestamp;
+            } else if ((timestamp - jobState->lastStart) >= ltc_job_cfg[j].period_ms) {
+                jobState->pending = TRUE;
+                jobState->dueTime = jobState->lastStart + ltc_job_cfg[j].period_ms;
+            }
+        }
+        if (jobState->pending == FALSE) {
+            continue;
+        }
+
+        late = ((timestamp - jobState->dueTime) > ltc_job_cfg[j].deadline_ms) ? TRUE : FALSE;
+        if ((elapsed + jobState->sliceTime_ms) > (late == TRUE ? maxPeriod : targetPeriod)) {
+            /* slice does not fit into this cycle */
+            if (late == FALSE || (ltc_job_minCycleTime + jobState->sliceTime_ms) <= maxPeriod) {
+                continue;
+            }
+        }
+
+        if (next == LTC_JOB_NONE ||
+                (late == TRUE && nextLate == FALSE) ||
+                (late == nextLate && ltc_job_cfg[j].priority < ltc_job_cfg[next].priority) ||
+                (late == nextLate && ltc_job_cfg[j].priority == ltc_job_cfg[next].priority &&
+                        (int32_t)(jobState->dueTime - ltc_job_state[next].dueTime) < 0)) {
+            next = j;
+            nextLate = late;
+        }
+    }
+
+    if (next != LTC_JOB_NONE) {
+        slice = ltc_job_state[next].slice;
+        request = ltc_job_state[next].request;
+        if (next != LTC_JOB_OPENWIRE_CHECK) {
+            /* one slice, the request is completed with the start (a failed job is not repeated) */
+            ltc_job_state[next].pending = FALSE;
+        }
+    }
+    OS_TaskExit_Critical();
+
+    if (next == LTC_JOB_NONE) {
+        LTC_StateTransition(LTC_STATEMACH_STARTMEAS, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
+        return;
+    }
+
+    if (slice == 0) {
+        LTC_RecordJobStart(next, timestamp);
+    }
+    ltc_state.activeJob = next;
+    ltc_state.jobStartTime = timestamp;
+
+    if (next == LTC_JOB_BALANCECONTROL) {
+        LTC_StateTransition(LTC_STATEMACH_BALANCECONTROL, LTC_CONFIG_BALANCECONTROL, LTC_STATEMACH_SHORTTIME);
+    } else if (next == LTC_JOB_BALANCEFEEDBACK) {
+        LTC_StateTransition(LTC_STATEMACH_BALANCEFEEDBACK, LTC_ENTRY, LTC_STATEMACH_SHORTTIME);
+    } else if (next == LTC_JOB_TEMP_SENS) {
+        LTC_StateTransition(LTC_STATEMACH_TEMP_SENS_READ, LTC_TEMP_SENS_SEND_DATA1, LTC_STATEMACH_SHORTTIME);
+    } else if (next == LTC_JOB_USER_IO) {
+        if (request == LTC_STATE_USER_IO_WRITE_REQUEST) {
+            LTC_StateTransition(LTC_STATEMACH_USER_IO_CONTROL, LTC_USER_IO_SET_OUTPUT_REGISTER, LTC_STATEMACH_SHORTTIME);
+        } else if (request == LTC_STATE_USER_IO_READ_REQUEST) {
+            LTC_StateTransition(LTC_STATEMACH_USER_IO_FEEDBACK, LTC_USER_IO_READ_INPUT_REGISTER, LTC_STATEMACH_SHORTTIME);
+        } else if (request == LTC_STATE_USER_IO_WRITE_REQUEST_TI) {
+            LTC_StateTransition(LTC_STATEMACH_USER_IO_CONTROL_TI, LTC_USER_IO_SET_DIRECTION_REGISTER_TI, LTC_STATEMACH_SHORTTIME);
+        } else {
+            LTC_StateTransition(LTC_STATEMACH_USER_IO_FEEDBACK_TI, LTC_USER_IO_SET_DIRECTION_REGISTER_TI, LTC_STATEMACH_SHORTTIME);
+        }
+    } else if (next == LTC_JOB_EEPROM) {
+        if (request == LTC_STATE_EEPROM_WRITE_REQUEST) {
+            LTC_StateTransition(LTC_STATEMACH_EEPROM_WRITE, LTC_EEPROM_WRITE_DATA1, LTC_STATEMACH_SHORTTIME);
+        } else {
+            LTC_StateTransition(LTC_STATEMACH_EEPROM_READ, LTC_EEPROM_READ_DATA1, LTC_STATEMACH_SHORTTIME);
+        }
+    } else if (next == LTC_JOB_OPENWIRE_CHECK) {
+        /* Send ADOW command two times, with pull-up current in the first slice, with pull-down current in the second */
+        ltc_state.resendCommandCounter = LTC_NMBR_REQ_ADOW_COMMANDS;
+        if (slice == 0) {
+            LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLUP_CURRENT_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
+        } else {
+            LTC_StateTransition(LTC_STATEMACH_OPENWIRE_CHECK, LTC_REQUEST_PULLDOWN_CURRENT_OPENWIRE_CHECK, LTC_STATEMACH_SHORTTIME);
+        }
+    }
+}
+
+/**
+ * @brief   gets the target period of the cell voltage measurement.
+ *
+ * If the adaptive ADC mode selection uses a mode with a longer conversion time
+ * than LTC_VOLTAGE_MEASUREMENT_MODE, the configured period of
+ * ltc_job_cfg[LTC_JOB_VOLTAGE] is extended by the difference.
+ *
+ * @return  target period in ms
+ */
+static uint32_t LTC_GetVoltagePeriod(void) {
+    uint32_t period = ltc_job_cfg[LTC_JOB_VOLTAGE].period_ms;
+    uint16_t tCycle = LTC_Get_MeasurementTCycle(ltc_adcmode_policy.voltageMode, LTC_ADCMEAS_ALLCHANNEL);
+    uint16_t tCycleConfigured = LTC_Get_MeasurementTCycle(LTC_VOLTAGE_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL);
+
+    if (tCycle > tCycleConfigured) {
+        period += tCycle - tCycleConfigured;
+    }
+    return period;
+}
+
+/**
+ * @brief   selects the ADC mode of the next cell voltage measurement from the current measurement.
+ *
+ * The change of current is calculated from the two last current samples. A
+ * high change of current selects the fast mode immediately, it is kept for
+ * LTC_ADAPTIVE_FAST_HOLD_TIME_ms. The filtered mode is only selected after the
+ * battery has been at rest for LTC_ADAPTIVE_REST_TIME_ms and is left with the
+ * first sample out of rest. If the current measurement is invalid or older than
+ * LTC_ADAPTIVE_CURRENT_TIMEOUT_ms, LTC_VOLTAGE_MEASUREMENT_MODE is used.
+ *
+ * @param   timestamp   current time in ms
+ *
+ * @return  ADC mode of the next cell voltage measurement
+ */
+static LTC_ADCMODE_e LTC_SelectVoltageADCMode(uint32_t timestamp) {
+    LTC_ADCMODE_POLICY_s *policy = &ltc_adcmode_policy;
+    LTC_ADCMODE_e mode = LTC_VOLTAGE_MEASUREMENT_MODE;
+    uint32_t dt = 0;
+    uint32_t dIdt = 0;
+    int32_t current = 0;
+
+    DB_ReadBlock(&ltc_current_sensor, DATA_BLOCK_ID_CURRENT_SENSOR);
+
+    if (ltc_current_sensor.state_current != 0 ||
+            (timestamp - ltc_current_sensor.timestamp_cur) > LTC_ADAPTIVE_CURRENT_TIMEOUT_ms) {
+        /* no valid current measurement, the decision starts again with the next valid samples */
+        policy->lastCurrentTime = 0;
+        policy->atRest = FALSE;
+        policy->fastModeUntil = timestamp;
+        return LTC_VOLTAGE_MEASUREMENT_MODE;
+    }
+
+    current = ltc_current_sensor.current;
+    if (ltc_current_sensor.timestamp_cur != policy->lastCurrentTime) {
+        /* new current sample */
+        if (policy->lastCurrentTime != 0) {
+            dt = ltc_current_sensor.timestamp_cur - policy->lastCurrentTime;
+            dIdt = (uint32_t)abs(current - policy->lastCurrent_mA);
+            dIdt = (dt > 0) ? ((dIdt * 1000) / dt) : 0;
+
+            if (dIdt >= LTC_ADAPTIVE_FAST_DIDT_mA_per_s) {
+                policy->fastModeUntil = timestamp + LTC_ADAPTIVE_FAST_HOLD_TIME_ms;
+            }
+            if (abs(current) <= LTC_ADAPTIVE_REST_CURRENT_mA && dIdt <= LTC_ADAPTIVE_REST_DIDT_mA_per_s) {
+                if (policy->atRest == FALSE) {
+                    policy->atRest = TRUE;
+                    policy->restSince = timestamp;
+                }
+            } else {
+                policy->atRest = FALSE;
+            }
+        }
+        policy->lastCurrent_mA = current;
+        policy->lastCurrentTime = ltc_current_sensor.timestamp_cur;
+    }
+
+    if ((int32_t)(policy->fastModeUntil - timestamp) > 0) {
+        mode = LTC_ADCMODE_FAST_DCP0;
+    } else if (policy->atRest == TRUE && (timestamp - policy->restSince) >= LTC_ADAPTIVE_REST_TIME_ms) {
+        mode = LTC_ADCMODE_FILTERED_DCP0;
+    }
+
+    return mode;
+}
+
+void LTC_GetJobStatistics(LTC_JOB_STATISTICS_s *statistics) {
+    OS_TaskEnter_Critical();
+    for (uint8_t j = 0; j < LTC_JOB_NR_OF_JOBS; j++) {
+        statistics[j] = ltc_job_statistics[j];
+    }
+    OS_TaskExit_Critical();
+}
+
+void LTC_ResetJobStatistics(void) {
+    OS_TaskEnter_Critical();
+    for (uint8_t j = 0; j < LTC_JOB_NR_OF_JOBS; j++) {
+        ltc_job_statistics[j].starts = 0;
+        ltc_job_statistics[j].lastPeriod_ms = 0;
+        ltc_job_statistics[j].maxPeriod_ms = 0;
+        ltc_job_statistics[j].maxLatency_ms = 0;
+        ltc_job_statistics[j].deadlineMisses = 0;
+        ltc_job_statistics[j].maxSliceTime_ms = 0;
+        ltc_job_state[j].sliceTime_ms = ltc_job_cfg[j].sliceTime_ms;
+    }
+    ltc_job_minCycleTime = 0xFFFFFFFF;
+    OS_TaskExit_Critical();
+}
+
 static STD_RETURN_TYPE_e LTC_TimerElapsedAndSPITransmitOngoing(uint16_t timer) {
     STD_RETURN_TYPE_e retVal = E_NOT_OK;
     if (timer == 0 && SPI_IsTransmitOngoing() == TRUE) {
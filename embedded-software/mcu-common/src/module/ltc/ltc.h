@@ -90,7 +90,8 @@ extern void LTC_Trigger(void);
  * This function is used to make a state request to the state machine,e.g, start voltage measurement,
  * read result of voltage measurement, re-initialization
  * It calls LTC_CheckStateRequest() to check if the request is valid.
- * The state request is rejected if is not valid.
+ * The state request is rejected if is not valid. Requests executed by a job of the
+ * measurement scheduler are also rejected while the state machine is uninitialized.
  * The result of the check is returned immediately, so that the requester can act in case
  * it made a non-valid state request.
  *
@@ -114,6 +115,18 @@ extern void LTC_SaveAllGPIOMeasurement(void);
 extern LTC_STATE_REQUEST_e LTC_GetStateRequest(void);
 extern LTC_STATEMACH_e LTC_GetState(void);
 
+/**
+ * @brief   copies the achieved timing of the measurement scheduler jobs.
+ *
+ * @param   statistics  array of LTC_JOB_NR_OF_JOBS entries, indexed by LTC_JOB_e
+ */
+extern void LTC_GetJobStatistics(LTC_JOB_STATISTICS_s *statistics);
+
+/**
+ * @brief   clears the job statistics and the measured slice times.
+ */
+extern void LTC_ResetJobStatistics(void);
+
 /*================== Function Implementations =============================*/
 
 #endif /* LTC_H_ */
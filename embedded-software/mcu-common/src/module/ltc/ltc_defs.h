@@ -216,6 +216,7 @@ typedef enum {
     LTC_STATEMACH_MUXMEASUREMENT_CONFIG = 9,    /*!< Configuration of the multiplexers              */
     LTC_STATEMACH_READMUXMEASUREMENT    = 11,   /*!<    */
     LTC_STATEMACH_STOREMUXMEASUREMENT   = 12,   /*!<    */
+    LTC_STATEMACH_MUXCONFIGURATION_NEXT = 13,   /*!< Selection of a further multiplexer channel for the same conversion (batched measurement) */
 } LTC_STATEMACH_BALANCECONTROL_SUB;
 
 /**
@@ -446,6 +447,72 @@ typedef struct {
     LTC_MUX_CH_CFG_s *seqptr;   /*!< pointer to the multiplexer sequence   */
 } LTC_MUX_SEQUENZ_s;
 
+/**
+ * Jobs of the measurement scheduler, see ltc_job_cfg[]
+ *
+ * Cell voltages and the multiplexer sequence are measured in every cycle,
+ * their entries are only monitored. The other jobs are started by the
+ * scheduler at the end of a measurement cycle.
+ */
+typedef enum {
+    LTC_JOB_VOLTAGE             = 0,    /*!< cell voltage measurement                           */
+    LTC_JOB_MUX_SEQUENCE        = 1,    /*!< complete multiplexer sequence (temperatures)       */
+    LTC_JOB_BALANCECONTROL      = 2,    /*!< write of the balancing configuration               */
+    LTC_JOB_BALANCEFEEDBACK     = 3,    /*!< balancing feedback measurement                     */
+    LTC_JOB_TEMP_SENS           = 4,    /*!< external temperature sensor                        */
+    LTC_JOB_USER_IO             = 5,    /*!< user port expander                                 */
+    LTC_JOB_EEPROM              = 6,    /*!< external EEPROM read or write                      */
+    LTC_JOB_OPENWIRE_CHECK      = 7,    /*!< open-wire check, pull-up and pull-down slice       */
+    LTC_JOB_NR_OF_JOBS          = 8,    /*!< number of jobs                                     */
+    LTC_JOB_NONE                = 0xFF, /*!< no job started                                     */
+} LTC_JOB_e;
+
+/**
+ * Scheduling parameters of a job
+ */
+typedef struct {
+    uint8_t priority;           /*!< 0 is the highest priority                                                      */
+    uint32_t period_ms;         /*!< target period, 0: job is only started on request                               */
+    uint32_t deadline_ms;       /*!< maximum time from due (or request) until start                                 */
+    uint16_t sliceTime_ms;      /*!< initial estimate of the duration of one slice, replaced by the measured maximum */
+} LTC_JOB_CFG_s;
+
+/**
+ * Achieved timing of a job, see LTC_GetJobStatistics()
+ */
+typedef struct {
+    uint32_t starts;            /*!< number of started jobs (first slice)           */
+    uint32_t lastPeriod_ms;     /*!< time between the last two starts               */
+    uint32_t maxPeriod_ms;      /*!< longest time between two starts                */
+    uint32_t maxLatency_ms;     /*!< longest time from due (or request) until start */
+    uint32_t deadlineMisses;    /*!< number of starts later than the deadline       */
+    uint16_t maxSliceTime_ms;   /*!< longest measured duration of one slice         */
+} LTC_JOB_STATISTICS_s;
+
+/**
+ * Scheduling state of a job
+ */
+typedef struct {
+    uint8_t pending;                /*!< TRUE if the job is due (period elapsed or requested)   */
+    LTC_STATE_REQUEST_e request;    /*!< state request of a job started on request              */
+    uint32_t dueTime;               /*!< time stamp at which the job became due                 */
+    uint32_t lastStart;             /*!< time stamp of the last start (first slice)             */
+    uint8_t slice;                  /*!< next slice of a job split into several slices          */
+    uint16_t sliceTime_ms;          /*!< estimated duration of one slice                        */
+} LTC_JOB_STATE_s;
+
+/**
+ * State of the adaptive selection of the cell voltage ADC mode
+ */
+typedef struct {
+    LTC_ADCMODE_e voltageMode;      /*!< ADC mode of the cell voltage measurement                  */
+    int32_t lastCurrent_mA;         /*!< last current sample evaluated                             */
+    uint32_t lastCurrentTime;       /*!< time stamp of the last current sample evaluated           */
+    uint32_t fastModeUntil;         /*!< time stamp until which the fast mode is kept              */
+    uint32_t restSince;             /*!< time stamp since which the battery is at rest             */
+    uint8_t atRest;                 /*!< TRUE if current and current change are below the limits  */
+} LTC_ADCMODE_POLICY_s;
+
 /**
  * This struct contains pointer to used data buffers
  */
@@ -555,6 +622,8 @@ typedef struct {
     LTC_MUX_CH_CFG_s *muxmeas_seqptr;         /*!< pointer to the multiplexer sequence to be measured (contains a list of elements [multiplexer id, multiplexer channels]) (1,-1)...(3,-1),(0,1),...(0,7) */
     LTC_MUX_CH_CFG_s *muxmeas_seqendptr;      /*!< point to the end of the multiplexer sequence; pointer to ending point of sequence */
     uint8_t muxmeas_nr_end;                   /*!< number of multiplexer channels that have to be measured; end number of sequence, where measurement is finished*/
+    LTC_MUX_CH_CFG_s *muxmeas_selectptr;      /*!< last step of the sequence selected for the current conversion (several steps in batched measurement) */
+    uint8_t muxStepsInCycle;                  /*!< number of steps of the multiplexer sequence measured in the current measurement cycle */
     SPI_HandleType_s *spiHandle;              /*!< pointer to SPI Handle the LTC is connected to                                               */
     LTC_DATAPTR_s ltcData;                    /*!< contains pointer to the local data buffer                                                   */
     uint8_t instanceID;                       /*!< number to distinguish between different ltc states, starting with 0,1,2,3....8              */
@@ -570,8 +639,12 @@ typedef struct {
     uint8_t first_measurement_made;           /*!< flag that indicates if the first measurement cycle was completed                            */
     STD_RETURN_TYPE_e ltc_muxcycle_finished;  /*!< flag that indictes if the measurement sequence of the multiplexers is finished              */
     STD_RETURN_TYPE_e check_spi_flag;         /*!< indicates if interrupt flag or timer must be considered */
-    STD_RETURN_TYPE_e balance_control_done;   /*!< indicates if balance control was done */
+    LTC_JOB_e activeJob;                      /*!< job started by the scheduler in the current measurement cycle */
+    uint32_t jobStartTime;                    /*!< time stamp at which the active job was started                */
     uint8_t resendCommandCounter;             /*!< counter if commandy should be send multiple times e.g. ADOW command */
+    uint32_t conversionEndTime;               /*!< OS time in ms at which the last started ADC conversion is finished (pipelined measurement cycle) */
+    uint8_t muxConversionPending;             /*!< TRUE if a multiplexer input is converted while the cell voltages are read (pipelined measurement cycle) */
+    uint8_t voltageReadPending;               /*!< TRUE until the cell voltages of the pipelined measurement cycle are read */
 } LTC_STATE_s;
 
 /*================== Function Prototypes ==================================*/
@@ -69,8 +69,156 @@ Copyright 2013 Linear Technology Corp. (LTC)
 
 /*================== Constant and Variable Definitions ====================*/
 
+/**
+ * Slicing tables for the CRC15 (polynomial 0x4599), 4 bytes are processed per step.
+ * Entry a of table k holds a * x^(15+8*(3-k)) mod P, i.e., the contribution of
+ * byte k (MSB first) of the 32 bit word. The last table equals crc15Table reduced
+ * to 15 bits, the others are derived from their successor with
+ * T(k-1)[a] = ((T(k)[a] << 8) & 0x7FFF) ^ T(3)[(T(k)[a] >> 7) & 0xFF].
+ */
+static const uint16_t ltc_pec15SliceTable[4][256] = {
+    {   /* a * x^39 mod P */
+        0x0000, 0x1EF8, 0x3DF0, 0x2308, 0x7BE0, 0x6518, 0x4610, 0x58E8,
+        0x3259, 0x2CA1, 0x0FA9, 0x1151, 0x49B9, 0x5741, 0x7449, 0x6AB1,
+        0x64B2, 0x7A4A, 0x5942, 0x47BA, 0x1F52, 0x01AA, 0x22A2, 0x3C5A,
+        0x56EB, 0x4813, 0x6B1B, 0x75E3, 0x2D0B, 0x33F3, 0x10FB, 0x0E03,
+        0x0CFD, 0x1205, 0x310D, 0x2FF5, 0x771D, 0x69E5, 0x4AED, 0x5415,
+        0x3EA4, 0x205C, 0x0354, 0x1DAC, 0x4544, 0x5BBC, 0x78B4, 0x664C,
+        0x684F, 0x76B7, 0x55BF, 0x4B47, 0x13AF, 0x0D57, 0x2E5F, 0x30A7,
+        0x5A16, 0x44EE, 0x67E6, 0x791E, 0x21F6, 0x3F0E, 0x1C06, 0x02FE,
+        0x19FA, 0x0702, 0x240A, 0x3AF2, 0x621A, 0x7CE2, 0x5FEA, 0x4112,
+        0x2BA3, 0x355B, 0x1653, 0x08AB, 0x5043, 0x4EBB, 0x6DB3, 0x734B,
+        0x7D48, 0x63B0, 0x40B8, 0x5E40, 0x06A8, 0x1850, 0x3B58, 0x25A0,
+        0x4F11, 0x51E9, 0x72E1, 0x6C19, 0x34F1, 0x2A09, 0x0901, 0x17F9,
+        0x1507, 0x0BFF, 0x28F7, 0x360F, 0x6EE7, 0x701F, 0x5317, 0x4DEF,
+        0x275E, 0x39A6, 0x1AAE, 0x0456, 0x5CBE, 0x4246, 0x614E, 0x7FB6,
+        0x71B5, 0x6F4D, 0x4C45, 0x52BD, 0x0A55, 0x14AD, 0x37A5, 0x295D,
+        0x43EC, 0x5D14, 0x7E1C, 0x60E4, 0x380C, 0x26F4, 0x05FC, 0x1B04,
+        0x33F4, 0x2D0C, 0x0E04, 0x10FC, 0x4814, 0x56EC, 0x75E4, 0x6B1C,
+        0x01AD, 0x1F55, 0x3C5D, 0x22A5, 0x7A4D, 0x64B5, 0x47BD, 0x5945,
+        0x5746, 0x49BE, 0x6AB6, 0x744E, 0x2CA6, 0x325E, 0x1156, 0x0FAE,
+        0x651F, 0x7BE7, 0x58EF, 0x4617, 0x1EFF, 0x0007, 0x230F, 0x3DF7,
+        0x3F09, 0x21F1, 0x02F9, 0x1C01, 0x44E9, 0x5A11, 0x7919, 0x67E1,
+        0x0D50, 0x13A8, 0x30A0, 0x2E58, 0x76B0, 0x6848, 0x4B40, 0x55B8,
+        0x5BBB, 0x4543, 0x664B, 0x78B3, 0x205B, 0x3EA3, 0x1DAB, 0x0353,
+        0x69E2, 0x771A, 0x5412, 0x4AEA, 0x1202, 0x0CFA, 0x2FF2, 0x310A,
+        0x2A0E, 0x34F6, 0x17FE, 0x0906, 0x51EE, 0x4F16, 0x6C1E, 0x72E6,
+        0x1857, 0x06AF, 0x25A7, 0x3B5F, 0x63B7, 0x7D4F, 0x5E47, 0x40BF,
+        0x4EBC, 0x5044, 0x734C, 0x6DB4, 0x355C, 0x2BA4, 0x08AC, 0x1654,
+        0x7CE5, 0x621D, 0x4115, 0x5FED, 0x0705, 0x19FD, 0x3AF5, 0x240D,
+        0x26F3, 0x380B, 0x1B03, 0x05FB, 0x5D13, 0x43EB, 0x60E3, 0x7E1B,
+        0x14AA, 0x0A52, 0x295A, 0x37A2, 0x6F4A, 0x71B2, 0x52BA, 0x4C42,
+        0x4241, 0x5CB9, 0x7FB1, 0x6149, 0x39A1, 0x2759, 0x0451, 0x1AA9,
+        0x7018, 0x6EE0, 0x4DE8, 0x5310, 0x0BF8, 0x1500, 0x3608, 0x28F0,
+    },
+    {   /* a * x^31 mod P */
+        0x0000, 0x7014, 0x25B1, 0x55A5, 0x4B62, 0x3B76, 0x6ED3, 0x1EC7,
+        0x535D, 0x2349, 0x76EC, 0x06F8, 0x183F, 0x682B, 0x3D8E, 0x4D9A,
+        0x6323, 0x1337, 0x4692, 0x3686, 0x2841, 0x5855, 0x0DF0, 0x7DE4,
+        0x307E, 0x406A, 0x15CF, 0x65DB, 0x7B1C, 0x0B08, 0x5EAD, 0x2EB9,
+        0x03DF, 0x73CB, 0x266E, 0x567A, 0x48BD, 0x38A9, 0x6D0C, 0x1D18,
+        0x5082, 0x2096, 0x7533, 0x0527, 0x1BE0, 0x6BF4, 0x3E51, 0x4E45,
+        0x60FC, 0x10E8, 0x454D, 0x3559, 0x2B9E, 0x5B8A, 0x0E2F, 0x7E3B,
+        0x33A1, 0x43B5, 0x1610, 0x6604, 0x78C3, 0x08D7, 0x5D72, 0x2D66,
+        0x07BE, 0x77AA, 0x220F, 0x521B, 0x4CDC, 0x3CC8, 0x696D, 0x1979,
+        0x54E3, 0x24F7, 0x7152, 0x0146, 0x1F81, 0x6F95, 0x3A30, 0x4A24,
+        0x649D, 0x1489, 0x412C, 0x3138, 0x2FFF, 0x5FEB, 0x0A4E, 0x7A5A,
+        0x37C0, 0x47D4, 0x1271, 0x6265, 0x7CA2, 0x0CB6, 0x5913, 0x2907,
+        0x0461, 0x7475, 0x21D0, 0x51C4, 0x4F03, 0x3F17, 0x6AB2, 0x1AA6,
+        0x573C, 0x2728, 0x728D, 0x0299, 0x1C5E, 0x6C4A, 0x39EF, 0x49FB,
+        0x6742, 0x1756, 0x42F3, 0x32E7, 0x2C20, 0x5C34, 0x0991, 0x7985,
+        0x341F, 0x440B, 0x11AE, 0x61BA, 0x7F7D, 0x0F69, 0x5ACC, 0x2AD8,
+        0x0F7C, 0x7F68, 0x2ACD, 0x5AD9, 0x441E, 0x340A, 0x61AF, 0x11BB,
+        0x5C21, 0x2C35, 0x7990, 0x0984, 0x1743, 0x6757, 0x32F2, 0x42E6,
+        0x6C5F, 0x1C4B, 0x49EE, 0x39FA, 0x273D, 0x5729, 0x028C, 0x7298,
+        0x3F02, 0x4F16, 0x1AB3, 0x6AA7, 0x7460, 0x0474, 0x51D1, 0x21C5,
+        0x0CA3, 0x7CB7, 0x2912, 0x5906, 0x47C1, 0x37D5, 0x6270, 0x1264,
+        0x5FFE, 0x2FEA, 0x7A4F, 0x0A5B, 0x149C, 0x6488, 0x312D, 0x4139,
+        0x6F80, 0x1F94, 0x4A31, 0x3A25, 0x24E2, 0x54F6, 0x0153, 0x7147,
+        0x3CDD, 0x4CC9, 0x196C, 0x6978, 0x77BF, 0x07AB, 0x520E, 0x221A,
+        0x08C2, 0x78D6, 0x2D73, 0x5D67, 0x43A0, 0x33B4, 0x6611, 0x1605,
+        0x5B9F, 0x2B8B, 0x7E2E, 0x0E3A, 0x10FD, 0x60E9, 0x354C, 0x4558,
+        0x6BE1, 0x1BF5, 0x4E50, 0x3E44, 0x2083, 0x5097, 0x0532, 0x7526,
+        0x38BC, 0x48A8, 0x1D0D, 0x6D19, 0x73DE, 0x03CA, 0x566F, 0x267B,
+        0x0B1D, 0x7B09, 0x2EAC, 0x5EB8, 0x407F, 0x306B, 0x65CE, 0x15DA,
+        0x5840, 0x2854, 0x7DF1, 0x0DE5, 0x1322, 0x6336, 0x3693, 0x4687,
+        0x683E, 0x182A, 0x4D8F, 0x3D9B, 0x235C, 0x5348, 0x06ED, 0x76F9,
+        0x3B63, 0x4B77, 0x1ED2, 0x6EC6, 0x7001, 0x0015, 0x55B0, 0x25A4,
+    },
+    {   /* a * x^23 mod P */
+        0x0000, 0x4426, 0x4DD5, 0x09F3, 0x5E33, 0x1A15, 0x13E6, 0x57C0,
+        0x79FF, 0x3DD9, 0x342A, 0x700C, 0x27CC, 0x63EA, 0x6A19, 0x2E3F,
+        0x3667, 0x7241, 0x7BB2, 0x3F94, 0x6854, 0x2C72, 0x2581, 0x61A7,
+        0x4F98, 0x0BBE, 0x024D, 0x466B, 0x11AB, 0x558D, 0x5C7E, 0x1858,
+        0x6CCE, 0x28E8, 0x211B, 0x653D, 0x32FD, 0x76DB, 0x7F28, 0x3B0E,
+        0x1531, 0x5117, 0x58E4, 0x1CC2, 0x4B02, 0x0F24, 0x06D7, 0x42F1,
+        0x5AA9, 0x1E8F, 0x177C, 0x535A, 0x049A, 0x40BC, 0x494F, 0x0D69,
+        0x2356, 0x6770, 0x6E83, 0x2AA5, 0x7D65, 0x3943, 0x30B0, 0x7496,
+        0x1C05, 0x5823, 0x51D0, 0x15F6, 0x4236, 0x0610, 0x0FE3, 0x4BC5,
+        0x65FA, 0x21DC, 0x282F, 0x6C09, 0x3BC9, 0x7FEF, 0x761C, 0x323A,
+        0x2A62, 0x6E44, 0x67B7, 0x2391, 0x7451, 0x3077, 0x3984, 0x7DA2,
+        0x539D, 0x17BB, 0x1E48, 0x5A6E, 0x0DAE, 0x4988, 0x407B, 0x045D,
+        0x70CB, 0x34ED, 0x3D1E, 0x7938, 0x2EF8, 0x6ADE, 0x632D, 0x270B,
+        0x0934, 0x4D12, 0x44E1, 0x00C7, 0x5707, 0x1321, 0x1AD2, 0x5EF4,
+        0x46AC, 0x028A, 0x0B79, 0x4F5F, 0x189F, 0x5CB9, 0x554A, 0x116C,
+        0x3F53, 0x7B75, 0x7286, 0x36A0, 0x6160, 0x2546, 0x2CB5, 0x6893,
+        0x380A, 0x7C2C, 0x75DF, 0x31F9, 0x6639, 0x221F, 0x2BEC, 0x6FCA,
+        0x41F5, 0x05D3, 0x0C20, 0x4806, 0x1FC6, 0x5BE0, 0x5213, 0x1635,
+        0x0E6D, 0x4A4B, 0x43B8, 0x079E, 0x505E, 0x1478, 0x1D8B, 0x59AD,
+        0x7792, 0x33B4, 0x3A47, 0x7E61, 0x29A1, 0x6D87, 0x6474, 0x2052,
+        0x54C4, 0x10E2, 0x1911, 0x5D37, 0x0AF7, 0x4ED1, 0x4722, 0x0304,
+        0x2D3B, 0x691D, 0x60EE, 0x24C8, 0x7308, 0x372E, 0x3EDD, 0x7AFB,
+        0x62A3, 0x2685, 0x2F76, 0x6B50, 0x3C90, 0x78B6, 0x7145, 0x3563,
+        0x1B5C, 0x5F7A, 0x5689, 0x12AF, 0x456F, 0x0149, 0x08BA, 0x4C9C,
+        0x240F, 0x6029, 0x69DA, 0x2DFC, 0x7A3C, 0x3E1A, 0x37E9, 0x73CF,
+        0x5DF0, 0x19D6, 0x1025, 0x5403, 0x03C3, 0x47E5, 0x4E16, 0x0A30,
+        0x1268, 0x564E, 0x5FBD, 0x1B9B, 0x4C5B, 0x087D, 0x018E, 0x45A8,
+        0x6B97, 0x2FB1, 0x2642, 0x6264, 0x35A4, 0x7182, 0x7871, 0x3C57,
+        0x48C1, 0x0CE7, 0x0514, 0x4132, 0x16F2, 0x52D4, 0x5B27, 0x1F01,
+        0x313E, 0x7518, 0x7CEB, 0x38CD, 0x6F0D, 0x2B2B, 0x22D8, 0x66FE,
+        0x7EA6, 0x3A80, 0x3373, 0x7755, 0x2095, 0x64B3, 0x6D40, 0x2966,
+        0x0759, 0x437F, 0x4A8C, 0x0EAA, 0x596A, 0x1D4C, 0x14BF, 0x5099,
+    },
+    {   /* a * x^15 mod P */
+        0x0000, 0x4599, 0x4EAB, 0x0B32, 0x58CF, 0x1D56, 0x1664, 0x53FD,
+        0x7407, 0x319E, 0x3AAC, 0x7F35, 0x2CC8, 0x6951, 0x6263, 0x27FA,
+        0x2D97, 0x680E, 0x633C, 0x26A5, 0x7558, 0x30C1, 0x3BF3, 0x7E6A,
+        0x5990, 0x1C09, 0x173B, 0x52A2, 0x015F, 0x44C6, 0x4FF4, 0x0A6D,
+        0x5B2E, 0x1EB7, 0x1585, 0x501C, 0x03E1, 0x4678, 0x4D4A, 0x08D3,
+        0x2F29, 0x6AB0, 0x6182, 0x241B, 0x77E6, 0x327F, 0x394D, 0x7CD4,
+        0x76B9, 0x3320, 0x3812, 0x7D8B, 0x2E76, 0x6BEF, 0x60DD, 0x2544,
+        0x02BE, 0x4727, 0x4C15, 0x098C, 0x5A71, 0x1FE8, 0x14DA, 0x5143,
+        0x73C5, 0x365C, 0x3D6E, 0x78F7, 0x2B0A, 0x6E93, 0x65A1, 0x2038,
+        0x07C2, 0x425B, 0x4969, 0x0CF0, 0x5F0D, 0x1A94, 0x11A6, 0x543F,
+        0x5E52, 0x1BCB, 0x10F9, 0x5560, 0x069D, 0x4304, 0x4836, 0x0DAF,
+        0x2A55, 0x6FCC, 0x64FE, 0x2167, 0x729A, 0x3703, 0x3C31, 0x79A8,
+        0x28EB, 0x6D72, 0x6640, 0x23D9, 0x7024, 0x35BD, 0x3E8F, 0x7B16,
+        0x5CEC, 0x1975, 0x1247, 0x57DE, 0x0423, 0x41BA, 0x4A88, 0x0F11,
+        0x057C, 0x40E5, 0x4BD7, 0x0E4E, 0x5DB3, 0x182A, 0x1318, 0x5681,
+        0x717B, 0x34E2, 0x3FD0, 0x7A49, 0x29B4, 0x6C2D, 0x671F, 0x2286,
+        0x2213, 0x678A, 0x6CB8, 0x2921, 0x7ADC, 0x3F45, 0x3477, 0x71EE,
+        0x5614, 0x138D, 0x18BF, 0x5D26, 0x0EDB, 0x4B42, 0x4070, 0x05E9,
+        0x0F84, 0x4A1D, 0x412F, 0x04B6, 0x574B, 0x12D2, 0x19E0, 0x5C79,
+        0x7B83, 0x3E1A, 0x3528, 0x70B1, 0x234C, 0x66D5, 0x6DE7, 0x287E,
+        0x793D, 0x3CA4, 0x3796, 0x720F, 0x21F2, 0x646B, 0x6F59, 0x2AC0,
+        0x0D3A, 0x48A3, 0x4391, 0x0608, 0x55F5, 0x106C, 0x1B5E, 0x5EC7,
+        0x54AA, 0x1133, 0x1A01, 0x5F98, 0x0C65, 0x49FC, 0x42CE, 0x0757,
+        0x20AD, 0x6534, 0x6E06, 0x2B9F, 0x7862, 0x3DFB, 0x36C9, 0x7350,
+        0x51D6, 0x144F, 0x1F7D, 0x5AE4, 0x0919, 0x4C80, 0x47B2, 0x022B,
+        0x25D1, 0x6048, 0x6B7A, 0x2EE3, 0x7D1E, 0x3887, 0x33B5, 0x762C,
+        0x7C41, 0x39D8, 0x32EA, 0x7773, 0x248E, 0x6117, 0x6A25, 0x2FBC,
+        0x0846, 0x4DDF, 0x46ED, 0x0374, 0x5089, 0x1510, 0x1E22, 0x5BBB,
+        0x0AF8, 0x4F61, 0x4453, 0x01CA, 0x5237, 0x17AE, 0x1C9C, 0x5905,
+        0x7EFF, 0x3B66, 0x3054, 0x75CD, 0x2630, 0x63A9, 0x689B, 0x2D02,
+        0x276F, 0x62F6, 0x69C4, 0x2C5D, 0x7FA0, 0x3A39, 0x310B, 0x7492,
+        0x5368, 0x16F1, 0x1DC3, 0x585A, 0x0BA7, 0x4E3E, 0x450C, 0x0095,
+    },
+};
+
 /*================== Function Prototypes ==================================*/
 
+static uint16_t LTC_pec15_step32(uint16_t remainder, const uint8_t *data);
+
 /*================== Function Implementations =============================*/
 
 uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data) {
@@ -88,6 +236,55 @@ uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data) {
 
 /*================== Public functions =====================================*/
 
+uint16_t LTC_pec15_calcFrame(const uint8_t *data) {
+    uint16_t remainder = LTC_pec15_step32(16, data);
+    uint16_t word = (uint16_t)((remainder << 1) ^ ((uint16_t)data[4] << 8) ^ data[5]);
+
+    remainder = ltc_pec15SliceTable[2][word >> 8] ^ ltc_pec15SliceTable[3][word & 0xFF];
+    return (uint16_t)(remainder*2);
+}
+
+
+uint16_t LTC_pec15_checkFrames(const uint8_t *data, uint16_t nr_of_devices, uint32_t *validmask) {
+    uint16_t nr_of_errors = 0;
+    uint16_t remainder = 0;
+
+    for (uint16_t i = 0; i < LTC_PEC_MASK_WORDS(nr_of_devices); i++) {
+        validmask[i] = 0;
+    }
+
+    for (uint16_t i = 0; i < nr_of_devices; i++) {
+        /* the remainder over data and the PEC appended to it is 0 for an intact slot. The PEC
+         * is the 15 bit CRC shifted left by one, so its LSB has to be 0 as well: otherwise a
+         * PEC that differs from the correct one by the polynomial would also leave remainder 0 */
+        remainder = LTC_pec15_step32(16, &data[i*8]);
+        remainder = LTC_pec15_step32(remainder, &data[i*8 + 4]);
+        if ((remainder == 0) && ((data[i*8 + 7] & 0x01u) == 0)) {
+            validmask[i/32] |= (uint32_t)1 << (i%32);
+        } else {
+            nr_of_errors++;
+        }
+    }
+    return nr_of_errors;
+}
+
 /*================== Static functions =====================================*/
 
+/**
+ * @brief   feeds 4 bytes (MSB first) into the CRC15 remainder
+ *
+ * @param   remainder   15 bit remainder before the 4 bytes
+ * @param   data        pointer to the 4 bytes
+ *
+ * @return  15 bit remainder after the 4 bytes
+ */
+static uint16_t LTC_pec15_step32(uint16_t remainder, const uint8_t *data) {
+    uint32_t word = ((uint32_t)remainder << 17) ^
+                    ((uint32_t)data[0] << 24) ^ ((uint32_t)data[1] << 16) ^
+                    ((uint32_t)data[2] << 8) ^ (uint32_t)data[3];
+
+    return ltc_pec15SliceTable[0][word >> 24] ^ ltc_pec15SliceTable[1][(word >> 16) & 0xFF] ^
+           ltc_pec15SliceTable[2][(word >> 8) & 0xFF] ^ ltc_pec15SliceTable[3][word & 0xFF];
+}
+
 
@@ -78,6 +78,11 @@ void generate_crc15_table()
 
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * number of 32 bit words of the validity mask returned by LTC_pec15_checkFrames()
+ */
+#define LTC_PEC_MASK_WORDS(nr_of_devices)     (((nr_of_devices) + 31u) / 32u)
+
 /*================== Constant and Variable Definitions ====================*/
 
 static const unsigned int crc15Table[256] = {  /* precomputed CRC15 Table */
@@ -119,6 +124,30 @@ static const unsigned int crc15Table[256] = {  /* precomputed CRC15 Table */
  */
 uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data);
 
+/**
+ * @brief   calculates the PEC of the 6 data bytes of one LTC with 32 bit steps
+ *
+ * @param   data     6 data bytes, the PEC is transmitted after them
+ *
+ * @return  PEC
+ */
+uint16_t LTC_pec15_calcFrame(const uint8_t *data);
+
+/**
+ * @brief   checks the PECs of all devices of a daisy-chain in one call
+ *
+ * The data of each device consists of 6 data bytes and the 2 bytes PEC (MSB first),
+ * the slots of the devices follow each other without gaps.
+ *
+ * @param   data            first byte of the first device (i.e., after the command and its PEC)
+ * @param   nr_of_devices   number of devices in the daisy-chain
+ * @param   validmask       bitmask with LTC_PEC_MASK_WORDS(nr_of_devices) words, bit i is set
+ *                          if the PEC of device i is valid
+ *
+ * @return  number of devices with invalid PEC
+ */
+uint16_t LTC_pec15_checkFrames(const uint8_t *data, uint16_t nr_of_devices, uint32_t *validmask);
+
 /*================== Function Implementations =============================*/
 
 #endif /* LTC_PEC_H_ */
@@ -73,27 +73,18 @@
 /*================== Includes ===============================================*/
 #include "general.h"
 
-/*================== Macros and Definitions =================================*/
-/**
- * Position of the NTC in the voltage resistor
- * TRUE: NTC is positioned above the voltage tap for the ADC voltage.
- * This equals resistor R1 in the above circuit diagram
- *
- * FALSE: NTC is positioned below the voltage tap for the ADC voltage.
- * This equals resistor R2 in the above circuit diagram
- */
-#define B57861S0103F045_POSITION_IN_RESISTOR_DIVIDER_IS_R1        (FALSE)
-
-/**
- * Resistor divider supply voltage in volt
- */
-#define B57861S0103F045_RESISTOR_DIVIDER_SUPPLY_VOLTAGE_V         (3.0f)
+#include "tsensors.h"
 
-/**
- * Resistance value of the other resistor (not the NTC) in the resistor
- * divider in kOhm.
+/*================== Macros and Definitions =================================*/
+/*
+ * The position of the NTC in the resistor divider (R1/R2 in the above circuit
+ * diagram), the supply voltage and the other resistor are configured in
+ * tsensors_cfg.yml. B57861S0103F045_POSITION_IN_RESISTOR_DIVIDER_IS_R1,
+ * B57861S0103F045_RESISTOR_DIVIDER_SUPPLY_VOLTAGE_V and
+ * B57861S0103F045_RESISTOR_DIVIDER_RESISTANCE_R1_R2_Ohm are generated into
+ * tsensors_models_cfg.h, the sensor is converted with the generated model
+ * TSENSORS_B57861S0103F045 (see tsensors.h).
  */
-#define B57861S0103F045_RESISTOR_DIVIDER_RESISTANCE_R1_R2_Ohm       (10000.0f)
 
 /*================== Extern Constant and Variable Declarations ==============*/
 /*
@@ -112,7 +103,9 @@ extern float B57861S0103F045_GetTempFromLUT(uint16_t vadc_mV);
  *
  * @param   adc voltage in mV
  *
- * @return  corresponding temperature in &deg;C
+ * @return  corresponding temperature in &deg;C or FLT_MAX/FLT_MIN if NTC is
+ *          shorted or got disconnected. The caller of this functions needs to
+ *          check for these return values to prevent invalid data.
  */
 extern float B57861S0103F045_GetTempFromPolynom(uint16_t vadc_mV);
 
@@ -0,0 +1,169 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    tsensors.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TSENSORS
+ * @prefix  TSENSORS
+ *
+ * @brief   Conversion of NTC voltages to temperatures
+ *
+ */
+
+/*================== Includes ===============================================*/
+#include "tsensors.h"
+
+#include <float.h>
+
+/*================== Macros and Definitions =================================*/
+
+/**
+ * fractional bits of the position in a polynomial segment
+ */
+#define TSENSORS_SEGMENT_POSITION_BITS      15u
+
+/*================== Static Constant and Variable Definitions ===============*/
+
+/*================== Extern Constant and Variable Definitions ===============*/
+
+/*================== Static Function Prototypes =============================*/
+static float TSENSORS_OutOfRange(const TSENSORS_SENSOR_s *sensorptr, uint16_t vadc_mV);
+static int32_t TSENSORS_EvaluatePolynomial(const TSENSORS_SENSOR_s *sensorptr, uint16_t vadc_mV);
+
+/*================== Static Function Implementations ========================*/
+
+/**
+ * @brief   returns the temperature reported for a voltage out of the operating range.
+ *
+ * Depending on the position of the NTC in the resistor divider, a voltage below
+ * the operating range means a temperature above or below it.
+ *
+ * @param   sensorptr   description of the sensor
+ * @param   vadc_mV     ADC voltage in mV, out of the operating range
+ *
+ * @return  FLT_MAX if the temperature is above the operating range, -FLT_MAX otherwise
+ */
+static float TSENSORS_OutOfRange(const TSENSORS_SENSOR_s *sensorptr, uint16_t vadc_mV) {
+    float temperature = FLT_MAX;
+
+    if ((vadc_mV > sensorptr->vmax_mV) == (sensorptr->ntcIsR1 == FALSE)) {
+        temperature = -FLT_MAX;
+    }
+    return temperature;
+}
+
+/**
+ * @brief   evaluates the polynomial segment of a voltage in fixed point.
+ *
+ * The position u in the segment (0 <= u < 1) has TSENSORS_SEGMENT_POSITION_BITS
+ * fractional bits. The polynomial is evaluated with the Horner scheme, the
+ * generator ensures that no intermediate result overflows.
+ *
+ * @param   sensorptr   description of the sensor
+ * @param   vadc_mV     ADC voltage in mV, in the operating range
+ *
+ * @return  temperature in 0.01 degC
+ */
+static int32_t TSENSORS_EvaluatePolynomial(const TSENSORS_SENSOR_s *sensorptr, uint16_t vadc_mV) {
+    uint16_t offset_mV = vadc_mV - sensorptr->vmin_mV;
+    const int32_t *coefficient = &sensorptr->coefficients[(offset_mV >> sensorptr->segmentShift) * (sensorptr->polynomialDegree + 1u)];
+    int32_t u = (int32_t)(offset_mV & ((1u << sensorptr->segmentShift) - 1u)) << (TSENSORS_SEGMENT_POSITION_BITS - sensorptr->segmentShift);
+    int32_t result = coefficient[0];
+    uint8_t i = 0;
+
+    for (i = 1; i <= sensorptr->polynomialDegree; i++) {
+        result = (int32_t)(((int64_t)result * u) >> TSENSORS_SEGMENT_POSITION_BITS) + coefficient[i];
+    }
+    return (result + (1 << (sensorptr->fractionalBits - 1u))) >> sensorptr->fractionalBits;
+}
+
+/*================== Extern Function Implementations ========================*/
+
+extern float TSENSORS_GetTempFromTable(TSENSORS_ID_e sensor, uint16_t vadc_mV) {
+    const TSENSORS_SENSOR_s *sensorptr = &tsensors_sensors[sensor];
+    float temperature = 0.0;
+    uint16_t index = 0;
+    uint16_t remainder = 0;
+    int32_t temperature_cdegC = 0;
+
+    if (vadc_mV < sensorptr->vmin_mV || vadc_mV > sensorptr->vmax_mV) {
+        /* Invalid measured ADC voltage -> sensor out of operating range or disconnected/shorted */
+        temperature = TSENSORS_OutOfRange(sensorptr, vadc_mV);
+    } else {
+        /* The table is indexed directly by the ADC voltage, interpolate between two entries */
+        index = (vadc_mV - sensorptr->vmin_mV) / sensorptr->tableStep_mV;
+        remainder = (vadc_mV - sensorptr->vmin_mV) % sensorptr->tableStep_mV;
+        temperature_cdegC = sensorptr->table_cdegC[index];
+        if (remainder > 0) {
+            temperature_cdegC += ((sensorptr->table_cdegC[index+1] - temperature_cdegC) * (int32_t)remainder) / (int32_t)sensorptr->tableStep_mV;
+        }
+        temperature = temperature_cdegC * 0.01f;
+    }
+    return temperature;
+}
+
+
+extern float TSENSORS_GetTempFromPolynomial(TSENSORS_ID_e sensor, uint16_t vadc_mV) {
+    const TSENSORS_SENSOR_s *sensorptr = &tsensors_sensors[sensor];
+    float temperature = 0.0;
+
+    if (vadc_mV < sensorptr->vmin_mV || vadc_mV > sensorptr->vmax_mV) {
+        /* Invalid measured ADC voltage -> sensor out of operating range or disconnected/shorted */
+        temperature = TSENSORS_OutOfRange(sensorptr, vadc_mV);
+    } else {
+        temperature = TSENSORS_EvaluatePolynomial(sensorptr, vadc_mV) * 0.01f;
+    }
+    return temperature;
+}
+
+
+extern STD_RETURN_TYPE_e TSENSORS_GetTempFromPolynomial_cdegC(TSENSORS_ID_e sensor, uint16_t vadc_mV, int16_t *temperature_cdegC) {
+    const TSENSORS_SENSOR_s *sensorptr = &tsensors_sensors[sensor];
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+
+    if (vadc_mV >= sensorptr->vmin_mV && vadc_mV <= sensorptr->vmax_mV) {
+        *temperature_cdegC = (int16_t)TSENSORS_EvaluatePolynomial(sensorptr, vadc_mV);
+        retVal = E_OK;
+    }
+    return retVal;
+}
@@ -0,0 +1,126 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    tsensors.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TSENSORS
+ * @prefix  TSENSORS
+ *
+ * @brief   Header of the conversion of NTC voltages to temperatures
+ *
+ * The sensors are described in tsensors_cfg.yml. waf generates the sensor IDs
+ * (TSENSORS_ID_e) and for every sensor a table and a piecewise polynomial of
+ * the temperature over the ADC voltage into tsensors_models_cfg.h/.c.
+ *
+ */
+
+#ifndef TSENSORS_H_
+#define TSENSORS_H_
+
+/*================== Includes ===============================================*/
+#include "general.h"
+
+#include "tsensors_models_cfg.h"
+
+/*================== Macros and Definitions =================================*/
+
+/**
+ * conversion of the ADC voltage of a sensor to its temperature
+ */
+typedef struct {
+    uint16_t vmin_mV;               /*!< lowest ADC voltage in the operating range of the sensor                    */
+    uint16_t vmax_mV;               /*!< highest ADC voltage in the operating range of the sensor                   */
+    uint8_t ntcIsR1;                /*!< TRUE: NTC is R1 of the resistor divider, the voltage rises with temperature */
+    uint16_t tableStep_mV;          /*!< distance of the table entries in mV                                        */
+    const int16_t *table_cdegC;     /*!< temperature in 0.01 degC at vmin_mV + i*tableStep_mV                       */
+    uint8_t segmentShift;           /*!< the polynomial segments are (1 << segmentShift) mV long                    */
+    uint8_t polynomialDegree;       /*!< degree of the polynomial of each segment                                   */
+    uint8_t fractionalBits;         /*!< fractional bits of the polynomial coefficients                             */
+    const int32_t *coefficients;    /*!< per segment polynomialDegree+1 coefficients, highest order first           */
+} TSENSORS_SENSOR_s;
+
+/*================== Extern Constant and Variable Declarations ==============*/
+
+/**
+ * sensor descriptions generated from tsensors_cfg.yml, indexed by TSENSORS_ID_e
+ */
+extern const TSENSORS_SENSOR_s tsensors_sensors[TSENSORS_MAX];
+
+/*================== Extern Function Prototypes =============================*/
+
+/**
+ * @brief   returns the temperature of a sensor, interpolated in its table.
+ *
+ * @param   sensor    ID of the sensor
+ * @param   vadc_mV   ADC voltage in mV
+ *
+ * @return  temperature in &deg;C or FLT_MAX/-FLT_MAX if the voltage is out of
+ *          the operating range (NTC shorted or disconnected)
+ */
+extern float TSENSORS_GetTempFromTable(TSENSORS_ID_e sensor, uint16_t vadc_mV);
+
+/**
+ * @brief   returns the temperature of a sensor, calculated with its piecewise polynomial.
+ *
+ * @param   sensor    ID of the sensor
+ * @param   vadc_mV   ADC voltage in mV
+ *
+ * @return  temperature in &deg;C or FLT_MAX/-FLT_MAX if the voltage is out of
+ *          the operating range (NTC shorted or disconnected)
+ */
+extern float TSENSORS_GetTempFromPolynomial(TSENSORS_ID_e sensor, uint16_t vadc_mV);
+
+/**
+ * @brief   returns the temperature of a sensor in 0.01 &deg;C, calculated with its piecewise polynomial.
+ *
+ * Integer variant of TSENSORS_GetTempFromPolynomial().
+ *
+ * @param   sensor              ID of the sensor
+ * @param   vadc_mV             ADC voltage in mV
+ * @param   temperature_cdegC   temperature in 0.01 &deg;C
+ *
+ * @return  E_OK if the voltage is in the operating range, E_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e TSENSORS_GetTempFromPolynomial_cdegC(TSENSORS_ID_e sensor, uint16_t vadc_mV, int16_t *temperature_cdegC);
+
+#endif /* TSENSORS_H_ */
@@ -0,0 +1,211 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    movstat.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  MOVSTAT
+ *
+ * @brief   moving statistics of integer signals over several windows
+ *
+ */
+
+/*================== Includes ===============================================*/
+#include "movstat.h"
+
+#include <math.h>
+
+/*================== Macros and Definitions =================================*/
+
+/*================== Static Constant and Variable Definitions ===============*/
+
+/*================== Extern Constant and Variable Definitions ===============*/
+
+/*================== Static Function Prototypes =============================*/
+static uint32_t MOVSTAT_Age(const MOVSTAT_s *movstat, uint32_t index);
+static int32_t MOVSTAT_GetSample(const MOVSTAT_s *movstat, uint32_t index);
+
+/*================== Static Function Implementations ========================*/
+
+/**
+ * @brief   returns the number of samples added after the sample at a ring index.
+ *
+ * @param   movstat     moving statistics of the signal
+ * @param   index       ring index of the sample
+ *
+ * @return  0 for the newest sample
+ */
+static uint32_t MOVSTAT_Age(const MOVSTAT_s *movstat, uint32_t index) {
+    return (movstat->position >= index) ? (movstat->position - index) : (movstat->position + movstat->ringLength - index);
+}
+
+/**
+ * @brief   returns the sample at a ring index, calculated from the prefix sums.
+ *
+ * @param   movstat     moving statistics of the signal
+ * @param   index       ring index of the sample
+ *
+ * @return  sample
+ */
+static int32_t MOVSTAT_GetSample(const MOVSTAT_s *movstat, uint32_t index) {
+    uint32_t previous = (index == 0u) ? (movstat->ringLength - 1u) : (index - 1u);
+
+    return (int32_t)(movstat->prefixSum[index] - movstat->prefixSum[previous]);
+}
+
+/*================== Extern Function Implementations ========================*/
+
+STD_RETURN_TYPE_e MOVSTAT_Init(MOVSTAT_s *movstat) {
+    STD_RETURN_TYPE_e retval = E_OK;
+    MOVSTAT_WINDOW_s *window = NULL_PTR;
+    uint32_t i = 0;
+
+    if ((movstat->prefixSum == NULL_PTR) || (movstat->ringLength < 2u)) {
+        retval = E_NOT_OK;
+    }
+    for (i = 0; (i < movstat->nrOfWindows) && (retval == E_OK); i++) {
+        window = &movstat->windows[i];
+        if ((window->length == 0u) || (window->length >= movstat->ringLength) ||
+                (((window->statistics & MOVSTAT_MIN) != 0u) && (window->minQueue == NULL_PTR)) ||
+                (((window->statistics & MOVSTAT_MAX) != 0u) && (window->maxQueue == NULL_PTR)) ||
+                (((window->statistics & MOVSTAT_RMS) != 0u) && (movstat->prefixSumSquares == NULL_PTR))) {
+            retval = E_NOT_OK;
+        }
+    }
+
+    if (retval == E_OK) {
+        /* The prefix sum before the first sample is 0 */
+        for (i = 0; i < movstat->ringLength; i++) {
+            movstat->prefixSum[i] = 0;
+            if (movstat->prefixSumSquares != NULL_PTR) {
+                movstat->prefixSumSquares[i] = 0;
+            }
+        }
+        movstat->position = 0;
+        for (i = 0; i < movstat->nrOfWindows; i++) {
+            window = &movstat->windows[i];
+            window->nrOfSamples = 0;
+            window->sum = 0;
+            window->mean = 0.0f;
+            window->min = 0;
+            window->max = 0;
+            window->rms = 0.0f;
+            window->minHead = 0;
+            window->minCount = 0;
+            window->maxHead = 0;
+            window->maxCount = 0;
+        }
+    }
+    return retval;
+}
+
+
+void MOVSTAT_AddSample(MOVSTAT_s *movstat, int32_t value) {
+    MOVSTAT_WINDOW_s *window = NULL_PTR;
+    uint32_t previous = movstat->position;
+    uint32_t start = 0;
+    uint32_t tail = 0;
+    uint8_t i = 0;
+
+    movstat->position = (previous + 1u == movstat->ringLength) ? 0u : (previous + 1u);
+    movstat->prefixSum[movstat->position] = movstat->prefixSum[previous] + (uint64_t)(int64_t)value;
+    if (movstat->prefixSumSquares != NULL_PTR) {
+        movstat->prefixSumSquares[movstat->position] = movstat->prefixSumSquares[previous] + (uint64_t)((int64_t)value * value);
+    }
+
+    for (i = 0; i < movstat->nrOfWindows; i++) {
+        window = &movstat->windows[i];
+        if (window->nrOfSamples < window->length) {
+            window->nrOfSamples++;
+        }
+        /* Prefix sum before the oldest sample of the window; 0 while the window is filled */
+        start = (movstat->position >= window->length) ? (movstat->position - window->length) : (movstat->position + movstat->ringLength - window->length);
+        window->sum = (int64_t)(movstat->prefixSum[movstat->position] - movstat->prefixSum[start]);
+        window->mean = (float)window->sum / window->nrOfSamples;
+
+        if ((window->statistics & MOVSTAT_RMS) != 0u) {
+            window->rms = sqrtf((float)(movstat->prefixSumSquares[movstat->position] - movstat->prefixSumSquares[start]) / window->nrOfSamples);
+        }
+
+        if ((window->statistics & MOVSTAT_MIN) != 0u) {
+            /* Drop the sample that left the window, then all candidates that are not smaller than the new sample */
+            if ((window->minCount > 0u) && (MOVSTAT_Age(movstat, window->minQueue[window->minHead]) >= window->length)) {
+                window->minHead = (window->minHead + 1u == window->length) ? 0u : (window->minHead + 1u);
+                window->minCount--;
+            }
+            while (window->minCount > 0u) {
+                tail = window->minHead + window->minCount - 1u;
+                tail = (tail >= window->length) ? (tail - window->length) : tail;
+                if (MOVSTAT_GetSample(movstat, window->minQueue[tail]) < value) {
+                    break;
+                }
+                window->minCount--;
+            }
+            tail = window->minHead + window->minCount;
+            tail = (tail >= window->length) ? (tail - window->length) : tail;
+            window->minQueue[tail] = movstat->position;
+            window->minCount++;
+            window->min = MOVSTAT_GetSample(movstat, window->minQueue[window->minHead]);
+        }
+
+        if ((window->statistics & MOVSTAT_MAX) != 0u) {
+            if ((window->maxCount > 0u) && (MOVSTAT_Age(movstat, window->maxQueue[window->maxHead]) >= window->length)) {
+                window->maxHead = (window->maxHead + 1u == window->length) ? 0u : (window->maxHead + 1u);
+                window->maxCount--;
+            }
+            while (window->maxCount > 0u) {
+                tail = window->maxHead + window->maxCount - 1u;
+                tail = (tail >= window->length) ? (tail - window->length) : tail;
+                if (MOVSTAT_GetSample(movstat, window->maxQueue[tail]) > value) {
+                    break;
+                }
+                window->maxCount--;
+            }
+            tail = window->maxHead + window->maxCount;
+            tail = (tail >= window->length) ? (tail - window->length) : tail;
+            window->maxQueue[tail] = movstat->position;
+            window->maxCount++;
+            window->max = MOVSTAT_GetSample(movstat, window->maxQueue[window->maxHead]);
+        }
+    }
+}
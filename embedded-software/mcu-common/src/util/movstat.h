@@ -0,0 +1,139 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    movstat.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  MOVSTAT
+ *
+ * @brief   moving statistics of integer signals over several windows
+ *
+ * @details All windows of a signal share one ring of 64 bit prefix sums. The
+ *          sum of a window is the difference of two prefix sums, so every
+ *          sample is added in O(1) independent of the number and length of
+ *          the windows and the result is exact, without drift over time.
+ *          Minimum and maximum are tracked with monotonic queues (amortized
+ *          O(1)), the RMS with a second ring of prefix sums of the squares.
+ *
+ */
+
+#ifndef MOVSTAT_H_
+#define MOVSTAT_H_
+
+/*================== Includes ===============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions =================================*/
+/** @{
+ * statistics of a window in addition to the mean, see MOVSTAT_WINDOW_s
+ */
+#define MOVSTAT_MIN     0x01u
+#define MOVSTAT_MAX     0x02u
+#define MOVSTAT_RMS     0x04u
+/** @} */
+
+/**
+ * window of the moving statistics. length, statistics and the queues are
+ * configured, the rest is calculated by MOVSTAT_AddSample().
+ */
+typedef struct {
+    uint32_t length;        /*!< number of samples of the window, 0 < length < ringLength of the signal */
+    uint8_t statistics;     /*!< MOVSTAT_MIN, MOVSTAT_MAX, MOVSTAT_RMS or 0 for the mean only           */
+    uint32_t *minQueue;     /*!< length entries, only needed with MOVSTAT_MIN                           */
+    uint32_t *maxQueue;     /*!< length entries, only needed with MOVSTAT_MAX                           */
+    uint32_t nrOfSamples;   /*!< number of samples in the window, less than length after MOVSTAT_Init() */
+    int64_t sum;            /*!< sum of the samples in the window                                      */
+    float mean;             /*!< mean of the samples in the window                                     */
+    int32_t min;            /*!< minimum of the samples in the window (MOVSTAT_MIN)                    */
+    int32_t max;            /*!< maximum of the samples in the window (MOVSTAT_MAX)                    */
+    float rms;              /*!< root mean square of the samples in the window (MOVSTAT_RMS)           */
+    uint32_t minHead;       /*!< index of the oldest entry of minQueue                                 */
+    uint32_t minCount;      /*!< number of entries of minQueue                                         */
+    uint32_t maxHead;       /*!< index of the oldest entry of maxQueue                                 */
+    uint32_t maxCount;      /*!< number of entries of maxQueue                                         */
+} MOVSTAT_WINDOW_s;
+
+/**
+ * moving statistics of one signal
+ *
+ * The prefix sums wrap around modulo 2^64. The differences stay exact as long
+ * as the sum (of the squares) of the samples of the longest window fits into
+ * 64 bits.
+ */
+typedef struct {
+    uint64_t *prefixSum;            /*!< ring of prefix sums of the samples, ringLength entries                */
+    uint64_t *prefixSumSquares;     /*!< ring of prefix sums of the squares, only needed with MOVSTAT_RMS      */
+    uint32_t ringLength;            /*!< longest window + 1                                                    */
+    MOVSTAT_WINDOW_s *windows;      /*!< windows of the signal                                                 */
+    uint8_t nrOfWindows;            /*!< number of windows                                                     */
+    uint32_t position;              /*!< ring index of the newest sample                                       */
+} MOVSTAT_s;
+
+/*================== Extern Constant and Variable Declarations ==============*/
+
+/*================== Extern Function Prototypes =============================*/
+
+/**
+ * @brief   checks the configuration of the moving statistics and clears them.
+ *
+ * The rings are cleared here, so they can be placed in memory that is not
+ * initialized at startup (e.g., MEM_EXT_SDRAM).
+ *
+ * @param   movstat     moving statistics of the signal
+ *
+ * @return  E_OK if the configuration is valid, otherwise E_NOT_OK
+ */
+extern STD_RETURN_TYPE_e MOVSTAT_Init(MOVSTAT_s *movstat);
+
+/**
+ * @brief   adds a sample and updates the statistics of all windows.
+ *
+ * Until a window is filled, the statistics are calculated over the samples
+ * added so far.
+ *
+ * @param   movstat     moving statistics of the signal, initialized with MOVSTAT_Init()
+ * @param   value       new sample
+ */
+extern void MOVSTAT_AddSample(MOVSTAT_s *movstat, int32_t value);
+
+#endif /* MOVSTAT_H_ */
@@ -55,48 +55,226 @@
 /*================== Includes =============================================*/
 #include "algo.h"
 
+#include "diag.h"
+#include "mcu.h"
 #include "os.h"
 
 /*================== Macros and Definitions ===============================*/
 
 /*================== Constant and Variable Definitions ====================*/
+/**
+ * time base of the scheduler in ms, incremented by ALGO_TICK_MS in every call of ALGO_MainFunction()
+ */
+static uint32_t algo_time_ms = 0;
+
+/**
+ * algorithms sorted by the time of their next call, the first one is due next
+ */
+static ALGO_TASKS_s *algo_dueList = NULL_PTR;
+
+/**
+ * number of algorithms in state ALGO_RDY_BUT_WAITING, which are executed as
+ * soon as they are set to ALGO_EXECUTE_ASAP
+ */
+static uint16_t algo_nrOfWaiting = 0;
+
+/**
+ * CPU cycles per ms, used to compare the execution time with maxCalcDuration_ms
+ */
+static uint32_t algo_cyclesPerMs = 0;
+
+/**
+ * CPU cycles of ALGO_BACKGROUND_STEP_BUDGET_US
+ */
+static uint32_t algo_stepBudgetCycles = 0;
+
+/**
+ * value of the cycle counter at the start of the current background step
+ */
+static uint32_t algo_stepStartCycles = 0;
 
 /*================== Function Prototypes ==================================*/
+static void ALGO_InsertDue(ALGO_TASKS_s *algo);
+static void ALGO_Release(uint16_t algoIdx);
+static void ALGO_Execute(uint16_t algoIdx);
+static void ALGO_RecordExecution(uint16_t algoIdx, uint32_t cycles, uint8_t overrun);
 
 /*================== Function Implementations =============================*/
+/**
+ * @brief   inserts an algorithm into the list sorted by the time of the next
+ *          call, behind the algorithms that are due at the same time.
+ *
+ * @param   algo    algorithm to be inserted
+ */
+static void ALGO_InsertDue(ALGO_TASKS_s *algo) {
+    ALGO_TASKS_s **position = &algo_dueList;
+
+    while ((*position != NULL_PTR) &&
+            ((int32_t)((*position)->runtime.nextDue_ms - algo->runtime.nextDue_ms) <= 0)) {
+        position = &((*position)->runtime.next);
+    }
+    algo->runtime.next = *position;
+    *position = algo;
+}
+
+
+/**
+ * @brief   starts a call of an algorithm: cyclic algorithms are executed
+ *          immediately, background algorithms are handed over to the
+ *          background task.
+ *
+ * The start time of a background algorithm is the time of its release, so
+ * maxCalcDuration_ms is its deadline.
+ *
+ * @param   algoIdx index of the algorithm in algo_algorithms[]
+ */
+static void ALGO_Release(uint16_t algoIdx) {
+    ALGO_TASKS_s *algo = &algo_algorithms[algoIdx];
+
+    if (algo->context == ALGO_CONTEXT_BACKGROUND) {
+        algo->runtime.jobCycles = 0;
+        algo->runtime.firstStep = TRUE;
+        algo->startTime = OS_getOSSysTick();
+        /* Running until the algorithm has finished all its steps in the background task */
+        algo->state = ALGO_RUNNING;
+    } else {
+        ALGO_Execute(algoIdx);
+    }
+}
+
+
+/**
+ * @brief   calls an algorithm and measures its execution time with the cycle counter.
+ *
+ * @param   algoIdx index of the algorithm in algo_algorithms[]
+ */
+static void ALGO_Execute(uint16_t algoIdx) {
+    ALGO_TASKS_s *algo = &algo_algorithms[algoIdx];
+    uint32_t startCycles = 0;
+    uint32_t cycles = 0;
+
+    /* Set state to running -> reset to READY before leaving algo function */
+    algo->state = ALGO_RUNNING;
+    algo->startTime = OS_getOSSysTick();
+    startCycles = MCU_GetCycleCounter();
+    algo->func(algoIdx);
+    /* Includes the time of preemption by tasks with higher priority */
+    cycles = MCU_GetCycleCounter() - startCycles;
+
+    ALGO_RecordExecution(algoIdx, cycles,
+            ((uint64_t)cycles > ((uint64_t)algo->maxCalcDuration_ms * algo_cyclesPerMs)) ? TRUE : FALSE);
+}
+
+
+/**
+ * @brief   records the execution time of a finished call of an algorithm and
+ *          reports overruns of maxCalcDuration_ms to the diagnosis module.
+ *
+ * @param   algoIdx index of the algorithm in algo_algorithms[]
+ * @param   cycles  execution time in CPU cycles
+ * @param   overrun TRUE if the call took longer than maxCalcDuration_ms
+ */
+static void ALGO_RecordExecution(uint16_t algoIdx, uint32_t cycles, uint8_t overrun) {
+    ALGO_TASKS_s *algo = &algo_algorithms[algoIdx];
+    uint8_t anyOverrun = FALSE;
+
+    OS_TaskEnter_Critical();
+    if ((algo->runtime.calls == 0) || (cycles < algo->runtime.minCycles)) {
+        algo->runtime.minCycles = cycles;
+    }
+    if (cycles > algo->runtime.maxCycles) {
+        algo->runtime.maxCycles = cycles;
+    }
+    algo->runtime.sumCycles += cycles;
+    algo->runtime.calls++;
+    if (overrun == TRUE) {
+        algo->runtime.overruns++;
+    }
+    /* An algorithm blocked by ALGO_MonitorExecutionTime() stays in overrun */
+    if (algo->state != ALGO_BLOCKED) {
+        algo->runtime.overrun = overrun;
+    }
+    for (uint16_t i = 0; i < algo_length; i++) {
+        if (algo_algorithms[i].runtime.overrun == TRUE) {
+            anyOverrun = TRUE;
+        }
+    }
+    OS_TaskExit_Critical();
+
+    if (overrun == FALSE) {
+        /* All algorithms share the channel, it is only healed when no algorithm is in overrun */
+        if (anyOverrun == FALSE) {
+            DIAG_Handler(DIAG_CH_ALGO_OVERRUN, DIAG_EVENT_OK, algoIdx);
+        }
+    } else if (algo->state != ALGO_BLOCKED) {
+        /* Overruns shorter than the monitoring cycle are not blocked by ALGO_MonitorExecutionTime() */
+        DIAG_Handler(DIAG_CH_ALGO_OVERRUN, DIAG_EVENT_NOK, algoIdx);
+    } else {
+        /* Already reported by ALGO_MonitorExecutionTime() */
+    }
+}
+
+
 void ALGO_Init(void) {
-    /* Currently nothing to initialize */
+    MCU_EnableCycleCounter();
+    algo_cyclesPerMs = MCU_GetCoreClock() / 1000u;
+    algo_stepBudgetCycles = (algo_cyclesPerMs / 1000u) * ALGO_BACKGROUND_STEP_BUDGET_US;
+
+    algo_time_ms = 0;
+    algo_dueList = NULL_PTR;
+    algo_nrOfWaiting = 0;
+
+    for (uint16_t i = 0; i < algo_length; i++) {
+        if (algo_algorithms[i].cycleTime_ms == 0) {
+            /* Invalid configuration, the algorithm is never executed */
+            algo_algorithms[i].state = ALGO_BLOCKED;
+            algo_algorithms[i].runtime.overrun = TRUE;
+        } else {
+            algo_algorithms[i].runtime.nextDue_ms = algo_algorithms[i].phase_ms;
+            ALGO_InsertDue(&algo_algorithms[i]);
+        }
+    }
 
     return;
 }
 
 
 void ALGO_MainFunction(void) {
-    static uint32_t counter_ticks = 0;
+    ALGO_TASKS_s *algo = NULL_PTR;
+    uint16_t algoIdx = 0;
 
-    for (uint16_t i = 0; i < algo_length; i++) {
-        if (counter_ticks % algo_algorithms[i].cycleTime_ms == 0) {
-            /* Cycle time elapsed -> call function */
-            if (algo_algorithms[i].state == ALGO_READY) {
-                /* Set state to running -> reset to READY before leaving algo function */
-                algo_algorithms[i].state = ALGO_RUNNING;
-                algo_algorithms[i].startTime = OS_getOSSysTick();
-                algo_algorithms[i].func(i);
-            } else if (algo_algorithms[i].state == ALGO_WAIT_FOR_OTHER) {
-                algo_algorithms[i].state = ALGO_RDY_BUT_WAITING;
-            } else {
-                /* TODO: explain why empty else */
-            }
-        } else if (algo_algorithms[i].state == ALGO_EXECUTE_ASAP) {
+    /* Only the algorithms at the head of the sorted list are due */
+    while ((algo_dueList != NULL_PTR) && ((int32_t)(algo_time_ms - algo_dueList->runtime.nextDue_ms) >= 0)) {
+        algo = algo_dueList;
+        algo_dueList = algo->runtime.next;
+        algoIdx = (uint16_t)(algo - algo_algorithms);
+
+        /* Cycle time elapsed -> call function */
+        if (algo->state == ALGO_READY) {
+            ALGO_Release(algoIdx);
+        } else if (algo->state == ALGO_WAIT_FOR_OTHER) {
+            algo->state = ALGO_RDY_BUT_WAITING;
+            algo_nrOfWaiting++;
+        } else {
+            /* Running, blocked or still waiting for another algorithm: skip this call */
+        }
+
+        /* Cycle times shorter than ALGO_TICK_MS are executed once per tick */
+        do {
+            algo->runtime.nextDue_ms += algo->cycleTime_ms;
+        } while ((int32_t)(algo_time_ms - algo->runtime.nextDue_ms) >= 0);
+        ALGO_InsertDue(algo);
+    }
+
+    for (uint16_t i = 0; (i < algo_length) && (algo_nrOfWaiting > 0); i++) {
+        if (algo_algorithms[i].state == ALGO_EXECUTE_ASAP) {
             /* Waited for other algo to finish -> can now be executed */
-            /* Set state to running -> reset to READY before leaving algo function */
-            algo_algorithms[i].state = ALGO_RUNNING;
-            algo_algorithms[i].startTime = OS_getOSSysTick();
-            algo_algorithms[i].func(i);
+            algo_nrOfWaiting--;
+            ALGO_Release(i);
         }
     }
 
-    counter_ticks += ALGO_TICK_MS;
+    algo_time_ms += ALGO_TICK_MS;
 }
 
 
@@ -104,12 +282,129 @@ void ALGO_MonitorExecutionTime(void) {
     uint32_t timestamp = OS_getOSSysTick();
 
     for (uint16_t i = 0; i < algo_length; i++) {
-        if ((algo_algorithms[i].startTime != 0) && algo_algorithms[i].state == ALGO_RUNNING &&
+        /* Background algorithms are dropped by ALGO_BackgroundFunction() instead, see there */
+        if ((algo_algorithms[i].context == ALGO_CONTEXT_CYCLIC) &&
+                (algo_algorithms[i].startTime != 0) && algo_algorithms[i].state == ALGO_RUNNING &&
                 ((algo_algorithms[i].startTime + algo_algorithms[i].maxCalcDuration_ms) < timestamp)) {
             /* Block task from further execution because of runtime violation, but task will finish its execution */
             algo_algorithms[i].state = ALGO_BLOCKED;
+            algo_algorithms[i].runtime.overrun = TRUE;
 
-            /* TODO: Add diag call to notify error in algorithm module */
+            DIAG_Handler(DIAG_CH_ALGO_OVERRUN, DIAG_EVENT_NOK, i);
         }
     }
 }
+
+
+uint8_t ALGO_BackgroundFunction(void) {
+    ALGO_TASKS_s *algo = NULL_PTR;
+    uint16_t next = algo_length;
+    uint32_t cycles = 0;
+    uint8_t overrun = FALSE;
+
+    /* The released algorithm with the earliest deadline is continued */
+    for (uint16_t i = 0; i < algo_length; i++) {
+        if ((algo_algorithms[i].context == ALGO_CONTEXT_BACKGROUND) && (algo_algorithms[i].state == ALGO_RUNNING)) {
+            if ((next == algo_length) ||
+                    ((int32_t)((algo_algorithms[i].startTime + algo_algorithms[i].maxCalcDuration_ms) -
+                            (algo_algorithms[next].startTime + algo_algorithms[next].maxCalcDuration_ms)) < 0)) {
+                next = i;
+            }
+        }
+    }
+
+    if (next < algo_length) {
+        algo = &algo_algorithms[next];
+
+        if ((OS_getOSSysTick() - algo->startTime) > algo->maxCalcDuration_ms) {
+            /*
+             * Deadline missed: the call is dropped and the algorithm starts
+             * over at its next release, see ALGO_IsFirstStep()
+             */
+            algo->state = ALGO_READY;
+            ALGO_RecordExecution(next, algo->runtime.jobCycles, TRUE);
+        } else {
+            algo_stepStartCycles = MCU_GetCycleCounter();
+            algo->func(next);
+            cycles = MCU_GetCycleCounter() - algo_stepStartCycles;
+            algo->runtime.jobCycles += cycles;
+            algo->runtime.firstStep = FALSE;
+
+            /* The algorithm stays in ALGO_RUNNING until it has finished its last step */
+            if (algo->state != ALGO_RUNNING) {
+                overrun = ((OS_getOSSysTick() - algo->startTime) > algo->maxCalcDuration_ms) ? TRUE : FALSE;
+                ALGO_RecordExecution(next, algo->runtime.jobCycles, overrun);
+            }
+        }
+    }
+
+    return ((next < algo_length) ? TRUE : FALSE);
+}
+
+
+uint8_t ALGO_IsFirstStep(uint32_t algoIdx) {
+    uint8_t retVal = TRUE;
+
+    if ((algoIdx < algo_length) && (algo_algorithms[algoIdx].context == ALGO_CONTEXT_BACKGROUND)) {
+        retVal = algo_algorithms[algoIdx].runtime.firstStep;
+    }
+
+    return retVal;
+}
+
+
+uint8_t ALGO_IsStepBudgetLeft(uint32_t algoIdx) {
+    uint8_t retVal = TRUE;
+
+    if ((algoIdx < algo_length) && (algo_algorithms[algoIdx].context == ALGO_CONTEXT_BACKGROUND)) {
+        if ((MCU_GetCycleCounter() - algo_stepStartCycles) >= algo_stepBudgetCycles) {
+            retVal = FALSE;
+        }
+    }
+
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e ALGO_GetStatistics(uint16_t algoIdx, ALGO_STATISTICS_s *statistics) {
+    STD_RETURN_TYPE_e retVal = E_NOT_OK;
+    uint32_t cyclesPerUs = algo_cyclesPerMs / 1000u;
+    ALGO_RUNTIME_s runtime;
+
+    if (cyclesPerUs == 0) {
+        /* ALGO_Init() not called yet, nothing measured */
+        cyclesPerUs = 1;
+    }
+
+    if (algoIdx < algo_length) {
+        OS_TaskEnter_Critical();
+        runtime = algo_algorithms[algoIdx].runtime;
+        OS_TaskExit_Critical();
+
+        statistics->calls = runtime.calls;
+        statistics->overruns = runtime.overruns;
+        statistics->minTime_us = runtime.minCycles / cyclesPerUs;
+        statistics->maxTime_us = runtime.maxCycles / cyclesPerUs;
+        if (runtime.calls > 0) {
+            statistics->avgTime_us = (uint32_t)(runtime.sumCycles / runtime.calls / cyclesPerUs);
+        } else {
+            statistics->avgTime_us = 0;
+        }
+        retVal = E_OK;
+    }
+
+    return retVal;
+}
+
+
+void ALGO_ResetStatistics(void) {
+    for (uint16_t i = 0; i < algo_length; i++) {
+        OS_TaskEnter_Critical();
+        algo_algorithms[i].runtime.calls = 0;
+        algo_algorithms[i].runtime.overruns = 0;
+        algo_algorithms[i].runtime.minCycles = 0;
+        algo_algorithms[i].runtime.maxCycles = 0;
+        algo_algorithms[i].runtime.sumCycles = 0;
+        OS_TaskExit_Critical();
+    }
+}
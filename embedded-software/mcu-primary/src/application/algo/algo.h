@@ -61,12 +61,24 @@
 
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * Measured execution times of an algorithm, see ALGO_GetStatistics()
+ */
+typedef struct {
+    uint32_t calls;             /*!< number of calls                                    */
+    uint32_t overruns;          /*!< number of calls longer than maxCalcDuration_ms     */
+    uint32_t minTime_us;        /*!< shortest execution time                            */
+    uint32_t avgTime_us;        /*!< mean execution time                                */
+    uint32_t maxTime_us;        /*!< longest execution time                             */
+} ALGO_STATISTICS_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 /*================== Function Prototypes ==================================*/
 /**
  * @brief    initializes local variables and module internals needed to use the algorithm module.
- *           Until now no initialization is needed and thus the function does nothing.
+ *           Sorts the algorithms by the time of their first call (phase) and
+ *           enables the cycle counter used to measure the execution times.
  */
 extern void ALGO_Init(void);
 
@@ -76,10 +88,70 @@ extern void ALGO_Init(void);
 extern void ALGO_MainFunction(void);
 
 /**
- * @brief    monitors the calculation duration of the different algorithms.
+ * @brief    monitors the calculation duration of the algorithms executed in
+ *           the cyclic task and blocks them after a runtime violation.
  */
 extern void ALGO_MonitorExecutionTime(void);
 
+/**
+ * @brief   executes one step of the released background algorithm with the
+ *          earliest deadline (start time + maxCalcDuration_ms).
+ *
+ * Called repeatedly by the background task. An algorithm with context
+ * ALGO_CONTEXT_BACKGROUND is called again in the next step as long as it
+ * leaves its state in ALGO_RUNNING, it sets the state to ALGO_READY after its
+ * last step. The execution time of a call is the sum of its steps.
+ *
+ * A call that has missed its deadline is reported as overrun and dropped
+ * before its next step. The algorithm stays ready and is started over at
+ * its next release, see ALGO_IsFirstStep().
+ *
+ * @return  TRUE if a step has been executed, FALSE if no background algorithm is released
+ */
+extern uint8_t ALGO_BackgroundFunction(void);
+
+/**
+ * @brief   checks if the current step of an algorithm is the first one of its call.
+ *
+ * Resumable algorithms reset the partial results of a previous call in the
+ * first step, as that call may have been dropped after a missed deadline.
+ * Algorithms executed in the cyclic task always get TRUE.
+ *
+ * @param   algoIdx index of the algorithm in algo_algorithms[]
+ *
+ * @return  TRUE in the first step of a call, otherwise FALSE
+ */
+extern uint8_t ALGO_IsFirstStep(uint32_t algoIdx);
+
+/**
+ * @brief   checks if the current step of an algorithm may be continued.
+ *
+ * Resumable algorithms check this between parts of their calculation and
+ * return (staying in ALGO_RUNNING) if the step budget
+ * ALGO_BACKGROUND_STEP_BUDGET_US is used up. Algorithms executed in the
+ * cyclic task always get TRUE, so they finish in one call.
+ *
+ * @param   algoIdx index of the algorithm in algo_algorithms[]
+ *
+ * @return  TRUE if the step may be continued, otherwise FALSE
+ */
+extern uint8_t ALGO_IsStepBudgetLeft(uint32_t algoIdx);
+
+/**
+ * @brief   gets the measured execution times of an algorithm.
+ *
+ * @param   algoIdx     index of the algorithm in algo_algorithms[]
+ * @param   statistics  pointer where the execution times are stored
+ *
+ * @return  E_OK if successful, E_NOT_OK if the index is invalid
+ */
+extern STD_RETURN_TYPE_e ALGO_GetStatistics(uint16_t algoIdx, ALGO_STATISTICS_s *statistics);
+
+/**
+ * @brief   clears the measured execution times of all algorithms.
+ */
+extern void ALGO_ResetStatistics(void);
+
 
 /*================== Function Implementations =============================*/
 
@@ -72,7 +72,6 @@
 /*================== Constant and Variable Definitions ====================*/
 static DATA_BLOCK_MINMAX_s bal_minmax;
 static DATA_BLOCK_BALANCING_CONTROL_s bal_balancing;
-static DATA_BLOCK_CELLVOLTAGE_s bal_cellvoltage;
 DATA_BLOCK_STATEREQUEST_s bal_request;
 
 /**
@@ -105,11 +104,15 @@ static uint8_t BAL_CheckReEntrance(void);
 
 static void BAL_Init(void);
 static void BAL_Deactivate(void);
+static STD_RETURN_TYPE_e BAL_Evaluate_CellVoltages(uint8_t (*evaluate)(const DATA_BLOCK_CELLVOLTAGE_s *), uint8_t *result);
 #if BALANCING_VOLTAGE_BASED == TRUE
+static uint8_t BAL_Evaluate_Balancing_Voltage(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage);
 static uint8_t BAL_Activate_Balancing_Voltage(void);
 #else
 static uint8_t BAL_Check_Imbalances(void);
-static void BAL_Compute_Imbalances(void);
+static uint8_t BAL_Evaluate_Imbalances(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage);
+static STD_RETURN_TYPE_e BAL_Compute_Imbalances(void);
+static uint8_t BAL_Evaluate_Balancing_History(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage);
 static void BAL_Activate_Balancing_History(void);
 #endif
 
@@ -139,32 +142,70 @@ static void BAL_Deactivate(void) {
     DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
 }
 
+/**
+ * @brief   evaluates the cell voltages without copying them
+ *
+ * The cell voltages are borrowed from the database and passed to evaluate().
+ * The borrowed buffer is pinned, so the cell voltages do not change during the
+ * evaluation. evaluate() must not change bal_state, the caller applies the
+ * result.
+ *
+ * @param   evaluate    evaluation function
+ * @param   result      return value of evaluate()
+ *
+ * @return  E_OK if evaluate() was called, E_NOT_OK if the cell voltages could not be borrowed
+ */
+static STD_RETURN_TYPE_e BAL_Evaluate_CellVoltages(uint8_t (*evaluate)(const DATA_BLOCK_CELLVOLTAGE_s *), uint8_t *result) {
+    DATA_BLOCK_BORROW_s cellvoltage_borrow;
+
+    if (DB_BorrowBlock(&cellvoltage_borrow, DATA_BLOCK_ID_CELLVOLTAGE) != E_OK) {
+        return E_NOT_OK;
+    }
+    *result = evaluate((const DATA_BLOCK_CELLVOLTAGE_s *)cellvoltage_borrow.dataptr);
+    (void)DB_ReleaseBlock(&cellvoltage_borrow);
+
+    return E_OK;
+}
+
 #if BALANCING_VOLTAGE_BASED == TRUE
 
-static uint8_t BAL_Activate_Balancing_Voltage(void) {
+static uint8_t BAL_Evaluate_Balancing_Voltage(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage) {
     uint32_t i = 0;
     uint16_t min = 0;
     uint8_t finished = TRUE;
 
     DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
     DB_ReadBlock(&bal_minmax, DATA_BLOCK_ID_MINMAX);
 
 
     min = bal_minmax.voltage_min;
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
-        if (bal_cellvoltage.voltage[i] > min+bal_state.balancing_threshold) {
+        if (cellvoltage->voltage[i] > min+bal_state.balancing_threshold) {
             bal_balancing.balancing_state[i] = 1;
             finished = FALSE;
-            bal_state.balancing_threshold = BAL_THRESHOLD_MV;
-            bal_state.active = TRUE;
             bal_balancing.enable_balancing = 1;
         } else {
             bal_balancing.balancing_state[i] = 0;
         }
     }
 
+    return finished;
+}
+
+static uint8_t BAL_Activate_Balancing_Voltage(void) {
+    uint8_t finished = TRUE;
+
+    if (BAL_Evaluate_CellVoltages(BAL_Evaluate_Balancing_Voltage, &finished) != E_OK) {
+        /* Cell voltages currently not available, try again next cycle */
+        return FALSE;
+    }
+
+    if (finished == FALSE) {
+        bal_state.balancing_threshold = BAL_THRESHOLD_MV;
+        bal_state.active = TRUE;
+    }
+
     bal_balancing.previous_timestamp = bal_balancing.timestamp;
     bal_balancing.timestamp = OS_getOSSysTick();
     DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
@@ -189,7 +230,7 @@ static uint8_t BAL_Check_Imbalances(void) {
     return retVal;
 }
 
-static void BAL_Compute_Imbalances(void) {
+static uint8_t BAL_Evaluate_Imbalances(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage) {
     uint16_t i = 0;
     uint16_t voltageMin = 0;
     uint16_t minVoltageIndex = 0;
@@ -198,42 +239,55 @@ static void BAL_Compute_Imbalances(void) {
     uint32_t maxDOD = 0.0;
 
     DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    DB_ReadBlock(&bal_minmax, DATA_BLOCK_ID_MINMAX);
 
-    voltageMin = bal_cellvoltage.voltage[0];
+    voltageMin = cellvoltage->voltage[0];
     minVoltageIndex = 0;
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
-        if (bal_cellvoltage.voltage[i] <= voltageMin) {
-            voltageMin = bal_cellvoltage.voltage[i];
+        if (cellvoltage->voltage[i] <= voltageMin) {
+            voltageMin = cellvoltage->voltage[i];
             minVoltageIndex = i;
         }
     }
 
-    SOC = SOC_GetFromVoltage(((float)(bal_cellvoltage.voltage[minVoltageIndex]))/1000.0);
+    SOC = SOC_GetFromVoltage(cellvoltage->voltage[minVoltageIndex], bal_minmax.temperature_mean) / 100.0f;
     maxDOD = BC_CAPACITY * (uint32_t)((1.0 - SOC) * 3600.0);
     bal_balancing.delta_charge[minVoltageIndex] = 0;
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
         if (i != minVoltageIndex) {
-            if (bal_cellvoltage.voltage[i] >= voltageMin + bal_state.balancing_threshold) {
-                SOC = SOC_GetFromVoltage(((float)(bal_cellvoltage.voltage[i]))/1000.0);
+            if (cellvoltage->voltage[i] >= voltageMin + bal_state.balancing_threshold) {
+                SOC = SOC_GetFromVoltage(cellvoltage->voltage[i], bal_minmax.temperature_mean) / 100.0f;
                 DOD = BC_CAPACITY * (uint32_t)((1.0 - SOC) * 3600.0);
                 bal_balancing.delta_charge[i] = (maxDOD - DOD);
             }
         }
     }
 
+    return TRUE;
+}
+
+static STD_RETURN_TYPE_e BAL_Compute_Imbalances(void) {
+    uint8_t computed = FALSE;
+
+    if (BAL_Evaluate_CellVoltages(BAL_Evaluate_Imbalances, &computed) != E_OK) {
+        /* Cell voltages currently not available, try again next cycle */
+        return E_NOT_OK;
+    }
+
     DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
+
+    return E_OK;
 }
 
-static void BAL_Activate_Balancing_History(void) {
+static uint8_t BAL_Evaluate_Balancing_History(const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage) {
     uint16_t i;
     float cellBalancingCurrent;
     uint32_t difference;
+    uint8_t active = FALSE;
 
     DB_ReadBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
-    DB_ReadBlock(&bal_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
 
     for (i=0; i < BS_NR_OF_BAT_CELLS; i++) {
         if (bal_state.balancing_allowed == FALSE) {
@@ -241,9 +295,9 @@ static void BAL_Activate_Balancing_History(void) {
         } else {
             if (bal_balancing.delta_charge[i] > 0) {
                 bal_balancing.balancing_state[i] = 1;
-                cellBalancingCurrent = ((float)(bal_cellvoltage.voltage[i]))/BS_BALANCING_RESISTANCE_OHM;
+                cellBalancingCurrent = ((float)(cellvoltage->voltage[i]))/BS_BALANCING_RESISTANCE_OHM;
                 difference = (BAL_STATEMACH_BALANCINGTIME_100MS/10) * (uint32_t)(cellBalancingCurrent);
-                bal_state.active = TRUE;
+                active = TRUE;
                 bal_balancing.enable_balancing = 1;
                 /* we are working with unsigned integers */
                 if (difference > bal_balancing.delta_charge[i]) {
@@ -257,6 +311,21 @@ static void BAL_Activate_Balancing_History(void) {
         }
     }
 
+    return active;
+}
+
+static void BAL_Activate_Balancing_History(void) {
+    uint8_t active = FALSE;
+
+    if (BAL_Evaluate_CellVoltages(BAL_Evaluate_Balancing_History, &active) != E_OK) {
+        /* Cell voltages currently not available, try again next cycle */
+        return;
+    }
+
+    if (active == TRUE) {
+        bal_state.active = TRUE;
+    }
+
     DB_WriteBlock(&bal_balancing, DATA_BLOCK_ID_BALANCING_CONTROL_VALUES);
 }
 
@@ -489,9 +558,11 @@ void BAL_Trigger(void) {
                 break;
             } else if (bal_state.substate == BAL_COMPUTE_IMBALANCES) {
                 if (BMS_GetBatterySystemState() == BMS_AT_REST) {
-                    BAL_Compute_Imbalances();
-                    bal_state.state = BAL_STATEMACH_BALANCE;
-                    bal_state.substate = BAL_ENTRY;
+                    /* stay in this substate until the imbalances could be computed */
+                    if (BAL_Compute_Imbalances() == E_OK) {
+                        bal_state.state = BAL_STATEMACH_BALANCE;
+                        bal_state.substate = BAL_ENTRY;
+                    }
                 } else {
                     bal_state.substate = BAL_CHECK_IMBALANCES;
                 }
@@ -62,6 +62,10 @@
 #if BUILD_MODULE_ENABLE_CONTACTOR == 1
 #include "contactor.h"
 #endif
+#include "algo.h"
+#include "database.h"
+#include "database_history.h"
+#include "ltc.h"
 #include "mcu.h"
 #include "nvram_cfg.h"
 #include "os.h"
@@ -80,6 +84,15 @@
 
 static char com_receivedbyte[UART_COM_RECEIVEBUFFER_LENGTH];
 
+#if DATA_HISTORY_NR > 0
+/**
+ * @brief Number of history bytes printed per call of COM_printDatabaseHistory()
+ *
+ * One line per call keeps the UART transmit buffer from overflowing.
+ */
+#define COM_HISTORY_BYTES_PER_LINE  32u
+#endif /* DATA_HISTORY_NR > 0 */
+
 /*================== Constant and Variable Definitions ====================*/
 uint8_t printHelp = 0;
 
@@ -89,6 +102,12 @@ static uint32_t com_tickcount = 0;
 static RTC_Time_s com_Time;
 static RTC_Date_s com_Date;
 
+#if DATA_HISTORY_NR > 0
+static uint8_t com_history_dump = 0;        /* 1 while the database history is printed */
+static uint8_t com_history_idx = 0;         /* history ring that is printed */
+static uint32_t com_history_offset = 0;     /* next byte of the history ring that is printed */
+#endif /* DATA_HISTORY_NR > 0 */
+
 #if BUILD_MODULE_ENABLE_RUNTIMESTATS == 1
 /**
  * @brief Array for the task list of runtime stats.
@@ -99,6 +118,11 @@ static TaskStatus_t pxTaskStatusArray[COM_RUNTIMESTATS_MAXTASK * sizeof(TaskStat
 /*================== Function Prototypes ==================================*/
 
 static void COM_getRunTime();
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+static void COM_printDatabaseStatistics(void);
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+static void COM_printLtcJobStatistics(void);
+static void COM_printAlgoStatistics(void);
 /*================== Function Implementations =============================*/
 /* Secondary MCU has no SOX module so setting the SOC leads to an error */
 __attribute__((weak)) void SOC_SetValue(float v1, float v2, float v3) {
@@ -194,6 +218,119 @@ void COM_printRuntimeStats(void) {
 }
 #endif
 
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+/**
+ * @brief prints the access statistics of the database
+ *
+ * The data block with the most writes is marked, as it is the most likely
+ * source of a congested data queue.
+ */
+static void COM_printDatabaseStatistics(void) {
+    static DATA_STATISTICS_s com_db_statistics;
+    uint8_t hotBlock = 0;
+
+    DB_GetStatistics(&com_db_statistics);
+
+    for (uint8_t i = 0; i < DATA_MAX_BLOCK_NR; i++) {
+        if (com_db_statistics.block[i].writes > com_db_statistics.block[hotBlock].writes) {
+            hotBlock = i;
+        }
+    }
+
+    printf("Block       Reads      Writes\r\n");
+    for (uint8_t i = 0; i < DATA_MAX_BLOCK_NR; i++) {
+        printf("%5u  %10lu  %10lu%s\r\n", i, com_db_statistics.block[i].reads,
+                com_db_statistics.block[i].writes, (i == hotBlock) ? "  <- most writes" : "");
+    }
+    printf("Bytes copied:     %lu\r\n", com_db_statistics.bytes_copied);
+    printf("Queue full drops: %lu\r\n", com_db_statistics.queue_full_drops);
+    printf("Max queue wait:   %lu ms\r\n", com_db_statistics.max_queue_wait);
+}
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
+/**
+ * @brief prints the achieved periods of the LTC measurement jobs
+ */
+static void COM_printLtcJobStatistics(void) {
+    static LTC_JOB_STATISTICS_s com_ltc_job_statistics[LTC_JOB_NR_OF_JOBS];
+    static const char *jobNames[LTC_JOB_NR_OF_JOBS] = {
+        "VOLTAGE", "MUX_SEQUENCE", "BALANCECONTROL", "BALANCEFEEDBACK",
+        "TEMP_SENS", "USER_IO", "EEPROM", "OPENWIRE_CHECK",
+    };
+
+    LTC_GetJobStatistics(com_ltc_job_statistics);
+
+    printf("Job                  Starts  Period  MaxPeriod  MaxLatency  Misses  MaxSlice\r\n");
+    for (uint8_t i = 0; i < LTC_JOB_NR_OF_JOBS; i++) {
+        printf("%-15s  %10lu  %6lu  %9lu  %10lu  %6lu  %8u\r\n", jobNames[i],
+                com_ltc_job_statistics[i].starts, com_ltc_job_statistics[i].lastPeriod_ms,
+                com_ltc_job_statistics[i].maxPeriod_ms, com_ltc_job_statistics[i].maxLatency_ms,
+                com_ltc_job_statistics[i].deadlineMisses, com_ltc_job_statistics[i].maxSliceTime_ms);
+    }
+}
+
+static void COM_printAlgoStatistics(void) {
+    ALGO_STATISTICS_s statistics;
+
+    printf("Algorithm       Calls  Overruns  MinTime  AvgTime  MaxTime\r\n");
+    for (uint16_t i = 0; i < algo_length; i++) {
+        (void)ALGO_GetStatistics(i, &statistics);
+        printf("%9u  %10lu  %8lu  %7lu  %7lu  %7lu\r\n", i,
+                statistics.calls, statistics.overruns,
+                statistics.minTime_us, statistics.avgTime_us, statistics.maxTime_us);
+    }
+}
+
+void COM_printDatabaseHistory(void) {
+#if DATA_HISTORY_NR > 0
+    static uint8_t com_history_buffer[COM_HISTORY_BYTES_PER_LINE];
+    static char com_history_line[(2 * COM_HISTORY_BYTES_PER_LINE) + 1];
+    static const char hexdigits[] = "0123456789ABCDEF";
+    DATA_HISTORY_STATUS_s status;
+    DATA_HISTORY_INFO_s info;
+    uint16_t length = 0;
+
+    if (com_history_dump == 0)
+        return;
+
+    /* Records can only be read after the post-trigger time */
+    DB_GetHistoryStatus(&status);
+    if (status.state != DATA_HISTORY_FROZEN)
+        return;
+
+    if (com_history_idx >= DATA_HISTORY_NR) {
+        printf("HISTORY END\r\n");
+        com_history_dump = 0;
+        return;
+    }
+
+    if (com_history_offset == 0) {
+        if (com_history_idx == 0) {
+            printf("HISTORY TRIGGER %lu AT %lu\r\n", status.trigger, status.triggerTimestamp);
+        }
+        DB_GetHistoryInfo(com_history_idx, &info);
+        printf("HISTORY %u BLOCK %u LENGTH %u BYTES %lu RECORDS %lu\r\n", com_history_idx, info.blockID,
+                info.datalength, info.length, info.records);
+    }
+
+    length = DB_ReadHistory(com_history_idx, com_history_offset, com_history_buffer, COM_HISTORY_BYTES_PER_LINE);
+    if (length == 0) {
+        /* Ring completely printed, continue with next one */
+        com_history_idx++;
+        com_history_offset = 0;
+        return;
+    }
+
+    for (uint16_t i = 0; i < length; i++) {
+        com_history_line[2 * i] = hexdigits[com_history_buffer[i] >> 4];
+        com_history_line[(2 * i) + 1] = hexdigits[com_history_buffer[i] & 0x0F];
+    }
+    com_history_line[2 * length] = '\0';
+    printf("%08lX:%s\r\n", com_history_offset, com_history_line);
+    com_history_offset += length;
+#endif /* DATA_HISTORY_NR > 0 */
+}
+
 void COM_printHelpCommand(void) {
     if (printHelp == 0)
         return;
@@ -209,6 +346,19 @@ void COM_printHelpCommand(void) {
     printf("printdiaginfo         get diagnosis entries of DIAG module (entries can only be printed once)\r\n");
     printf("printcontactorinfo    get contactor information (number of switches/hard switches) (entries can only be printed once)\r\n");
     printf("printstats            get the FreeRTOS runtime statistics\r\n");
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    printf("printdbstats          get the access statistics of the database\r\n");
+    printf("resetdbstats          reset the access statistics of the database\r\n");
+#endif
+#if DATA_HISTORY_NR > 0
+    printf("freezehistory         stop recording the database history after the post-trigger time\r\n");
+    printf("dumphistory           print the records of the frozen database history (freezes it if necessary)\r\n");
+    printf("restarthistory        discard the database history and restart recording\r\n");
+#endif
+    printf("printltcjobs          get the achieved periods of the LTC measurement jobs in ms\r\n");
+    printf("resetltcjobs          reset the statistics of the LTC measurement jobs\r\n");
+    printf("printalgo             get the execution times of the algorithms in us\r\n");
+    printf("resetalgo             reset the execution times of the algorithms\r\n");
     printf("teston                enable testmode, testmode will be disabled after a predefined timeout of 30s when no new command is sent\r\n");
     printf("====================  ========================================================================================================\r\n");
 
@@ -452,6 +602,47 @@ void COM_Decoder(void) {
         /* Print diag info */
         DIAG_PrintErrors();
         commandValid = 1;
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    } else if (strncmp(com_receivedbyte, "printdbstats", 12) == 0) { /* PRINT DATABASE STATISTICS */
+        COM_printDatabaseStatistics();
+        commandValid = 1;
+    } else if (strncmp(com_receivedbyte, "resetdbstats", 12) == 0) { /* RESET DATABASE STATISTICS */
+        DB_ResetStatistics();
+        printf("Database statistics reset!\r\n");
+        commandValid = 1;
+#endif
+#if DATA_HISTORY_NR > 0
+    } else if (strncmp(com_receivedbyte, "freezehistory", 13) == 0) { /* FREEZE DATABASE HISTORY */
+        DB_TriggerHistoryFreeze(DATA_HISTORY_TRIGGER_MANUAL);
+        printf("Database history freeze triggered!\r\n");
+        commandValid = 1;
+    } else if (strncmp(com_receivedbyte, "dumphistory", 11) == 0) { /* PRINT DATABASE HISTORY */
+        /* Printed by COM_printDatabaseHistory() as soon as the history is frozen */
+        DB_TriggerHistoryFreeze(DATA_HISTORY_TRIGGER_MANUAL);
+        com_history_idx = 0;
+        com_history_offset = 0;
+        com_history_dump = 1;
+        commandValid = 1;
+    } else if (strncmp(com_receivedbyte, "restarthistory", 14) == 0) { /* RESTART DATABASE HISTORY */
+        com_history_dump = 0;
+        DB_RestartHistory();
+        printf("Database history restarted!\r\n");
+        commandValid = 1;
+#endif
+    } else if (strncmp(com_receivedbyte, "printltcjobs", 12) == 0) { /* PRINT LTC JOB STATISTICS */
+        COM_printLtcJobStatistics();
+        commandValid = 1;
+    } else if (strncmp(com_receivedbyte, "resetltcjobs", 12) == 0) { /* RESET LTC JOB STATISTICS */
+        LTC_ResetJobStatistics();
+        printf("LTC job statistics reset!\r\n");
+        commandValid = 1;
+    } else if (strncmp(com_receivedbyte, "printalgo", 9) == 0) { /* PRINT ALGORITHM EXECUTION TIMES */
+        COM_printAlgoStatistics();
+        commandValid = 1;
+    } else if (strncmp(com_receivedbyte, "resetalgo", 9) == 0) { /* RESET ALGORITHM EXECUTION TIMES */
+        ALGO_ResetStatistics();
+        printf("Algorithm statistics reset!\r\n");
+        commandValid = 1;
     } else if (strncmp(com_receivedbyte, "gettime", 7) == 0) {  /* GETTIME */
         /* Print time and date */
        COM_printTimeAndDate();
@@ -53,117 +53,128 @@
 /*================== Includes =============================================*/
 #include "algo_cfg.h"
 
+#include "algo.h"
 #include "database.h"
+#include "movstat.h"
+#include "sox.h"
 
 /*================== Macros and Definitions ===============================*/
+/** @{
+ * time between two samples of the moving averages. The algorithm does not see
+ * samples that are faster than its cycle time.
+ */
 #if ALGO_TICK_MS > ISA_CURRENT_CYCLE_TIME_MS
-#define NMBR_AVERAGES_CUR_1s           1000/ALGO_TICK_MS
-#define NMBR_AVERAGES_CUR_5s           5000/ALGO_TICK_MS
-#define NMBR_AVERAGES_CUR_10s          10000/ALGO_TICK_MS
-#define NMBR_AVERAGES_CUR_30s          30000/ALGO_TICK_MS
-#define NMBR_AVERAGES_CUR_60s          60000/ALGO_TICK_MS
-#define NMBR_AVERAGES_CUR_cfg          MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS
+#define ALGO_CURRENT_SAMPLE_TIME_MS     ALGO_TICK_MS
 #else
-#define NMBR_AVERAGES_CUR_1s           1000/ISA_CURRENT_CYCLE_TIME_MS
-#define NMBR_AVERAGES_CUR_5s           5000/ISA_CURRENT_CYCLE_TIME_MS
-#define NMBR_AVERAGES_CUR_10s          10000/ISA_CURRENT_CYCLE_TIME_MS
-#define NMBR_AVERAGES_CUR_30s          30000/ISA_CURRENT_CYCLE_TIME_MS
-#define NMBR_AVERAGES_CUR_60s          60000/ISA_CURRENT_CYCLE_TIME_MS
-#define NMBR_AVERAGES_CUR_cfg          MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS
+#define ALGO_CURRENT_SAMPLE_TIME_MS     ISA_CURRENT_CYCLE_TIME_MS
 #endif
 
 #if ALGO_TICK_MS > ISA_POWER_CYCLE_TIME_MS
-#define NMBR_AVERAGES_POW_1s           1000/ALGO_TICK_MS
-#define NMBR_AVERAGES_POW_5s           5000/ALGO_TICK_MS
-#define NMBR_AVERAGES_POW_10s          10000/ALGO_TICK_MS
-#define NMBR_AVERAGES_POW_30s          30000/ALGO_TICK_MS
-#define NMBR_AVERAGES_POW_60s          60000/ALGO_TICK_MS
-#define NMBR_AVERAGES_POW_cfg          MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS
+#define ALGO_POWER_SAMPLE_TIME_MS       ALGO_TICK_MS
 #else
-#define NMBR_AVERAGES_POW_1s           1000/ISA_POWER_CYCLE_TIME_MS
-#define NMBR_AVERAGES_POW_5s           5000/ISA_POWER_CYCLE_TIME_MS
-#define NMBR_AVERAGES_POW_10s          10000/ISA_POWER_CYCLE_TIME_MS
-#define NMBR_AVERAGES_POW_30s          30000/ISA_POWER_CYCLE_TIME_MS
-#define NMBR_AVERAGES_POW_60s          60000/ISA_POWER_CYCLE_TIME_MS
-#define NMBR_AVERAGES_POW_cfg          MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS
+#define ALGO_POWER_SAMPLE_TIME_MS       ISA_POWER_CYCLE_TIME_MS
 #endif
+/** @} */
 
-/*================== Constant and Variable Definitions ====================*/
-
-/* Arrays in extern SDRAM to calculate moving mean current and power */
-
-/* Check if minimum algo cycle time > current sensor sample time */
-#if ALGO_TICK_MS > ISA_CURRENT_CYCLE_TIME_MS
-#if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS > 60000/ALGO_TICK_MS
-/* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS)+1] = {};
-static uint32_t movMeanCurLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_TICK_MS)+1;
-#else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM curValues[(60000/ALGO_TICK_MS)+1] = {};
-static uint32_t movMeanCurLength = (60000/ALGO_TICK_MS)+1;
-#endif
-#else
-/* If array length of configured time > 60s array take this array size */
-#if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS > 60000/ISA_CURRENT_CYCLE_TIME_MS
-static float MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS)+1] = {};
-static uint32_t movMeanCurLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ISA_CURRENT_CYCLE_TIME_MS)+1;
+/** @{
+ * length of the rings of the moving averages: longest window (60s or the
+ * configured duration) plus one sample
+ */
+#if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS > 60000
+#define ALGO_CURRENT_RING_LENGTH        ((MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_CURRENT_SAMPLE_TIME_MS) + 1)
 #else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM curValues[(60000/ISA_CURRENT_CYCLE_TIME_MS)+1] = {};
-static uint32_t movMeanCurLength = (60000/ISA_CURRENT_CYCLE_TIME_MS)+1;
-#endif
+#define ALGO_CURRENT_RING_LENGTH        ((60000 / ALGO_CURRENT_SAMPLE_TIME_MS) + 1)
 #endif
 
-/* Check if minimum algo cycle time > current sensor sample time */
-#if ALGO_TICK_MS > ISA_POWER_CYCLE_TIME_MS
-#if MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS > 60000/ALGO_TICK_MS
-/* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS)+1] = {};
-static uint32_t movMeanPowLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_TICK_MS)+1;
+#if MOVING_AVERAGE_DURATION_POWER_CONFIG_MS > 60000
+#define ALGO_POWER_RING_LENGTH          ((MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ALGO_POWER_SAMPLE_TIME_MS) + 1)
 #else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM powValues[(60000/ALGO_TICK_MS)+1] = {};
-static uint32_t movMeanPowLength = (60000/ALGO_TICK_MS)+1;
-#endif
-#else
-#if MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS > 60000/ISA_POWER_CYCLE_TIME_MS
-/* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS)+1] = {};
-static uint32_t movMeanPowLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ISA_POWER_CYCLE_TIME_MS)+1;
-#else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM powValues[(60000/ISA_POWER_CYCLE_TIME_MS)+1] = {};
-static uint32_t movMeanPowLength = (60000/ISA_POWER_CYCLE_TIME_MS)+1;
-#endif
+#define ALGO_POWER_RING_LENGTH          ((60000 / ALGO_POWER_SAMPLE_TIME_MS) + 1)
 #endif
+/** @} */
 
+/**
+ * number of Kalman filters of the SOC updated between two checks of the step budget
+ */
+#define ALGO_SOC_ESTIMATION_FILTERS_PER_CALL    32u
 
-/* Pointer for current moving mean calculation */
-static float *ptrMovMeanCur_new = &curValues[0];
-static float *ptrMovMeanCur_1s = &curValues[0];
-static float *ptrMovMeanCur_5s = &curValues[0];
-static float *ptrMovMeanCur_10s = &curValues[0];
-static float *ptrMovMeanCur_30s = &curValues[0];
-static float *ptrMovMeanCur_60s = &curValues[0];
-static float *ptrMovMeanCur_cfg = &curValues[0];
-
-/* Pointer for power moving mean calculation */
-static float *ptrMovMeanPow_new = &powValues[0];
-static float *ptrMovMeanPow_1s = &powValues[0];
-static float *ptrMovMeanPow_5s = &powValues[0];
-static float *ptrMovMeanPow_10s = &powValues[0];
-static float *ptrMovMeanPow_30s = &powValues[0];
-static float *ptrMovMeanPow_60s = &powValues[0];
-static float *ptrMovMeanPow_cfg = &powValues[0];
+/*================== Constant and Variable Definitions ====================*/
+
+/* Rings of prefix sums in extern SDRAM to calculate moving mean current and power */
+static uint64_t MEM_EXT_SDRAM curPrefixSums[ALGO_CURRENT_RING_LENGTH];
+static uint64_t MEM_EXT_SDRAM powPrefixSums[ALGO_POWER_RING_LENGTH];
+
+/**
+ * windows of the moving mean current, in the order of DATA_BLOCK_MOVING_AVERAGE_s
+ */
+static MOVSTAT_WINDOW_s curWindows[] = {
+    { .length = 1000/ALGO_CURRENT_SAMPLE_TIME_MS },
+    { .length = 5000/ALGO_CURRENT_SAMPLE_TIME_MS },
+    { .length = 10000/ALGO_CURRENT_SAMPLE_TIME_MS },
+    { .length = 30000/ALGO_CURRENT_SAMPLE_TIME_MS },
+    { .length = 60000/ALGO_CURRENT_SAMPLE_TIME_MS },
+    { .length = MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS/ALGO_CURRENT_SAMPLE_TIME_MS },
+};
+
+/**
+ * windows of the moving mean power, in the order of DATA_BLOCK_MOVING_AVERAGE_s
+ */
+static MOVSTAT_WINDOW_s powWindows[] = {
+    { .length = 1000/ALGO_POWER_SAMPLE_TIME_MS },
+    { .length = 5000/ALGO_POWER_SAMPLE_TIME_MS },
+    { .length = 10000/ALGO_POWER_SAMPLE_TIME_MS },
+    { .length = 30000/ALGO_POWER_SAMPLE_TIME_MS },
+    { .length = 60000/ALGO_POWER_SAMPLE_TIME_MS },
+    { .length = MOVING_AVERAGE_DURATION_POWER_CONFIG_MS/ALGO_POWER_SAMPLE_TIME_MS },
+};
+
+static MOVSTAT_s curMovStat = {
+    .prefixSum = curPrefixSums,
+    .prefixSumSquares = NULL_PTR,
+    .ringLength = ALGO_CURRENT_RING_LENGTH,
+    .windows = curWindows,
+    .nrOfWindows = sizeof(curWindows)/sizeof(curWindows[0]),
+};
+
+static MOVSTAT_s powMovStat = {
+    .prefixSum = powPrefixSums,
+    .prefixSumSquares = NULL_PTR,
+    .ringLength = ALGO_POWER_RING_LENGTH,
+    .windows = powWindows,
+    .nrOfWindows = sizeof(powWindows)/sizeof(powWindows[0]),
+};
 
 /*================== Function Prototypes ==================================*/
 static void algo_movAverage(uint32_t algoIdx);
+static void algo_socEstimation(uint32_t algoIdx);
 
 /*================== Function Implementations =============================*/
 
+/*
+ * Algorithms with a cycle time longer than ALGO_TICK_MS should get different
+ * phases (multiples of ALGO_TICK_MS), so that they are not executed in the
+ * same tick. For algorithms executed in the background task,
+ * maxCalcDuration_ms is the deadline after the release by ALGO_MainFunction().
+ */
 ALGO_TASKS_s algo_algorithms[] = {
-    {ALGO_READY, 100, 1000, 0, &algo_movAverage },
+    {
+        .state = ALGO_READY,
+        .cycleTime_ms = 100,
+        .phase_ms = 0,
+        .maxCalcDuration_ms = 1000,
+        .startTime = 0,
+        .func = &algo_movAverage,
+        .context = ALGO_CONTEXT_CYCLIC,
+    },
+    {
+        .state = ALGO_READY,
+        .cycleTime_ms = 100,
+        .phase_ms = 0,
+        .maxCalcDuration_ms = 90,
+        .startTime = 0,
+        .func = &algo_socEstimation,
+        .context = ALGO_CONTEXT_BACKGROUND,
+    },
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms)/sizeof(algo_algorithms[0]);
@@ -174,10 +185,15 @@ static void algo_movAverage(uint32_t algoIdx) {
     static uint8_t powCounter = 0;
     static DATA_BLOCK_CURRENT_SENSOR_s curPow_tab;
     static DATA_BLOCK_MOVING_AVERAGE_s movMean_tab;
-    static uint8_t curInit = 0;     /* bit0: 1s, bit1: 5s, bit2: 10s, bit3: 30s, bit4: 60s, bit5: cfg */
-    static uint8_t powInit = 0;     /* bit0: 1s, bit1: 5s, bit2: 10s, bit3: 30s, bit4: 60s, bit5: cfg */
+    static uint8_t initialized = FALSE;
     static uint8_t newValues = 0;
-    float divider = 0;
+
+    if (initialized == FALSE) {
+        /* The rings in SDRAM are cleared here, the window configuration is fixed */
+        (void)MOVSTAT_Init(&curMovStat);
+        (void)MOVSTAT_Init(&powMovStat);
+        initialized = TRUE;
+    }
 
     DB_ReadBlock(&curPow_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
     DB_ReadBlock(&movMean_tab, DATA_BLOCK_ID_MOV_AVERAGE);
@@ -191,89 +207,14 @@ static void algo_movAverage(uint32_t algoIdx) {
             /* new Values -> Save later in database */
             newValues = 1;
 
-            /* Add value to array and calculate new moving mean values */
-            *ptrMovMeanCur_new = curPow_tab.current;
-
-            /* Calculate new moving means - first add new value */
-            divider = NMBR_AVERAGES_CUR_1s;
-            movMean_tab.movAverage_current_1s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_5s;
-            movMean_tab.movAverage_current_5s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_10s;
-            movMean_tab.movAverage_current_10s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_30s;
-            movMean_tab.movAverage_current_30s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_60s;
-            movMean_tab.movAverage_current_60s += (*ptrMovMeanCur_new)/divider;
-            divider = NMBR_AVERAGES_CUR_cfg;
-            movMean_tab.movAverage_current_config += (*ptrMovMeanCur_new)/divider;
-
-            /* Then, increment pointer and substract oldest value when respective window is filled with data */
-            ptrMovMeanCur_new++;
-            if ((curInit & 0x01) == 0x01) {
-                divider = NMBR_AVERAGES_CUR_1s;
-                movMean_tab.movAverage_current_1s -= ((*ptrMovMeanCur_1s)/divider);
-                ptrMovMeanCur_1s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_1s])
-                    curInit |= 0x01;
-            }
-            if ((curInit & 0x02) == 0x02) {
-                divider = NMBR_AVERAGES_CUR_5s;
-                movMean_tab.movAverage_current_5s -= (*ptrMovMeanCur_5s)/divider;
-                ptrMovMeanCur_5s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_5s])
-                    curInit |= 0x02;
-            }
-            if ((curInit & 0x04) == 0x04) {
-                divider = NMBR_AVERAGES_CUR_10s;
-                movMean_tab.movAverage_current_10s -= (*ptrMovMeanCur_10s)/divider;
-                ptrMovMeanCur_10s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_10s])
-                    curInit |= 0x04;
-            }
-            if ((curInit & 0x08) == 0x08) {
-                divider = NMBR_AVERAGES_CUR_30s;
-                movMean_tab.movAverage_current_30s -= (*ptrMovMeanCur_30s)/divider;
-                ptrMovMeanCur_30s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_30s])
-                    curInit |= 0x08;
-            }
-            if ((curInit & 0x10) == 0x10) {
-                divider = NMBR_AVERAGES_CUR_60s;
-                movMean_tab.movAverage_current_60s -= (*ptrMovMeanCur_60s)/divider;
-                ptrMovMeanCur_60s++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_60s])
-                    curInit |= 0x10;
-            }
-            if ((curInit & 0x20) == 0x20) {
-                divider = NMBR_AVERAGES_CUR_cfg;
-                movMean_tab.movAverage_current_config -= (*ptrMovMeanCur_cfg)/divider;
-                ptrMovMeanCur_cfg++;
-            } else {
-                if (ptrMovMeanCur_new == &curValues[NMBR_AVERAGES_CUR_cfg])
-                    curInit |= 0x20;
-            }
-
-            /* Check pointer for buffer overflow */
-            if (ptrMovMeanCur_new > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_new = &curValues[0];
-            if (ptrMovMeanCur_1s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_1s = &curValues[0];
-            if (ptrMovMeanCur_5s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_5s = &curValues[0];
-            if (ptrMovMeanCur_10s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_10s = &curValues[0];
-            if (ptrMovMeanCur_30s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_30s = &curValues[0];
-            if (ptrMovMeanCur_60s > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_60s = &curValues[0];
-            if (ptrMovMeanCur_cfg > &curValues[movMeanCurLength-1])
-                ptrMovMeanCur_cfg = &curValues[0];
+            /* Sums of the windows are updated exactly in O(1), the means are calculated from them */
+            MOVSTAT_AddSample(&curMovStat, curPow_tab.current);
+            movMean_tab.movAverage_current_1s = curWindows[0].mean;
+            movMean_tab.movAverage_current_5s = curWindows[1].mean;
+            movMean_tab.movAverage_current_10s = curWindows[2].mean;
+            movMean_tab.movAverage_current_30s = curWindows[3].mean;
+            movMean_tab.movAverage_current_60s = curWindows[4].mean;
+            movMean_tab.movAverage_current_config = curWindows[5].mean;
         }
     }
 
@@ -285,89 +226,14 @@ static void algo_movAverage(uint32_t algoIdx) {
         if (curPow_tab.state_power == 0) {
             newValues = 1;
 
-            /* Add value to array and calculate new moving mean values */
-            *ptrMovMeanPow_new = curPow_tab.power;
-
-            /* Calculate new moving means - first add new value */
-            divider = NMBR_AVERAGES_POW_1s;
-            movMean_tab.movAverage_power_1s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_5s;
-            movMean_tab.movAverage_power_5s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_10s;
-            movMean_tab.movAverage_power_10s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_30s;
-            movMean_tab.movAverage_power_30s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_60s;
-            movMean_tab.movAverage_power_60s += (*ptrMovMeanPow_new)/divider;
-            divider = NMBR_AVERAGES_POW_cfg;
-            movMean_tab.movAverage_power_config += (*ptrMovMeanPow_new)/divider;
-
-            /* Then, increment pointer and substract oldest value when respective window is filled with data */
-            ptrMovMeanPow_new++;
-            if ((powInit & 0x01) == 0x01) {
-                divider = NMBR_AVERAGES_POW_1s;
-                movMean_tab.movAverage_power_1s -= ((*ptrMovMeanPow_1s)/divider);
-                ptrMovMeanPow_1s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_1s])
-                    powInit |= 0x01;
-            }
-            if ((powInit & 0x02) == 0x02) {
-                divider = NMBR_AVERAGES_POW_5s;
-                movMean_tab.movAverage_power_5s -= ((*ptrMovMeanPow_5s)/divider);
-                ptrMovMeanPow_5s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_5s])
-                    powInit |= 0x02;
-            }
-            if ((powInit & 0x04) == 0x04) {
-                divider = NMBR_AVERAGES_POW_10s;
-                movMean_tab.movAverage_power_10s -= ((*ptrMovMeanPow_10s)/divider);
-                ptrMovMeanPow_10s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_10s])
-                    powInit |= 0x04;
-            }
-            if ((powInit & 0x08) == 0x08) {
-                divider = NMBR_AVERAGES_POW_30s;
-                movMean_tab.movAverage_power_30s -= ((*ptrMovMeanPow_30s)/divider);
-                ptrMovMeanPow_30s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_30s])
-                    powInit |= 0x08;
-            }
-            if ((powInit & 0x10) == 0x10) {
-                divider = NMBR_AVERAGES_POW_60s;
-                movMean_tab.movAverage_power_60s -= ((*ptrMovMeanPow_60s)/divider);
-                ptrMovMeanPow_60s++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_60s])
-                    powInit |= 0x10;
-            }
-            if ((powInit & 0x20) == 0x20) {
-                divider = NMBR_AVERAGES_POW_cfg;
-                movMean_tab.movAverage_power_config -= ((*ptrMovMeanPow_cfg)/divider);
-                ptrMovMeanPow_cfg++;
-            } else {
-                if (ptrMovMeanPow_new == &powValues[NMBR_AVERAGES_POW_cfg])
-                    powInit |= 0x20;
-            }
-
-            /* Check pointer for buffer overflow */
-            if (ptrMovMeanPow_new > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_new = &powValues[0];
-            if (ptrMovMeanPow_1s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_1s = &powValues[0];
-            if (ptrMovMeanPow_5s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_5s = &powValues[0];
-            if (ptrMovMeanPow_10s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_10s = &powValues[0];
-            if (ptrMovMeanPow_30s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_30s = &powValues[0];
-            if (ptrMovMeanPow_60s > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_60s = &powValues[0];
-            if (ptrMovMeanPow_cfg > &powValues[movMeanPowLength-1])
-                ptrMovMeanPow_cfg = &powValues[0];
+            /* The current sensor measures the power in whole W */
+            MOVSTAT_AddSample(&powMovStat, (int32_t)curPow_tab.power);
+            movMean_tab.movAverage_power_1s = powWindows[0].mean;
+            movMean_tab.movAverage_power_5s = powWindows[1].mean;
+            movMean_tab.movAverage_power_10s = powWindows[2].mean;
+            movMean_tab.movAverage_power_30s = powWindows[3].mean;
+            movMean_tab.movAverage_power_60s = powWindows[4].mean;
+            movMean_tab.movAverage_power_config = powWindows[5].mean;
         }
     }
 
@@ -383,3 +249,24 @@ static void algo_movAverage(uint32_t algoIdx) {
     }
     return;
 }
+
+
+static void algo_socEstimation(uint32_t algoIdx) {
+    uint8_t finished = FALSE;
+
+    if (ALGO_IsFirstStep(algoIdx) == TRUE) {
+        /* The previous call may have been dropped after a missed deadline */
+        SOC_EstimationRestart();
+    }
+
+    /* Kalman filters of the SOC (see SOX_EKF_MODE), continued in the next step when the budget is used up */
+    do {
+        finished = SOC_Estimation(ALGO_SOC_ESTIMATION_FILTERS_PER_CALL);
+    } while ((finished == FALSE) && (ALGO_IsStepBudgetLeft(algoIdx) == TRUE));
+
+    /* Only set task to ready state if it isn't blocked by the monitoring unit because of a runtime violation */
+    if ((finished == TRUE) && (algo_algorithms[algoIdx].state != ALGO_BLOCKED)) {
+        algo_algorithms[algoIdx].state = ALGO_READY;
+    }
+    return;
+}
@@ -76,6 +76,22 @@
 /* #define ALGO_TICK_MS 10 */
 #define ALGO_TICK_MS 100
 
+/**
+ * @ingroup CONFIG_ALGO
+ * maximum duration of one step of an algorithm executed by the background
+ * task, see ALGO_IsStepBudgetLeft(). Tasks with the same priority as the
+ * background task are executed between the steps.
+ * \par Type:
+ * int
+ * \par Unit:
+ * us
+ * \par Range:
+ * [100,10000]
+ * \par Default:
+ * 1000
+*/
+#define ALGO_BACKGROUND_STEP_BUDGET_US      1000u
+
 
 typedef enum ALGO_STATE {
     ALGO_READY           = 0,
@@ -86,12 +102,40 @@ typedef enum ALGO_STATE {
     ALGO_BLOCKED         = 5,
 } ALGO_STATE_e;
 
+/**
+ * task context in which an algorithm is executed
+ */
+typedef enum ALGO_CONTEXT {
+    ALGO_CONTEXT_CYCLIC     = 0,    /*!< called by ALGO_MainFunction() in the 100ms application task */
+    ALGO_CONTEXT_BACKGROUND = 1,    /*!< called in steps by ALGO_BackgroundFunction() in the background task */
+} ALGO_CONTEXT_e;
+
+/**
+ * scheduling state and measured execution times of an algorithm, maintained
+ * by the algorithm module (zero in the configuration)
+ */
+typedef struct ALGO_RUNTIME {
+    uint32_t nextDue_ms;             /*!< time of the next call in ms of the algorithm time base */
+    struct ALGO_TASKS *next;         /*!< next algorithm in the list sorted by nextDue_ms */
+    uint32_t calls;                  /*!< number of calls */
+    uint32_t overruns;               /*!< number of calls longer than maxCalcDuration_ms */
+    uint32_t minCycles;              /*!< shortest execution time in CPU cycles */
+    uint32_t maxCycles;              /*!< longest execution time in CPU cycles */
+    uint64_t sumCycles;              /*!< sum of all execution times in CPU cycles */
+    uint32_t jobCycles;              /*!< execution time of the steps of the current background call */
+    uint8_t firstStep;               /*!< TRUE until the first step of the current background call */
+    uint8_t overrun;                 /*!< TRUE if the last call was an overrun */
+} ALGO_RUNTIME_s;
+
 typedef struct ALGO_TASKS {
     ALGO_STATE_e state;              /* !< current execution state */
     uint32_t cycleTime_ms;           /* !< cycle time of algorithm */
+    uint32_t phase_ms;               /*!< time of the first call, spreads algorithms over the ticks */
     uint32_t maxCalcDuration_ms;     /* !< maximum allowed calculation duration for task */
     uint32_t startTime;              /* !< start time when executing algorithm */
     void (*func)(uint32_t algoIdx);  /*!< callback function */
+    ALGO_CONTEXT_e context;          /*!< task context in which the algorithm is executed */
+    ALGO_RUNTIME_s runtime;          /*!< scheduling state and execution times, not configured */
 } ALGO_TASKS_s;
 
 /*================== Constant and Variable Definitions ====================*/
@@ -71,12 +71,16 @@ OS_Task_Definition_s appl_tskdef_cyclic_1ms   = { 0,      1,  OS_PRIORITY_NORMAL
 OS_Task_Definition_s appl_tskdef_cyclic_10ms  = { 4,     10,  OS_PRIORITY_BELOW_NORMAL, APPL_TSK_C_10MS_STACKSIZE};
 OS_Task_Definition_s appl_tskdef_cyclic_100ms = { 58,   100,  OS_PRIORITY_LOW,          APPL_TSK_C_100MS_STACKSIZE};
 OS_Task_Definition_s appl_tskdef_aperiodic =    { 0,     10,  OS_PRIORITY_IDLE,         APPL_TSK_APERIODIC_STACKSIZE};
+OS_Task_Definition_s appl_tskdef_background =   { 0,     10,  OS_PRIORITY_IDLE,         APPL_TSK_BACKGROUND_STACKSIZE};
 
 static uint8_t io_initialized = FALSE;
 static uint8_t io_direction = 1;
 static uint8_t io_counter = 0;
 static uint8_t io_cycle = 0;
 static uint8_t first_cycle = 0;
+static uint8_t appl_cycles_without_current = 0;
+static uint32_t appl_previous_current_timestamp = 0;
+static DATA_BLOCK_CURRENT_SENSOR_s appl_current_tab;
 static DATA_BLOCK_SLAVE_CONTROL_s example_slave_control;
 
 /*================== Function Prototypes ==================================*/
@@ -101,12 +105,32 @@ void APPL_Cyclic_10ms(void) {
 
     LED_Ctrl();
 
-    SOC_Calculation();
-    SOF_Calculation();
+    /* Without new current measurements, SOC (recalibration at rest) and SOF are updated periodically */
+    if (appl_cycles_without_current < (APPL_EVENT_CURRENT_SENSOR_TIMEOUT_CYCLES - 1u)) {
+        appl_cycles_without_current++;
+    } else {
+        appl_cycles_without_current = 0;
+        SOC_Calculation();
+        SOF_Calculation();
+    }
 
     ALGO_MonitorExecutionTime();
 }
 
+void APPL_Event_10ms(uint32_t events) {
+    if ((events & APPL_EVENT_CURRENT_SENSOR) != 0u) {
+        /* The current sensor data block is written for every message of the current sensor,
+         * SOC and SOF are only updated if the current itself has been measured again */
+        DB_ReadBlock(&appl_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
+        if (appl_current_tab.timestamp_cur != appl_previous_current_timestamp) {
+            appl_previous_current_timestamp = appl_current_tab.timestamp_cur;
+            appl_cycles_without_current = 0;
+            SOC_Calculation();
+            SOF_Calculation();
+        }
+    }
+}
+
 void APPL_Cyclic_100ms(void) {
     uint8_t i = 0;
     /* uint8_t j; used for DEMO only */
@@ -204,4 +228,10 @@ void APPL_Cyclic_100ms(void) {
 void APPL_Aperiodic(void) {
     COM_Decoder();
     COM_printHelpCommand();
+    COM_printDatabaseHistory();
+}
+
+uint8_t APPL_Background(void) {
+    /* Algorithms with context ALGO_CONTEXT_BACKGROUND, one step per call */
+    return ALGO_BackgroundFunction();
 }
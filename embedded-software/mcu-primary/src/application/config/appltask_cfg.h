@@ -82,6 +82,23 @@
  */
 #define APPL_TSK_APERIODIC_STACKSIZE   (1024u/4u)
 
+/**
+ * @brief Stack size of background task
+ */
+#define APPL_TSK_BACKGROUND_STACKSIZE  (1024u/4u)
+
+/**
+ * @brief Notification bit of the 10ms task: new current sensor data in the database
+ */
+#define APPL_EVENT_CURRENT_SENSOR      (0x00000001u)
+
+/**
+ * @brief Number of 10ms cycles without new current sensor data, after which
+ *        the 10ms task updates SOC and SOF periodically (e.g., if the current
+ *        sensor is missing or has stopped sending)
+ */
+#define APPL_EVENT_CURRENT_SENSOR_TIMEOUT_CYCLES    (10u)
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
@@ -120,6 +137,16 @@ extern OS_Task_Definition_s appl_tskdef_cyclic_100ms;
  */
 extern OS_Task_Definition_s appl_tskdef_aperiodic;
 
+/**
+ * @brief   Task configuration of the background application task
+ *
+ * @details Task with the lowest priority for long calculations, which must
+ *          not delay the cyclic tasks
+ *
+ * @ingroup API_OS
+ */
+extern OS_Task_Definition_s appl_tskdef_background;
+
 /*================== Function Prototypes ==================================*/
 
 /**
@@ -136,6 +163,21 @@ extern void APPL_Cyclic_1ms(void);
  */
 extern void APPL_Cyclic_10ms(void);
 
+/**
+ * @brief   event handler of the 10 milliseconds application task
+ *
+ * Called by the 10ms application task while it waits for its next cycle,
+ * whenever a database block it has subscribed to has been updated. All
+ * notifications that are pending when the task wakes up are passed with one
+ * call. SOC and SOF are only updated if the current sensor data block
+ * contains a new current measurement.
+ *
+ * @param   events  notification bits that have been set (APPL_EVENT_*)
+ *
+ * @ingroup API_OS
+ */
+extern void APPL_Event_10ms(uint32_t events);
+
 /**
  * @brief   user application task 100 milliseconds
  *
@@ -150,6 +192,18 @@ extern void APPL_Cyclic_100ms(void);
  */
 extern void APPL_Aperiodic(void);
 
+/**
+ * @brief   user application background task
+ *
+ * Called repeatedly in every cycle of the background task as long as it
+ * returns TRUE. Tasks with the same priority are executed between the calls.
+ *
+ * @return  TRUE if there is more work to do in this cycle, otherwise FALSE
+ *
+ * @ingroup API_OS
+ */
+extern uint8_t APPL_Background(void);
+
 /*================== Function Implementations =============================*/
 
 #endif /* APPLTASK_CFG_H_ */
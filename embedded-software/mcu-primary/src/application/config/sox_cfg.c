@@ -147,6 +147,21 @@ const SOX_SOF_CONFIG_s sox_sof_config_MSL = {
         .Cutoff_Voltage_Discha  = SOX_MSL_VOLT_CUTOFF_DISCHARGE
 };
 
+/**
+ * Example OCV curve of an LTO cell. It has to be replaced by the OCV measured
+ * for the used cell (e.g., after a rest of several hours at each SOC point).
+ */
+const SOX_OCV_TABLE_s sox_ocv_table = {
+    .temperature_degC = {-20.0f, 0.0f, 25.0f, 45.0f},
+    .ocv_mV = {
+        /*    0%,    5%,   10%,   15%,   20%,   25%,   30%,   35%,   40%,   45%,   50%,   55%,   60%,   65%,   70%,   75%,   80%,   85%,   90%,   95%,  100% */
+        {  1818,  2077,  2145,  2184,  2213,  2231,  2248,  2261,  2272,  2283,  2294,  2306,  2318,  2330,  2345,  2362,  2381,  2405,  2434,  2472,  2551 },   /* -20 degC */
+        {  1810,  2069,  2138,  2178,  2207,  2226,  2244,  2257,  2269,  2280,  2292,  2305,  2317,  2330,  2346,  2363,  2383,  2407,  2436,  2476,  2555 },   /*   0 degC */
+        {  1800,  2060,  2130,  2170,  2200,  2220,  2238,  2252,  2265,  2277,  2290,  2303,  2316,  2330,  2346,  2364,  2385,  2410,  2440,  2480,  2560 },   /*  25 degC */
+        {  1792,  2053,  2123,  2164,  2194,  2215,  2234,  2248,  2262,  2274,  2288,  2302,  2315,  2330,  2346,  2365,  2387,  2412,  2443,  2483,  2564 },   /*  45 degC */
+    },
+};
+
 
 /*================== Function Prototypes ==================================*/
 
@@ -73,10 +73,10 @@
 
 /**
  * @ingroup CONFIG_SOX
- * when initializing SOC from SOC-Voltage lookup table, the difference between
- * two consecutive voltage measurements of the cell with minimum voltage must be below
- * this value in order to ensure low disturbance and equilibrium in chemical
- * reactions (relaxation effects)
+ * when initializing SOC from SOC-Voltage lookup table, the voltage of the cell
+ * with minimum voltage must not drift more than this value during
+ * SOX_OCV_STABLE_TIME_ms in order to ensure low disturbance and equilibrium in
+ * chemical reactions (relaxation effects)
  * \par Type:
  * int
  * \par Unit:
@@ -88,10 +88,10 @@
 
 /**
  * @ingroup CONFIG_SOX
- * when initializing SOC from SOC-Voltage lookup table, the difference between
- * two consecutive voltage measurements of the cell with maximum voltage must be below
- * this value in order to ensure low disturbance and equilibrium in chemical
- * reactions (relaxation effects)
+ * when initializing SOC from SOC-Voltage lookup table, the voltage of the cell
+ * with maximum voltage must not drift more than this value during
+ * SOX_OCV_STABLE_TIME_ms in order to ensure low disturbance and equilibrium in
+ * chemical reactions (relaxation effects)
  * \par Type:
  * int
  * \par Unit:
@@ -101,6 +101,158 @@
 */
 #define SOX_DELTA_MAX_LIMIT             10
 
+/**
+ * @ingroup CONFIG_SOX
+ * time the cell voltages have to stay within SOX_DELTA_MIN_LIMIT and
+ * SOX_DELTA_MAX_LIMIT while the battery system is at rest, before the SOC is
+ * recalibrated with the SOC-Voltage lookup table
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 60000
+*/
+#define SOX_OCV_STABLE_TIME_ms          60000u
+
+/**
+ * @ingroup CONFIG_SOX
+ * number of SOC points of the open circuit voltage table sox_ocv_table. The
+ * points are equally spaced from 0% to 100% SOC.
+ * \par Type:
+ * int
+ * \par Default:
+ * 21
+*/
+#define SOX_OCV_SOC_POINTS              21u
+
+/**
+ * @ingroup CONFIG_SOX
+ * number of temperature points of the open circuit voltage table sox_ocv_table
+ * \par Type:
+ * int
+ * \par Default:
+ * 4
+*/
+#define SOX_OCV_TEMPERATURE_POINTS      4u
+
+/**
+ * @ingroup CONFIG_SOX
+ * cells estimated by the extended Kalman filter (EKF) of the SOC.
+ * SOX_EKF_MODE_MINMAX runs one filter with the minimum and one with the
+ * maximum cell voltage, SOX_EKF_MODE_CELL runs one filter for every cell.
+ * \par Type:
+ * select(2)
+ * \par Default:
+ * SOX_EKF_MODE_MINMAX
+*/
+#define SOX_EKF_MODE_MINMAX             0
+#define SOX_EKF_MODE_CELL               1
+
+#define SOX_EKF_MODE                    SOX_EKF_MODE_MINMAX
+
+/**
+ * @ingroup CONFIG_SOX
+ * if TRUE, the EKF of the SOC is calculated with integer arithmetic only
+ * (e.g., for controllers without floating point unit)
+ * \par Type:
+ * toggle
+ * \par Default:
+ * FALSE
+*/
+#define SOX_EKF_FIXED_POINT             FALSE
+
+/**
+ * @ingroup CONFIG_SOX
+ * ohmic resistance R0 of a cell in the equivalent circuit of the EKF
+ * \par Type:
+ * float
+ * \par Unit:
+ * mOhm
+ * \par Default:
+ * 1.0
+*/
+#define SOX_EKF_R0_mOhm                 1.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * resistance R1 of the RC element of a cell in the equivalent circuit of the EKF
+ * \par Type:
+ * float
+ * \par Unit:
+ * mOhm
+ * \par Default:
+ * 0.8
+*/
+#define SOX_EKF_R1_mOhm                 0.8f
+
+/**
+ * @ingroup CONFIG_SOX
+ * time constant R1*C1 of the RC element of a cell in the equivalent circuit
+ * of the EKF
+ * \par Type:
+ * int
+ * \par Unit:
+ * ms
+ * \par Default:
+ * 30000
+*/
+#define SOX_EKF_TAU1_ms                 30000u
+
+/**
+ * @ingroup CONFIG_SOX
+ * standard deviation of the SOC taken from the Coulomb counter when the EKF
+ * is started
+ * \par Type:
+ * float
+ * \par Unit:
+ * %
+ * \par Range:
+ * (0,10]
+ * \par Default:
+ * 5.0
+*/
+#define SOX_EKF_SOC_STD_INIT            5.0f
+
+/**
+ * @ingroup CONFIG_SOX
+ * standard deviation of the change of the SOC per step of the EKF that is
+ * not explained by the measured current (process noise)
+ * \par Type:
+ * float
+ * \par Unit:
+ * %
+ * \par Default:
+ * 0.001
+*/
+#define SOX_EKF_SOC_STD_PROCESS         0.001f
+
+/**
+ * @ingroup CONFIG_SOX
+ * standard deviation of the change of the RC voltage per step of the EKF
+ * that is not explained by the measured current (process noise)
+ * \par Type:
+ * float
+ * \par Unit:
+ * mV
+ * \par Default:
+ * 0.1
+*/
+#define SOX_EKF_RC_STD_PROCESS          0.1f
+
+/**
+ * @ingroup CONFIG_SOX
+ * standard deviation of the measured cell voltage including the errors of
+ * the equivalent circuit (measurement noise)
+ * \par Type:
+ * float
+ * \par Unit:
+ * mV
+ * \par Default:
+ * 5.0
+*/
+#define SOX_EKF_VOLTAGE_STD             5.0f
+
 /**
  * @ingroup CONFIG_SOX
  * the cell capacity used for SOC calculation, in this case Ah counting
@@ -557,6 +709,51 @@
 #define SOX_RSL_VOLT_LIMIT_DISCHARGE                 1750
 #define SOX_MSL_VOLT_LIMIT_DISCHARGE                 1750
 
+/**
+ * @ingroup CONFIG_SOX
+ * the SOF is only recalculated when the minimum or maximum cell voltage has
+ * moved by more than this value since the last calculation
+ * \par Type:
+ * int
+ * \par Unit:
+ * mV
+ * \par Range:
+ * [0,50]
+ * \par Default:
+ * 2
+*/
+#define SOX_SOF_HYSTERESIS_VOLTAGE_mV           2
+
+/**
+ * @ingroup CONFIG_SOX
+ * the SOF is only recalculated when the minimum or maximum cell temperature
+ * has moved by more than this value since the last calculation
+ * \par Type:
+ * int
+ * \par Unit:
+ * &deg;C
+ * \par Range:
+ * [0,5]
+ * \par Default:
+ * 0
+*/
+#define SOX_SOF_HYSTERESIS_TEMPERATURE_degC     0
+
+/**
+ * @ingroup CONFIG_SOX
+ * the SOF is only recalculated when the minimum or maximum SOC has moved by
+ * more than this value since the last calculation
+ * \par Type:
+ * int
+ * \par Unit:
+ * 0.01%
+ * \par Range:
+ * [0,500]
+ * \par Default:
+ * 10
+*/
+#define SOX_SOF_HYSTERESIS_SOC                  10
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
@@ -597,6 +794,17 @@ extern const SOX_SOF_CONFIG_s sox_sof_config_MOL;
 extern const SOX_SOF_CONFIG_s sox_sof_config_RSL;
 extern const SOX_SOF_CONFIG_s sox_sof_config_MSL;
 
+/**
+ * open circuit voltage (OCV) of a cell over SOC and temperature, used to
+ * recalibrate the SOC at rest
+ */
+typedef struct {
+    float temperature_degC[SOX_OCV_TEMPERATURE_POINTS];                 /*!< temperatures of the rows, ascending */
+    uint16_t ocv_mV[SOX_OCV_TEMPERATURE_POINTS][SOX_OCV_SOC_POINTS];    /*!< OCV at 0%, 100%/(SOX_OCV_SOC_POINTS-1), ..., 100% SOC, ascending */
+} SOX_OCV_TABLE_s;
+
+extern const SOX_OCV_TABLE_s sox_ocv_table;
+
 /*================== Function Prototypes ==================================*/
 
 
@@ -60,15 +60,48 @@
 #include "batterycell_cfg.h"
 #include "batterysystem_cfg.h"
 #include "nvramhandler.h"
+#include "os.h"
 
 /*================== Macros and Definitions ===============================*/
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+#define SOC_EKF_NR_OF_FILTERS           BS_NR_OF_BAT_CELLS
+#else
+#define SOC_EKF_NR_OF_FILTERS           2u
+#endif
+
+/** capacity of a cell in the EKF, unit: uAs */
+#define SOC_EKF_CAPACITY_uAs            ((int64_t)(SOX_CELL_CAPACITY * 3600000.0f))
+
+/** @{
+ * scaling of the EKF in integer arithmetic: SOC in 1e-7 of the capacity,
+ * voltages in uV, resistances in uOhm and covariances in these units
+ */
+#define SOC_EKF_FIXED_FULL              10000000
+#define SOC_EKF_FIXED_PER_PERCENT       100000
+#define SOC_EKF_FIXED_SEGMENT           (SOC_EKF_FIXED_FULL / (int32_t)(SOX_OCV_SOC_POINTS - 1u))
+#define SOC_EKF_FIXED_R0_uOhm           ((int64_t)(SOX_EKF_R0_mOhm * 1000.0f))
+#define SOC_EKF_FIXED_R1_uOhm           ((int64_t)(SOX_EKF_R1_mOhm * 1000.0f))
+#define SOC_EKF_FIXED_Q_SOC             ((int64_t)(SOX_EKF_SOC_STD_PROCESS * SOX_EKF_SOC_STD_PROCESS * 1.0e10f))
+#define SOC_EKF_FIXED_Q_RC              ((int64_t)(SOX_EKF_RC_STD_PROCESS * SOX_EKF_RC_STD_PROCESS * 1.0e6f))
+#define SOC_EKF_FIXED_R                 ((int64_t)(SOX_EKF_VOLTAGE_STD * SOX_EKF_VOLTAGE_STD * 1.0e6f))
+#define SOC_EKF_FIXED_P_SOC_INIT        ((int64_t)(SOX_EKF_SOC_STD_INIT * SOX_EKF_SOC_STD_INIT * 1.0e10f))
+/** @} */
+
+/**
+ * upper limit of the SOC variance in the integer EKF, (10%)^2, so that the
+ * products of the update stay within int64_t
+ */
+#define SOC_EKF_FIXED_P_SOC_MAX         ((int64_t)1000000 * 1000000)
+
+/** scaling of the slopes of the SOF derating curves */
+#define SOF_SLOPE_SCALE                 65536
+
+/** scaling of the temperatures in the SOF derating curves, unit: 0.1 degC */
+#define SOF_TEMPERATURE_SCALE           10
 
 /*================== Constant and Variable Definitions ====================*/
 static SOX_STATE_s sox_state = {
     .sensor_cc_used         = 0,
-    .cc_scaling             = 0.0,
-    .cc_scaling_min         = 0.0,
-    .cc_scaling_max         = 0.0,
     .counter                = 0,
 };
 
@@ -80,77 +113,208 @@ static DATA_BLOCK_CONTFEEDBACK_s contfeedbacktab;
 
 static uint32_t soc_previous_current_timestamp = 0;
 static uint32_t soc_previous_current_timestamp_cc = 0;
+static float soc_previous_current_counter = 0.0f;
+
+/** @{
+ * per-cell Coulomb counter: charge content of each cell, charge content of the
+ * full cell and the factor from the charge content to the SOC in 0.01%
+ */
+static int32_t soc_cell_charge_mAs[BS_NR_OF_BAT_CELLS];
+static int32_t soc_cell_full_mAs[BS_NR_OF_BAT_CELLS];
+static float soc_cell_scaling[BS_NR_OF_BAT_CELLS];
+/** @} */
+
+/**
+ * charge in uAs (mA*ms) that has not been subtracted from the cells yet
+ */
+static int32_t soc_charge_remainder_uAs = 0;
+
+/**
+ * SOC of the cells calculated from their open circuit voltages
+ */
+static float soc_cell_ocv[BS_NR_OF_BAT_CELLS];
+
+/** @{
+ * cell voltages and time at the start of the window in which the cell voltages
+ * have to stay stable before the SOC is recalibrated with the OCV at rest
+ */
+static uint8_t soc_ocv_window_active = FALSE;
+static uint16_t soc_ocv_reference_min_mV = 0;
+static uint16_t soc_ocv_reference_max_mV = 0;
+static uint32_t soc_ocv_window_start = 0;
+/** @} */
+
+/**
+ * charge in uAs counted by SOC_Calculation() since the last step of the EKF
+ * (negative when charging), accessed from different tasks
+ */
+static int64_t soc_ekf_discharge_uAs = 0;
+
+/** @{
+ * state of the extended Kalman filters of the SOC and time and cell voltages
+ * of the last step
+ */
+static uint8_t soc_ekf_initialized = FALSE;
+static uint32_t soc_ekf_previous_time = 0;
+static uint32_t soc_ekf_previous_voltage_timestamp = 0;
+static DATA_BLOCK_MINMAX_s soc_ekf_minmax;
+static DATA_BLOCK_SOX_s soc_ekf_sox;
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+static DATA_BLOCK_CELLVOLTAGE_s soc_ekf_cellvoltage;
+#endif
+#if SOX_EKF_FIXED_POINT == TRUE
+static SOX_EKF_FIXED_s soc_ekf[SOC_EKF_NR_OF_FILTERS];
+static int64_t soc_ekf_discharge_remainder = 0;
+static int32_t soc_ekf_ocv_uV[SOX_OCV_SOC_POINTS];
+static int32_t soc_ekf_slope[SOX_OCV_SOC_POINTS - 1u];  /* uV per 1e-7 of the capacity, Q16 */
+#else
+static SOX_EKF_s soc_ekf[SOC_EKF_NR_OF_FILTERS];
+#endif
+static float soc_ekf_ocv_mV[SOX_OCV_SOC_POINTS];
+/** @} */
+
+/** @{
+ * inputs and partial results of the current estimation step, which can be
+ * split over several calls of SOC_Estimation()
+ */
+static uint16_t soc_ekf_next_filter = 0;
+static uint8_t soc_ekf_measured = FALSE;
+#if SOX_EKF_FIXED_POINT == TRUE
+static SOX_EKF_FIXED_STEP_s soc_ekf_step;
+static int32_t soc_ekf_soc_min = 0;
+static int32_t soc_ekf_soc_max = 0;
+static int64_t soc_ekf_soc_sum = 0;
+static int64_t soc_ekf_p_soc_max = 0;
+#else
+static SOX_EKF_STEP_s soc_ekf_step;
+static float soc_ekf_soc_min = 0.0f;
+static float soc_ekf_soc_max = 0.0f;
+static float soc_ekf_soc_sum = 0.0f;
+static float soc_ekf_p_soc_max = 0.0f;
+#endif
+/** @} */
+
+/**
+ * result of the last complete step of the EKFs, published by SOC_Estimation()
+ * and copied to sox by SOC_WriteSox(), accessed from different tasks
+ */
+static SOX_EKF_RESULT_s soc_ekf_result = {0.0f, 0.0f, 0.0f, 0.0f};
+
+/**
+ * SOX data block read by SOF_Calculation()
+ */
+static DATA_BLOCK_SOX_s sof_sox;
 
 
 /** @{
  * module-local static Variables that are calculated at startup and used later to avoid divisions at runtime
  */
-static SOF_curve_s sofCurveRecOperatingCurrent;
-static SOF_curve_s sofCurve_MOL;
-static SOF_curve_s sofCurve_RSL;
-static SOF_curve_s sofCurve_MSL;
+static SOF_TABLE_s sof_table_recOperatingCurrent;
+#if BMS_TEST_CELL_SOF_LIMITS == TRUE
+static SOF_TABLE_s sof_table_MOL;
+static SOF_TABLE_s sof_table_RSL;
+static SOF_TABLE_s sof_table_MSL;
+#endif
 
 static SOX_SOF_s sof_recOperatingCurrent;
 static SOX_SOF_s sof_mol_Level;
 static SOX_SOF_s sof_rsl_Level;
 static SOX_SOF_s sof_msl_Level;
 
+/** @{
+ * inputs of the last SOF calculation, the calculation is skipped while the
+ * inputs stay within the hysteresis around them
+ */
+static uint8_t sof_calculated = FALSE;
+static int16_t sof_maxtemp = 0;
+static int16_t sof_mintemp = 0;
+static uint16_t sof_maxvolt = 0;
+static uint16_t sof_minvolt = 0;
+static uint16_t sof_maxsoc = 0;
+static uint16_t sof_minsoc = 0;
+/** @} */
+
 /*================== Function Prototypes ==================================*/
-static void SOF_CalculateCurves(const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues);
+static void SOF_CompileTable(const SOX_SOF_CONFIG_s *configLimitValues, SOF_TABLE_s *table);
+static void SOF_CompileCurve(SOF_CURVE_s *curve, uint8_t nrOfPoints, const float *x, float scale, const float *current_A);
+static int32_t SOF_ToFixed(float value, float scale);
+static int32_t SOF_EvaluateCurve(const SOF_CURVE_s *curve, int32_t x);
+static void SOF_EvaluateTable(const SOF_TABLE_s *table, int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc, SOF_LIMITS_s *limits);
+static uint8_t SOF_HasInputChanged(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc);
+static uint8_t SOF_IsOutsideHysteresis(int32_t value, int32_t reference, int32_t hysteresis);
 static void SOF_Calculate(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc);
-static void SOF_CalculateVoltageBased(float MinVoltage, float MaxVoltage, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues);
-static void SOF_CalculateSocBased(float MinSoc, float MaxSoc, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues);
-static void SOF_CalculateTemperatureBased(float MinTemp, float MaxTemp, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues);
-static void SOF_MinimumOfThreeSofValues(SOX_SOF_s Ubased, SOX_SOF_s Sbased, SOX_SOF_s Tbased, SOX_SOF_s *resultValues);
-static float SOF_MinimumOfThreeValues(float value1, float value2, float value3);
-static float SOC_GetFromVoltage(uint16_t voltage_mV);
+static void SOF_LimitsToSof(const SOF_LIMITS_s *limits, SOX_SOF_s *resultValues);
+static int32_t SOF_MinimumOfThreeValues(int32_t value1, int32_t value2, int32_t value3);
+static uint8_t SOC_IsRelaxed(void);
+static void SOC_GetOcvCurve(float temperature_degC, float *ocv_mV);
+static float SOC_GetFromOcvCurve(const float *ocv_mV, uint16_t voltage_mV);
+static void SOC_SetCell(uint16_t cell, float soc);
+static void SOC_DischargeCells(int64_t discharge_uAs);
+static void SOC_UpdateCells(int32_t discharge_mAs);
+static void SOC_WriteSox(void);
+static void SOC_EkfInit(void);
+static uint8_t SOC_EkfPrepare(void);
+static void SOC_EkfPublish(void);
+#if SOX_EKF_FIXED_POINT == TRUE
+static void SOC_EkfStepFixed(SOX_EKF_FIXED_s *ekf, const SOX_EKF_FIXED_STEP_s *step, uint16_t voltage_mV, uint8_t measured);
+#else
+static void SOC_EkfStep(SOX_EKF_s *ekf, const SOX_EKF_STEP_s *step, uint16_t voltage_mV, uint8_t measured);
+#endif
 
 /*================== Function Implementations =============================*/
 
 void SOC_Init(uint8_t cc_present) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0, 0, 0, 0, 0};
+    uint16_t i = 0;
 
     DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
     NVM_getSOC(&soc);
 
     if (cc_present == TRUE) {
         soc_previous_current_timestamp_cc = sox_current_tab.timestamp_cc;
+        soc_previous_current_counter = sox_current_tab.current_counter;
         sox_state.sensor_cc_used = TRUE;
-
-        if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
-            sox_state.cc_scaling = soc.mean + 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_min = soc.min + 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_max = soc.max + 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-        } else {
-            sox_state.cc_scaling = soc.mean - 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_min = soc.min - 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_max = soc.max - 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-        }
-
-
-        sox.soc_mean = soc.mean;
-        sox.soc_min = soc.min;
-        sox.soc_max = soc.max;
-        if (sox.soc_mean > 100.0f) { sox.soc_mean = 100.0; }
-        if (sox.soc_mean < 0.0f)   { sox.soc_mean = 0.0;   }
-        if (sox.soc_min > 100.0f)  { sox.soc_min = 100.0;  }
-        if (sox.soc_min < 0.0f)    { sox.soc_min = 0.0;    }
-        if (sox.soc_max > 100.0f)  { sox.soc_max = 100.0;  }
-        if (sox.soc_max < 0.0f)    { sox.soc_max = 0.0;    }
-        /* Alternatively, SOC can be initialized with {V,SOC} lookup table if available */
-        /* with the function SOC_Init_Lookup_Table() */
-        sox.state = 0;
-        sox.timestamp = 0;
-        sox.previous_timestamp = 0;
     } else {
         soc_previous_current_timestamp = sox_current_tab.timestamp_cur;
         sox_state.sensor_cc_used = FALSE;
     }
-    DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+
+    /* Only the mean SOC is stored in the NVM, all cells start with it.
+     * Alternatively, SOC can be initialized with {V,SOC} lookup table if available */
+    soc_charge_remainder_uAs = 0;
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        SOC_SetCellCapacity(i, SOX_CELL_CAPACITY);
+        SOC_SetCell(i, soc.mean);
+    }
+    SOC_UpdateCells(0);
+    sox.state = 0;
+    sox.timestamp = 0;
+    sox.previous_timestamp = 0;
+    SOC_WriteSox();
+}
+
+
+void SOC_SetCellCapacity(uint16_t cell, float capacity_mAh) {
+    int32_t full_mAs = (int32_t)(capacity_mAh * 3600.0f);
+    float soc = 0.0f;
+
+    if ((cell < BS_NR_OF_BAT_CELLS) && (full_mAs > 0)) {
+        /* the SOC of the cell is kept */
+        if (soc_cell_full_mAs[cell] > 0) {
+            soc = soc_cell_charge_mAs[cell] * soc_cell_scaling[cell] / 100.0f;
+        }
+        soc_cell_full_mAs[cell] = full_mAs;
+        soc_cell_scaling[cell] = 10000.0f / full_mAs;
+        SOC_SetCell(cell, soc);
+    }
 }
 
+
 void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_value_mean) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0, 0, 0, 0, 0};
+    float soc_cell = 0.0f;
+    float spread = (sox.soc_max - sox.soc_min);
+    uint16_t i = 0;
 
     if (soc_value_min < 0.0f) {
         soc_value_min = 0.0;
@@ -173,207 +337,673 @@ void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_value_mean
         soc_value_mean = 100.0;
     }
 
-    if (sox_state.sensor_cc_used == FALSE) {
-        soc.mean = soc_value_mean;
-        soc.min = soc_value_min;
-        soc.max = soc_value_max;
-
-        sox.soc_mean = soc.mean;
-        sox.soc_min = soc.min;
-        sox.soc_max = soc.max;
-    } else {
-        DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
-        soc.mean = soc_value_mean;
-        soc.min = soc_value_min;
-        soc.max = soc_value_max;
-
-        if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
-            sox_state.cc_scaling = soc.mean + 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_min = soc.min + 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_max = soc.max + 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        if ((spread > 0.0f) && (soc_value_min < soc_value_max)) {
+            /* Keep the order of the cells: map [sox.soc_min, sox.soc_max] to [soc_value_min, soc_value_max] */
+            soc_cell = soc_cell_charge_mAs[i] * soc_cell_scaling[i] / 100.0f;
+            soc_cell = soc_value_min + (soc_cell - sox.soc_min) * (soc_value_max - soc_value_min) / spread;
         } else {
-            sox_state.cc_scaling = soc.mean - 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_min = soc.min - 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-            sox_state.cc_scaling_max = soc.max - 100.0f*sox_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
+            soc_cell = soc_value_mean;
         }
-
-        sox.soc_mean = soc.mean;
-        sox.soc_min = soc.min;
-        sox.soc_max = soc.max;
-        if (sox.soc_mean > 100.0f) { sox.soc_mean = 100.0; }
-        if (sox.soc_mean < 0.0f)   { sox.soc_mean = 0.0;   }
-        if (sox.soc_min > 100.0f)  { sox.soc_min = 100.0;  }
-        if (sox.soc_min < 0.0f)    { sox.soc_min = 0.0;    }
-        if (sox.soc_max > 100.0f)  { sox.soc_max = 100.0;  }
-        if (sox.soc_max < 0.0f)    { sox.soc_max = 0.0;    }
+        SOC_SetCell(i, soc_cell);
     }
+    SOC_UpdateCells(0);
+
+    soc.mean = sox.soc_mean;
+    soc.min = sox.soc_min;
+    soc.max = sox.soc_max;
     NVM_setSOC(&soc);
-    DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+    SOC_WriteSox();
 }
 
 
 void SOC_RecalibrateViaLookupTable(void) {
-    float soc_min = 50.0f;
-    float soc_max = 50.0f;
-    float soc_mean = 50.0f;
+    SOX_SOC_s soc = {50.0, 50.0, 50.0, 0, 0, 0, 0};
+    DATA_BLOCK_BORROW_s cellvoltage_borrow;
+    const DATA_BLOCK_CELLVOLTAGE_s *cellvoltage = NULL_PTR;
+    uint16_t i = 0;
+
+    if (DB_BorrowBlock(&cellvoltage_borrow, DATA_BLOCK_ID_CELLVOLTAGE) != E_OK) {
+        /* Cell voltages currently not available, try again next time */
+        return;
+    }
+    cellvoltage = (const DATA_BLOCK_CELLVOLTAGE_s *)cellvoltage_borrow.dataptr;
 
     DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
 
-    soc_mean = SOC_GetFromVoltage((float)(cellminmax.voltage_mean));
-    soc_min = SOC_GetFromVoltage((float)(cellminmax.voltage_min));
-    soc_max = SOC_GetFromVoltage((float)(cellminmax.voltage_max));
+    /* The temperatures of the single cells are unknown, the mean temperature is used */
+    SOC_GetFromVoltages(cellvoltage->voltage, soc_cell_ocv, BS_NR_OF_BAT_CELLS, cellminmax.temperature_mean);
 
-    SOC_SetValue(soc_min, soc_max, soc_mean);
-}
+    (void)DB_ReleaseBlock(&cellvoltage_borrow);
 
+    soc_charge_remainder_uAs = 0;
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        SOC_SetCell(i, soc_cell_ocv[i]);
+    }
+    SOC_UpdateCells(0);
 
-void SOC_Calculation(void) {
-    uint32_t timestamp = 0;
-    uint32_t previous_timestamp = 0;
+    soc.mean = sox.soc_mean;
+    soc.min = sox.soc_min;
+    soc.max = sox.soc_max;
+    NVM_setSOC(&soc);
+    SOC_WriteSox();
+}
 
-    uint32_t timestamp_cc = 0;
-    uint32_t previous_timestamp_cc = 0;
 
+void SOC_Calculation(void) {
     uint32_t timestep = 0;
-
-    DATA_BLOCK_CURRENT_SENSOR_s cans_current_tab;
     SOX_SOC_s soc = {50.0, 50.0, 50.0, 0, 0, 0, 0};
-    float deltaSOC = 0.0;
+    int64_t discharge_uAs = 0;
+    uint8_t updated = FALSE;
 
-    if (BMS_GetBatterySystemState() == BMS_AT_REST) {
+    if (SOC_IsRelaxed() == TRUE) {
         /* Recalibrate SOC via LUT */
         SOC_RecalibrateViaLookupTable();
     } else {
         /* Use coulomb/current counting */
-        if (sox_state.sensor_cc_used == FALSE) {
-            DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
-
-            timestamp = sox_current_tab.timestamp_cur;
-            previous_timestamp = sox_current_tab.previous_timestamp_cur;
+        DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
 
-            if (soc_previous_current_timestamp != timestamp) {  /* check if current measurement has been updated */
-                timestep = timestamp - previous_timestamp;
+        if (sox_state.sensor_cc_used == FALSE) {
+            if (soc_previous_current_timestamp != sox_current_tab.timestamp_cur) {  /* check if current measurement has been updated */
+                timestep = sox_current_tab.timestamp_cur - sox_current_tab.previous_timestamp_cur;
                 if (timestep > 0) {
-                    NVM_getSOC(&soc);
-                    /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
-                    /* soc_mean = soc_mean - (sox_current_tab.current *mA* /(float)SOX_CELL_CAPACITY (*mAh*)) * (float)(timestep) * (10.0/3600.0); */ /*milliseconds*/
-
-                    if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
-                        deltaSOC = (((sox_current_tab.current)*(float)(timestep)/10))/(3600.0f * SOX_CELL_CAPACITY); /* ((mA *ms *(1s/1000ms)) / (3600(s/h) *mAh)) *100% */
-                    } else {
-                        deltaSOC = -(((sox_current_tab.current)*(float)(timestep)/10))/(3600.0f * SOX_CELL_CAPACITY); /* ((mA *ms *(1s/1000ms)) / (3600(s/h) *mAh)) *100% */
-                    }
-                    soc.mean = soc.mean - deltaSOC;
-                    soc.min = soc.min - deltaSOC;
-                    soc.max = soc.max - deltaSOC;
-                    if (soc.mean > 100.0f) { soc.mean = 100.0; }
-                    if (soc.mean < 0.0f)   { soc.mean = 0.0;   }
-                    if (soc.min > 100.0f)  { soc.min = 100.0;  }
-                    if (soc.min < 0.0f)    { soc.min = 0.0;    }
-                    if (soc.max > 100.0f)  { soc.max = 100.0;  }
-                    if (soc.max < 0.0f)    { soc.max = 0.0;    }
-
-                    sox.soc_mean = soc.mean;
-                    sox.soc_min = soc.min;
-                    sox.soc_max = soc.max;
-
-                    NVM_setSOC(&soc);
-                    sox.state++;
-                    DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+                    /* mA * ms = uAs */
+                    discharge_uAs = (int64_t)sox_current_tab.current * timestep;
+                    updated = TRUE;
                 }
             } /* end check if current measurement has been updated */
             /* update the variable for the next check */
-            soc_previous_current_timestamp = sox_current_tab.timestamp;
-
+            soc_previous_current_timestamp = sox_current_tab.timestamp_cur;
         } else {
-            DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
-
-            timestamp_cc = sox_current_tab.timestamp_cc;
-            previous_timestamp_cc = sox_current_tab.previous_timestamp_cc;
-
-            if (previous_timestamp_cc != timestamp_cc) {  /* check if cc measurement has been updated */
-                DB_ReadBlock(&cans_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
-
-                if (POSITIVE_DISCHARGE_CURRENT == TRUE) {
-                    sox.soc_mean = sox_state.cc_scaling - 100.0f*cans_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-                    sox.soc_min = sox_state.cc_scaling_min - 100.0f*cans_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-                    sox.soc_max = sox_state.cc_scaling_max - 100.0f*cans_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-                } else {
-                    sox.soc_mean = sox_state.cc_scaling + 100.0f*cans_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-                    sox.soc_min = sox_state.cc_scaling_min + 100.0f*cans_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-                    sox.soc_max = sox_state.cc_scaling_max + 100.0f*cans_current_tab.current_counter/(3600.0f*(SOX_CELL_CAPACITY/1000.0f));
-                }
-
-                soc.mean = sox.soc_mean;
-                soc.min = sox.soc_min;
-                soc.max = sox.soc_max;
-                if (sox.soc_mean > 100.0f) { sox.soc_mean = 100.0; }
-                if (sox.soc_mean < 0.0f)   { sox.soc_mean = 0.0;   }
-                if (sox.soc_min > 100.0f)  { sox.soc_min = 100.0;  }
-                if (sox.soc_min < 0.0f)    { sox.soc_min = 0.0;    }
-                if (sox.soc_max > 100.0f)  { sox.soc_max = 100.0;  }
-                if (sox.soc_max < 0.0f)    { sox.soc_max = 0.0;    }
-                NVM_setSOC(&soc);
-                sox.state++;
-                DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+            if (soc_previous_current_timestamp_cc != sox_current_tab.timestamp_cc) {  /* check if cc measurement has been updated */
+                /* A.s -> uAs, the difference of the counter values does not accumulate rounding errors */
+                discharge_uAs = (int64_t)((sox_current_tab.current_counter - soc_previous_current_counter) * 1000000.0f);
+                soc_previous_current_counter = sox_current_tab.current_counter;
+                updated = TRUE;
             }
             soc_previous_current_timestamp_cc = sox_current_tab.timestamp_cc;
         }
+
+        if (updated == TRUE) {
+            /* Current in charge direction negative means SOC increasing --> BAT naming, not ROB */
+            if (POSITIVE_DISCHARGE_CURRENT == FALSE) {
+                discharge_uAs = -discharge_uAs;
+            }
+            SOC_DischargeCells(discharge_uAs);
+
+            soc.mean = sox.soc_mean;
+            soc.min = sox.soc_min;
+            soc.max = sox.soc_max;
+            NVM_setSOC(&soc);
+            sox.state++;
+            SOC_WriteSox();
+        }
     }
 }
 
-void SOF_Init(void) {
-    /* Calculating SOF curve for the recommended operating current */
-    SOF_CalculateCurves(&sox_sof_config_maxAllowedCurrent, &sofCurveRecOperatingCurrent);
 
-#if BMS_TEST_CELL_SOF_LIMITS == TRUE
-    /* Calculating SOF curve for maximum operating limit */
-    SOF_CalculateCurves(&sox_sof_config_MOL, &sofCurve_MOL);
+uint8_t SOC_Estimation(uint16_t nrOfFilters) {
+    uint8_t finished = FALSE;
+    uint8_t prepared = TRUE;
+    uint16_t last = 0;
+    uint16_t voltage_mV = 0;
+    uint8_t valid = FALSE;
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+    uint16_t module = 0;
+    uint16_t cell = 0;
+#endif
+
+    if (soc_ekf_next_filter == 0u) {
+        prepared = SOC_EkfPrepare();
+    }
+
+    if (prepared == FALSE) {
+        /* Filters have just been initialized */
+        finished = TRUE;
+    } else {
+        nrOfFilters = (nrOfFilters == 0u) ? 1u : nrOfFilters;
+        if (nrOfFilters < (SOC_EKF_NR_OF_FILTERS - soc_ekf_next_filter)) {
+            last = soc_ekf_next_filter + nrOfFilters;
+        } else {
+            last = SOC_EKF_NR_OF_FILTERS;
+        }
+
+        for (uint16_t i = soc_ekf_next_filter; i < last; i++) {
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+            module = i / BS_NR_OF_BAT_CELLS_PER_MODULE;
+            cell = i - (module * BS_NR_OF_BAT_CELLS_PER_MODULE);
+            /* Invalid cell voltages are not used, the SOC of the cell is only predicted */
+            valid = (((soc_ekf_cellvoltage.valid_volt[module] >> cell) & 1u) == 0u) ? soc_ekf_measured : FALSE;
+            voltage_mV = soc_ekf_cellvoltage.voltage[i];
+#else
+            valid = soc_ekf_measured;
+            voltage_mV = (i == 0u) ? soc_ekf_minmax.voltage_min : soc_ekf_minmax.voltage_max;
+#endif
+#if SOX_EKF_FIXED_POINT == TRUE
+            SOC_EkfStepFixed(&soc_ekf[i], &soc_ekf_step, voltage_mV, valid);
+#else
+            SOC_EkfStep(&soc_ekf[i], &soc_ekf_step, voltage_mV, valid);
+#endif
+            soc_ekf_soc_min = (soc_ekf[i].soc < soc_ekf_soc_min) ? soc_ekf[i].soc : soc_ekf_soc_min;
+            soc_ekf_soc_max = (soc_ekf[i].soc > soc_ekf_soc_max) ? soc_ekf[i].soc : soc_ekf_soc_max;
+            soc_ekf_soc_sum += soc_ekf[i].soc;
+            soc_ekf_p_soc_max = (soc_ekf[i].p_soc > soc_ekf_p_soc_max) ? soc_ekf[i].p_soc : soc_ekf_p_soc_max;
+        }
+        soc_ekf_next_filter = last;
+
+        if (soc_ekf_next_filter == SOC_EKF_NR_OF_FILTERS) {
+            SOC_EkfPublish();
+            soc_ekf_next_filter = 0;
+            finished = TRUE;
+        }
+    }
+
+    return finished;
+}
+
+
+void SOC_EstimationRestart(void) {
+    soc_ekf_next_filter = 0;
+}
+
+
+/**
+ * @brief   sets the SOC of a cell.
+ *
+ * The result is published with the next call of SOC_UpdateCells().
+ *
+ * @param   cell    index of the cell
+ * @param   soc     SOC value from 0.0 to 100.0, limited to this range
+ */
+static void SOC_SetCell(uint16_t cell, float soc) {
+    int32_t charge_mAs = (int32_t)(soc * soc_cell_full_mAs[cell] / 100.0f);
+
+    charge_mAs = (charge_mAs < 0) ? 0 : charge_mAs;
+    charge_mAs = (charge_mAs > soc_cell_full_mAs[cell]) ? soc_cell_full_mAs[cell] : charge_mAs;
+    soc_cell_charge_mAs[cell] = charge_mAs;
+}
+
+
+/**
+ * @brief   subtracts a charge from all cells.
+ *
+ * The charge is accumulated in uAs, only whole mAs are subtracted from the
+ * cells. The rest is kept for the next call, so that no charge is lost.
+ *
+ * @param   discharge_uAs   charge taken from the cells in uAs (negative when charging)
+ */
+static void SOC_DischargeCells(int64_t discharge_uAs) {
+    int64_t total_uAs = soc_charge_remainder_uAs + discharge_uAs;
+    int32_t discharge_mAs = (int32_t)(total_uAs / 1000);
+
+    soc_charge_remainder_uAs = (int32_t)(total_uAs - ((int64_t)discharge_mAs * 1000));
+    SOC_UpdateCells(discharge_mAs);
+
+    OS_TaskEnter_Critical();
+    soc_ekf_discharge_uAs += discharge_uAs;
+    OS_TaskExit_Critical();
+}
+
+
+/**
+ * @brief   subtracts a charge from all cells and publishes their SOC.
+ *
+ * The charge content of every cell is limited to the range from empty to full
+ * cell. The loop has no branches except for the conditional selects of the
+ * limits, minimum and maximum, so it stays cheap for many cells. The SOC of
+ * every cell (0.01%) and the minimum, maximum and mean SOC are written to sox.
+ *
+ * @param   discharge_mAs   charge taken from each cell in mAs (negative when charging)
+ */
+static void SOC_UpdateCells(int32_t discharge_mAs) {
+    int32_t charge_mAs = 0;
+    float soc = 0.0f;
+    float soc_min = 10000.0f;
+    float soc_max = 0.0f;
+    int64_t soc_sum = 0;
+    uint16_t i = 0;
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        charge_mAs = soc_cell_charge_mAs[i] - discharge_mAs;
+        charge_mAs = (charge_mAs < 0) ? 0 : charge_mAs;
+        charge_mAs = (charge_mAs > soc_cell_full_mAs[i]) ? soc_cell_full_mAs[i] : charge_mAs;
+        soc_cell_charge_mAs[i] = charge_mAs;
+
+        soc = charge_mAs * soc_cell_scaling[i];
+        sox.soc_cell[i] = (uint16_t)(soc + 0.5f);
+        soc_min = (soc < soc_min) ? soc : soc_min;
+        soc_max = (soc > soc_max) ? soc : soc_max;
+        /* summed in 1/1024 of 0.01% to keep the mean exact for many cells */
+        soc_sum += (int32_t)(soc * 1024.0f);
+    }
+
+    sox.soc_min = soc_min / 100.0f;
+    sox.soc_max = soc_max / 100.0f;
+    sox.soc_mean = (float)soc_sum / (1024.0f * 100.0f * BS_NR_OF_BAT_CELLS);
+}
+
+/**
+ * @brief   writes sox with the last result of the EKFs to the database.
+ *
+ * The EKFs run in another task and do not write sox, their last result is
+ * copied from soc_ekf_result before sox is written.
+ */
+static void SOC_WriteSox(void) {
+    OS_TaskEnter_Critical();
+    sox.soc_ekf_min = soc_ekf_result.soc_min;
+    sox.soc_ekf_max = soc_ekf_result.soc_max;
+    sox.soc_ekf_mean = soc_ekf_result.soc_mean;
+    sox.soc_ekf_variance = soc_ekf_result.variance;
+    OS_TaskExit_Critical();
+
+    DB_WriteBlock(&sox, DATA_BLOCK_ID_SOX);
+}
+
+/**
+ * @brief   starts the EKF with the SOC of the Coulomb counter.
+ *
+ * The RC voltage starts with zero, the variances with SOX_EKF_SOC_STD_INIT and
+ * SOX_EKF_VOLTAGE_STD.
+ */
+static void SOC_EkfInit(void) {
+    uint16_t i = 0;
+
+    DB_ReadBlock(&soc_ekf_sox, DATA_BLOCK_ID_SOX);
+
+    for (i = 0; i < SOC_EKF_NR_OF_FILTERS; i++) {
+#if SOX_EKF_FIXED_POINT == TRUE
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+        /* 0.01% -> 1e-7 of the capacity */
+        soc_ekf[i].soc = (int32_t)soc_ekf_sox.soc_cell[i] * (SOC_EKF_FIXED_PER_PERCENT / 100);
+#else
+        soc_ekf[i].soc = (int32_t)(((i == 0u) ? soc_ekf_sox.soc_min : soc_ekf_sox.soc_max) * SOC_EKF_FIXED_PER_PERCENT);
+#endif
+        soc_ekf[i].p_soc = (SOC_EKF_FIXED_P_SOC_INIT < SOC_EKF_FIXED_P_SOC_MAX) ? SOC_EKF_FIXED_P_SOC_INIT : SOC_EKF_FIXED_P_SOC_MAX;
+        soc_ekf[i].p_rc = SOC_EKF_FIXED_R;
+#else
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+        soc_ekf[i].soc = soc_ekf_sox.soc_cell[i] / 100.0f;
+#else
+        soc_ekf[i].soc = (i == 0u) ? soc_ekf_sox.soc_min : soc_ekf_sox.soc_max;
+#endif
+        soc_ekf[i].p_soc = SOX_EKF_SOC_STD_INIT * SOX_EKF_SOC_STD_INIT;
+        soc_ekf[i].p_rc = SOX_EKF_VOLTAGE_STD * SOX_EKF_VOLTAGE_STD;
+#endif
+        soc_ekf[i].v_rc = 0;
+        soc_ekf[i].p_soc_rc = 0;
+    }
+}
+
+
+/**
+ * @brief   starts an estimation step of the EKFs.
+ *
+ * Takes the charge counted since the last step and the cell voltages and
+ * calculates the inputs of the step, which are equal for all filters. The
+ * filters are initialized from the Coulomb counter in the first call.
+ *
+ * @return  TRUE if the filters have to be updated, FALSE if they have just been initialized
+ */
+static uint8_t SOC_EkfPrepare(void) {
+    uint32_t time = OS_getOSSysTick();
+    uint32_t timestep_ms = time - soc_ekf_previous_time;
+    uint32_t voltage_timestamp = 0;
+    int64_t discharge_uAs = 0;
+    int32_t current_mA = 0;
+#if SOX_EKF_FIXED_POINT == TRUE
+    int64_t total = 0;
+    int32_t x_q16 = 0;
+    uint16_t i = 0;
+#else
+    float x = 0.0f;
+#endif
+
+    OS_TaskEnter_Critical();
+    discharge_uAs = soc_ekf_discharge_uAs;
+    soc_ekf_discharge_uAs = 0;
+    OS_TaskExit_Critical();
+
+    DB_ReadBlock(&soc_ekf_minmax, DATA_BLOCK_ID_MINMAX);
+#if SOX_EKF_MODE == SOX_EKF_MODE_CELL
+    DB_ReadBlock(&soc_ekf_cellvoltage, DATA_BLOCK_ID_CELLVOLTAGE);
+    voltage_timestamp = soc_ekf_cellvoltage.timestamp;
+#else
+    voltage_timestamp = soc_ekf_minmax.timestamp;
+#endif
+    /* Every cell voltage measurement is used only once */
+    soc_ekf_measured = FALSE;
+    if (voltage_timestamp != soc_ekf_previous_voltage_timestamp) {
+        soc_ekf_previous_voltage_timestamp = voltage_timestamp;
+        soc_ekf_measured = TRUE;
+    }
+    soc_ekf_previous_time = time;
+
+    if (soc_ekf_initialized == FALSE) {
+        /* The charge counted so far is already contained in the SOC of the Coulomb counter */
+        SOC_EkfInit();
+        soc_ekf_initialized = TRUE;
+        return FALSE;
+    }
+
+    if (timestep_ms > 0) {
+        current_mA = (int32_t)(discharge_uAs / timestep_ms);
+    }
+    /* The RC element decays with exp(-dt/tau), approximated to second order */
+    if (timestep_ms > SOX_EKF_TAU1_ms) {
+        timestep_ms = SOX_EKF_TAU1_ms;
+    }
+    /* The temperatures of the single cells are unknown, the mean temperature is used */
+    SOC_GetOcvCurve(soc_ekf_minmax.temperature_mean, soc_ekf_ocv_mV);
+
+#if SOX_EKF_FIXED_POINT == TRUE
+    /* Whole units of the SOC are taken from the cells, the rest is kept for the next step */
+    total = soc_ekf_discharge_remainder + discharge_uAs * SOC_EKF_FIXED_FULL;
+    soc_ekf_step.discharge = (int32_t)(total / SOC_EKF_CAPACITY_uAs);
+    soc_ekf_discharge_remainder = total - ((int64_t)soc_ekf_step.discharge * SOC_EKF_CAPACITY_uAs);
+
+    x_q16 = (int32_t)(((uint64_t)timestep_ms * 65536u) / SOX_EKF_TAU1_ms);
+    soc_ekf_step.decay = 65536 - x_q16 + (int32_t)(((int64_t)x_q16 * x_q16) >> 17);
+    soc_ekf_step.decay2 = (int32_t)(((int64_t)soc_ekf_step.decay * soc_ekf_step.decay) >> 16);
+    /* uOhm * mA = nV */
+    soc_ekf_step.rc_uV = (int32_t)(((SOC_EKF_FIXED_R1_uOhm * current_mA * (65536 - soc_ekf_step.decay)) >> 16) / 1000);
+    soc_ekf_step.ohmic_uV = (int32_t)((SOC_EKF_FIXED_R0_uOhm * current_mA) / 1000);
+
+    for (i = 0; i < SOX_OCV_SOC_POINTS; i++) {
+        soc_ekf_ocv_uV[i] = (int32_t)(soc_ekf_ocv_mV[i] * 1000.0f);
+    }
+    for (i = 0; i < (SOX_OCV_SOC_POINTS - 1u); i++) {
+        soc_ekf_slope[i] = (int32_t)(((int64_t)(soc_ekf_ocv_uV[i + 1u] - soc_ekf_ocv_uV[i]) * 65536) / SOC_EKF_FIXED_SEGMENT);
+    }
+#else
+    soc_ekf_step.discharge = (float)discharge_uAs * (100.0f / SOC_EKF_CAPACITY_uAs);
+    x = (float)timestep_ms / SOX_EKF_TAU1_ms;
+    soc_ekf_step.decay = 1.0f - x + (0.5f * x * x);
+    soc_ekf_step.rc_mV = SOX_EKF_R1_mOhm * current_mA * (1.0f - soc_ekf_step.decay) / 1000.0f;
+    soc_ekf_step.ohmic_mV = SOX_EKF_R0_mOhm * current_mA / 1000.0f;
+#endif
+
+
+#if SOX_EKF_FIXED_POINT == TRUE
+    soc_ekf_soc_min = SOC_EKF_FIXED_FULL;
+    soc_ekf_soc_max = 0;
+    soc_ekf_soc_sum = 0;
+    soc_ekf_p_soc_max = 0;
+#else
+    soc_ekf_soc_min = 100.0f;
+    soc_ekf_soc_max = 0.0f;
+    soc_ekf_soc_sum = 0.0f;
+    soc_ekf_p_soc_max = 0.0f;
+#endif
+
+    return TRUE;
+}
 
-    /* Calculating SOF curve for recommended safety limit */
-    SOF_CalculateCurves(&sox_sof_config_RSL, &sofCurve_RSL);
 
-    /* Calculating SOF curve for maximum safety limit */
-    SOF_CalculateCurves(&sox_sof_config_MSL, &sofCurve_MSL);
+/**
+ * @brief   publishes the result of an estimation step of the EKFs.
+ *
+ * The result is only copied to soc_ekf_result, SOC_WriteSox() writes it to
+ * the database together with the SOC of the Coulomb counter. The fields are
+ * updated together, so that a mixture of two estimation steps is never
+ * written.
+ */
+static void SOC_EkfPublish(void) {
+    OS_TaskEnter_Critical();
+#if SOX_EKF_FIXED_POINT == TRUE
+    soc_ekf_result.soc_min = (float)soc_ekf_soc_min / SOC_EKF_FIXED_PER_PERCENT;
+    soc_ekf_result.soc_max = (float)soc_ekf_soc_max / SOC_EKF_FIXED_PER_PERCENT;
+    soc_ekf_result.soc_mean = (float)soc_ekf_soc_sum / ((float)SOC_EKF_FIXED_PER_PERCENT * SOC_EKF_NR_OF_FILTERS);
+    soc_ekf_result.variance = (float)soc_ekf_p_soc_max / ((float)SOC_EKF_FIXED_PER_PERCENT * SOC_EKF_FIXED_PER_PERCENT);
+#else
+    soc_ekf_result.soc_min = soc_ekf_soc_min;
+    soc_ekf_result.soc_max = soc_ekf_soc_max;
+    soc_ekf_result.soc_mean = soc_ekf_soc_sum / SOC_EKF_NR_OF_FILTERS;
+    soc_ekf_result.variance = soc_ekf_p_soc_max;
 #endif
+    OS_TaskExit_Critical();
 }
 
-static void SOF_CalculateCurves(const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues) {
-    /* Calculating SOF curve for the maximum allowed current for MOL/RSL/MSL */
-    calcCurveValues->Slope_TLowDischa = (configLimitValues->I_DischaMax_Cont - configLimitValues->I_Limphome) / (configLimitValues->Cutoff_TLow_Discha - configLimitValues->Limit_TLow_Discha);
-    calcCurveValues->Offset_TLowDischa = configLimitValues->I_Limphome - (calcCurveValues->Slope_TLowDischa * configLimitValues->Limit_TLow_Discha);
 
-    calcCurveValues->Slope_THighDischa = (0 - configLimitValues->I_DischaMax_Cont) / (configLimitValues->Limit_THigh_Discha - configLimitValues->Cutoff_THigh_Discha);
-    calcCurveValues->Offset_THighDischa = 0 - calcCurveValues->Slope_THighDischa * configLimitValues->Limit_THigh_Discha;
+#if SOX_EKF_FIXED_POINT == TRUE
+/**
+ * @brief   one step of the EKF of a cell in integer arithmetic.
+ *
+ * Same as SOC_EkfStep(). The gains are calculated in Q20 with one 64 bit
+ * division each, the covariances are limited so that no product overflows.
+ *
+ * @param   ekf         state of the filter
+ * @param   step        inputs of the step, equal for all cells
+ * @param   voltage_mV  measured cell voltage
+ * @param   measured    TRUE if voltage_mV is a new and valid measurement
+ */
+static void SOC_EkfStepFixed(SOX_EKF_FIXED_s *ekf, const SOX_EKF_FIXED_STEP_s *step, uint16_t voltage_mV, uint8_t measured) {
+    int32_t soc = ekf->soc - step->discharge;
+    int32_t segment = 0;
+    int32_t h = 0;
+    int32_t error_uV = 0;
+    int64_t u_soc = 0;
+    int64_t u_rc = 0;
+    int64_t s = 0;
+    int64_t k_soc = 0;
+    int64_t k_rc = 0;
+
+    /* Prediction */
+    ekf->v_rc = (int32_t)(((int64_t)step->decay * ekf->v_rc) >> 16) + step->rc_uV;
+    ekf->p_soc += SOC_EKF_FIXED_Q_SOC;
+    ekf->p_soc = (ekf->p_soc > SOC_EKF_FIXED_P_SOC_MAX) ? SOC_EKF_FIXED_P_SOC_MAX : ekf->p_soc;
+    ekf->p_soc_rc = (step->decay * ekf->p_soc_rc) >> 16;
+    ekf->p_rc = ((step->decay2 * ekf->p_rc) >> 16) + SOC_EKF_FIXED_Q_RC;
+    soc = (soc < 0) ? 0 : soc;
+    soc = (soc > SOC_EKF_FIXED_FULL) ? SOC_EKF_FIXED_FULL : soc;
+
+    if (measured == TRUE) {
+        /* Cell voltage = OCV(soc) - v_rc - R0 * current, linearized at soc */
+        segment = soc / SOC_EKF_FIXED_SEGMENT;
+        segment = (segment > (int32_t)(SOX_OCV_SOC_POINTS - 2u)) ? (int32_t)(SOX_OCV_SOC_POINTS - 2u) : segment;
+        h = soc_ekf_slope[segment];
+        error_uV = (int32_t)voltage_mV * 1000 - (soc_ekf_ocv_uV[segment] +
+                (int32_t)(((int64_t)h * (soc - segment * SOC_EKF_FIXED_SEGMENT)) >> 16) - ekf->v_rc - step->ohmic_uV);
+
+        u_soc = ((h * ekf->p_soc) >> 16) - ekf->p_soc_rc;
+        u_rc = ((h * ekf->p_soc_rc) >> 16) - ekf->p_rc;
+        s = ((h * u_soc) >> 16) - u_rc + SOC_EKF_FIXED_R;
+        k_soc = (u_soc * 1048576) / s;
+        k_rc = (u_rc * 1048576) / s;
+
+        soc += (int32_t)((k_soc * error_uV) >> 20);
+        ekf->v_rc += (int32_t)((k_rc * error_uV) >> 20);
+        ekf->p_soc -= (k_soc * u_soc) >> 20;
+        ekf->p_soc_rc -= (k_soc * u_rc) >> 20;
+        ekf->p_rc -= (k_rc * u_rc) >> 20;
+        soc = (soc < 0) ? 0 : soc;
+        soc = (soc > SOC_EKF_FIXED_FULL) ? SOC_EKF_FIXED_FULL : soc;
+    }
+    ekf->soc = soc;
+}
+#else
+/**
+ * @brief   one step of the EKF of a cell.
+ *
+ * The prediction takes the charge of the step from the SOC and lets the RC
+ * voltage decay towards R1 * current. If a cell voltage is measured, it is
+ * compared with OCV(soc) - v_rc - R0 * current. The OCV curve is linearized
+ * at the predicted SOC.
+ *
+ * @param   ekf         state of the filter
+ * @param   step        inputs of the step, equal for all cells
+ * @param   voltage_mV  measured cell voltage
+ * @param   measured    TRUE if voltage_mV is a new and valid measurement
+ */
+static void SOC_EkfStep(SOX_EKF_s *ekf, const SOX_EKF_STEP_s *step, uint16_t voltage_mV, uint8_t measured) {
+    float soc = ekf->soc - step->discharge;
+    float position = 0.0f;
+    uint8_t segment = 0;
+    float h = 0.0f;
+    float error_mV = 0.0f;
+    float u_soc = 0.0f;
+    float u_rc = 0.0f;
+    float s = 0.0f;
+    float k_soc = 0.0f;
+    float k_rc = 0.0f;
+
+    /* Prediction */
+    ekf->v_rc = step->decay * ekf->v_rc + step->rc_mV;
+    ekf->p_soc += SOX_EKF_SOC_STD_PROCESS * SOX_EKF_SOC_STD_PROCESS;
+    ekf->p_soc_rc *= step->decay;
+    ekf->p_rc = step->decay * step->decay * ekf->p_rc + SOX_EKF_RC_STD_PROCESS * SOX_EKF_RC_STD_PROCESS;
+    soc = (soc < 0.0f) ? 0.0f : soc;
+    soc = (soc > 100.0f) ? 100.0f : soc;
+
+    if (measured == TRUE) {
+        /* Cell voltage = OCV(soc) - v_rc - R0 * current, linearized at soc */
+        position = soc * ((SOX_OCV_SOC_POINTS - 1u) / 100.0f);
+        segment = (uint8_t)position;
+        segment = (segment > (SOX_OCV_SOC_POINTS - 2u)) ? (SOX_OCV_SOC_POINTS - 2u) : segment;
+        h = soc_ekf_ocv_mV[segment + 1u] - soc_ekf_ocv_mV[segment];
+        error_mV = voltage_mV - (soc_ekf_ocv_mV[segment] + (position - segment) * h - ekf->v_rc - step->ohmic_mV);
+        /* mV per segment -> mV per % */
+        h *= (SOX_OCV_SOC_POINTS - 1u) / 100.0f;
+
+        u_soc = h * ekf->p_soc - ekf->p_soc_rc;
+        u_rc = h * ekf->p_soc_rc - ekf->p_rc;
+        s = h * u_soc - u_rc + SOX_EKF_VOLTAGE_STD * SOX_EKF_VOLTAGE_STD;
+        k_soc = u_soc / s;
+        k_rc = u_rc / s;
+
+        soc += k_soc * error_mV;
+        ekf->v_rc += k_rc * error_mV;
+        ekf->p_soc -= k_soc * u_soc;
+        ekf->p_soc_rc -= k_soc * u_rc;
+        ekf->p_rc -= k_rc * u_rc;
+        soc = (soc < 0.0f) ? 0.0f : soc;
+        soc = (soc > 100.0f) ? 100.0f : soc;
+    }
+    ekf->soc = soc;
+}
+#endif
+
+
+void SOF_Init(void) {
+    /* Compiling SOF table for the recommended operating current */
+    SOF_CompileTable(&sox_sof_config_maxAllowedCurrent, &sof_table_recOperatingCurrent);
 
-    calcCurveValues->Slope_TLowCharge =  (configLimitValues->I_ChargeMax_Cont - 0) / (configLimitValues->Cutoff_TLow_Charge - configLimitValues->Limit_TLow_Charge);
-    calcCurveValues->Offset_TLowCharge = 0 - (calcCurveValues->Slope_TLowCharge * configLimitValues->Limit_TLow_Charge);
+#if BMS_TEST_CELL_SOF_LIMITS == TRUE
+    /* Compiling SOF table for maximum operating limit */
+    SOF_CompileTable(&sox_sof_config_MOL, &sof_table_MOL);
 
-    calcCurveValues->Slope_THighCharge = (0 - configLimitValues->I_ChargeMax_Cont) / (configLimitValues->Limit_THigh_Charge - configLimitValues->Cutoff_THigh_Charge);
-    calcCurveValues->Offset_THighCharge = 0 - calcCurveValues->Slope_THighCharge * configLimitValues->Limit_THigh_Charge;
+    /* Compiling SOF table for recommended safety limit */
+    SOF_CompileTable(&sox_sof_config_RSL, &sof_table_RSL);
 
-    calcCurveValues->Slope_SocDischa = (configLimitValues->I_DischaMax_Cont - configLimitValues->I_Limphome) / (configLimitValues->Cutoff_Soc_Discha - configLimitValues->Limit_Soc_Discha);
-    calcCurveValues->Offset_SocDischa = configLimitValues->I_Limphome - (calcCurveValues->Slope_SocDischa * configLimitValues->Limit_Soc_Discha);
+    /* Compiling SOF table for maximum safety limit */
+    SOF_CompileTable(&sox_sof_config_MSL, &sof_table_MSL);
+#else
+    sof_mol_Level.current_Charge_cont_max = BC_CURRENTMAX_CHARGE_MOL;
+    sof_mol_Level.current_Discha_cont_max = BC_CURRENTMAX_DISCHARGE_MOL;
+    sof_rsl_Level.current_Charge_cont_max = BC_CURRENTMAX_CHARGE_MOL;
+    sof_rsl_Level.current_Discha_cont_max = BC_CURRENTMAX_DISCHARGE_MOL;
+    sof_msl_Level.current_Charge_cont_max = BC_CURRENTMAX_CHARGE_MOL;
+    sof_msl_Level.current_Discha_cont_max = BC_CURRENTMAX_DISCHARGE_MOL;
+#endif
+    sof_calculated = FALSE;
+}
 
-    calcCurveValues->Slope_SocCharge = (configLimitValues->I_ChargeMax_Cont - 0.0f) / (configLimitValues->Cutoff_Soc_Charge - configLimitValues->Limit_Soc_Charge);
-    calcCurveValues->Offset_SocCharge = 0 - calcCurveValues->Slope_SocCharge * configLimitValues->Limit_Soc_Charge;
+/**
+ * @brief   compiles the SOF derating curves of one limit level into a table
+ *
+ * @param   configLimitValues   configuration of the limit level
+ * @param   table               pointer where to store the table
+ */
+static void SOF_CompileTable(const SOX_SOF_CONFIG_s *configLimitValues, SOF_TABLE_s *table) {
+    /* no discharge current below the voltage limit, full current above the cutoff */
+    const float voltageDischarge_mV[2] = {configLimitValues->Limit_Voltage_Discha, configLimitValues->Cutoff_Voltage_Discha};
+    const float voltageDischarge_A[2] = {0.0f, configLimitValues->I_DischaMax_Cont};
+    /* full charge current below the voltage cutoff, no current above the limit */
+    const float voltageCharge_mV[2] = {configLimitValues->Cutoff_Voltage_Charge, configLimitValues->Limit_Voltage_Charge};
+    const float voltageCharge_A[2] = {configLimitValues->I_ChargeMax_Cont, 0.0f};
+    /* limp home current below the SOC limit, full current above the cutoff */
+    const float socDischarge[2] = {configLimitValues->Limit_Soc_Discha, configLimitValues->Cutoff_Soc_Discha};
+    const float socDischarge_A[2] = {configLimitValues->I_Limphome, configLimitValues->I_DischaMax_Cont};
+    const float socCharge[2] = {configLimitValues->Cutoff_Soc_Charge, configLimitValues->Limit_Soc_Charge};
+    const float socCharge_A[2] = {configLimitValues->I_ChargeMax_Cont, 0.0f};
+    /* derating at low and at high temperatures, full current in between */
+    const float temperatureDischarge_degC[4] = {configLimitValues->Limit_TLow_Discha, configLimitValues->Cutoff_TLow_Discha,
+                                                configLimitValues->Cutoff_THigh_Discha, configLimitValues->Limit_THigh_Discha};
+    const float temperatureDischarge_A[4] = {configLimitValues->I_Limphome, configLimitValues->I_DischaMax_Cont,
+                                             configLimitValues->I_DischaMax_Cont, 0.0f};
+    const float temperatureCharge_degC[4] = {configLimitValues->Limit_TLow_Charge, configLimitValues->Cutoff_TLow_Charge,
+                                             configLimitValues->Cutoff_THigh_Charge, configLimitValues->Limit_THigh_Charge};
+    const float temperatureCharge_A[4] = {0.0f, configLimitValues->I_ChargeMax_Cont,
+                                          configLimitValues->I_ChargeMax_Cont, 0.0f};
+
+    SOF_CompileCurve(&table->voltageDischarge, 2u, voltageDischarge_mV, 1.0f, voltageDischarge_A);
+    SOF_CompileCurve(&table->voltageCharge, 2u, voltageCharge_mV, 1.0f, voltageCharge_A);
+    SOF_CompileCurve(&table->socDischarge, 2u, socDischarge, 1.0f, socDischarge_A);
+    SOF_CompileCurve(&table->socCharge, 2u, socCharge, 1.0f, socCharge_A);
+    SOF_CompileCurve(&table->temperatureDischarge, 4u, temperatureDischarge_degC, (float)SOF_TEMPERATURE_SCALE, temperatureDischarge_A);
+    SOF_CompileCurve(&table->temperatureCharge, 4u, temperatureCharge_degC, (float)SOF_TEMPERATURE_SCALE, temperatureCharge_A);
+}
 
-    calcCurveValues->Slope_VoltageDischa = (configLimitValues->I_DischaMax_Cont - 0) / (configLimitValues->Cutoff_Voltage_Discha - configLimitValues->Limit_Voltage_Discha);
-    calcCurveValues->Offset_VoltageDischa = 0 - calcCurveValues->Slope_SocDischa * configLimitValues->Limit_Soc_Discha;
+/**
+ * @brief   compiles a piecewise-linear derating curve
+ *
+ * The breakpoints have to be ascending. Segments of zero width are allowed,
+ * the curve steps there.
+ *
+ * @param   curve       pointer where to store the curve
+ * @param   nrOfPoints  number of breakpoints (at most SOF_CURVE_POINTS)
+ * @param   x           breakpoints
+ * @param   scale       scaling of the breakpoints into the units of the curve
+ * @param   current_A   current limits at the breakpoints in A
+ */
+static void SOF_CompileCurve(SOF_CURVE_s *curve, uint8_t nrOfPoints, const float *x, float scale, const float *current_A) {
+    uint8_t i = 0;
+    int32_t dx = 0;
+
+    curve->nrOfPoints = nrOfPoints;
+    for (i = 0; i < nrOfPoints; i++) {
+        curve->x[i] = (int16_t)SOF_ToFixed(x[i], scale);
+        curve->current_mA[i] = SOF_ToFixed(current_A[i], 1000.0f);
+    }
+    for (i = 0; i < (nrOfPoints - 1u); i++) {
+        dx = curve->x[i + 1u] - curve->x[i];
+        if (dx > 0) {
+            curve->slope_q16[i] = (int32_t)(((int64_t)(curve->current_mA[i + 1u] - curve->current_mA[i]) * SOF_SLOPE_SCALE) / dx);
+        } else {
+            curve->slope_q16[i] = 0;
+        }
+    }
+}
 
-    calcCurveValues->Slope_VoltageCharge = (configLimitValues->I_ChargeMax_Cont - 0) / (configLimitValues->Cutoff_Voltage_Charge - configLimitValues->Limit_Voltage_Charge);
-    calcCurveValues->Offset_VoltageCharge = 0 - calcCurveValues->Slope_VoltageCharge * configLimitValues->Limit_Soc_Discha;
+/**
+ * @brief   converts a configuration value into an integer, rounded to the nearest value
+ *
+ * @param   value   configuration value
+ * @param   scale   scaling of the value
+ *
+ * @return  scaled and rounded value
+ */
+static int32_t SOF_ToFixed(float value, float scale) {
+    float scaled = value * scale;
+    return (int32_t)((scaled < 0.0f) ? (scaled - 0.5f) : (scaled + 0.5f));
 }
 
 
 void SOF_Calculation(void) {
+    uint16_t maxsoc = 0;
+    uint16_t minsoc = 0;
+
     DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
-    DB_ReadBlock(&sox, DATA_BLOCK_ID_SOX);
+    DB_ReadBlock(&sof_sox, DATA_BLOCK_ID_SOX);
     DB_ReadBlock(&sof, DATA_BLOCK_ID_SOF);
     DB_ReadBlock(&contfeedbacktab, DATA_BLOCK_ID_CONTFEEDBACK);
 
-    /* Calculate SOF limits */
-    SOF_Calculate(cellminmax.temperature_max, cellminmax.temperature_min, cellminmax.voltage_max, cellminmax.voltage_min, (uint16_t)(100.0f*sox.soc_max), (uint16_t)(100.0f*sox.soc_min));
+    maxsoc = (uint16_t)(100.0f*sof_sox.soc_max);
+    minsoc = (uint16_t)(100.0f*sof_sox.soc_min);
+
+    /* Calculate SOF limits, the last limits are kept while the inputs stay within the hysteresis */
+    if (SOF_HasInputChanged(cellminmax.temperature_max, cellminmax.temperature_min, cellminmax.voltage_max, cellminmax.voltage_min, maxsoc, minsoc) == TRUE) {
+        SOF_Calculate(cellminmax.temperature_max, cellminmax.temperature_min, cellminmax.voltage_max, cellminmax.voltage_min, maxsoc, minsoc);
+    }
 
     /* Write MOL level */
     sof.continuous_charge_MOL = sof_mol_Level.current_Charge_cont_max;
@@ -404,235 +1034,300 @@ void SOF_Calculation(void) {
     DB_WriteBlock(&sof, DATA_BLOCK_ID_SOF);
 }
 
+float SOC_GetFromVoltage(uint16_t voltage_mV, float temperature_degC) {
+    float ocv_mV[SOX_OCV_SOC_POINTS];
+
+    SOC_GetOcvCurve(temperature_degC, ocv_mV);
+    return SOC_GetFromOcvCurve(ocv_mV, voltage_mV);
+}
+
+
+void SOC_GetFromVoltages(const uint16_t *voltage_mV, float *soc, uint16_t nrOfCells, float temperature_degC) {
+    float ocv_mV[SOX_OCV_SOC_POINTS];
+    uint16_t i = 0;
+
+    SOC_GetOcvCurve(temperature_degC, ocv_mV);
+    for (i = 0; i < nrOfCells; i++) {
+        soc[i] = SOC_GetFromOcvCurve(ocv_mV, voltage_mV[i]);
+    }
+}
+
+
+/**
+ * @brief   checks if the cell voltages at rest can be trusted as open circuit voltages.
+ *
+ * The battery system has to be at rest (see BMS_GetBatterySystemState()), the
+ * current has to be below SOX_SOC_INIT_CURRENT_LIMIT and the minimum and
+ * maximum cell voltage must not have drifted more than SOX_DELTA_MIN_LIMIT and
+ * SOX_DELTA_MAX_LIMIT for SOX_OCV_STABLE_TIME_ms. A drift restarts the window.
+ *
+ * @return  TRUE if the cells are relaxed, FALSE otherwise
+ */
+static uint8_t SOC_IsRelaxed(void) {
+    uint8_t retVal = FALSE;
+    uint32_t timestamp = OS_getOSSysTick();
+
+    if (BMS_GetBatterySystemState() != BMS_AT_REST) {
+        soc_ocv_window_active = FALSE;
+    } else {
+        DB_ReadBlock(&cellminmax, DATA_BLOCK_ID_MINMAX);
+        DB_ReadBlock(&sox_current_tab, DATA_BLOCK_ID_CURRENT_SENSOR);
+
+        if ((soc_ocv_window_active == FALSE) ||
+                (cellminmax.voltage_min > (soc_ocv_reference_min_mV + SOX_DELTA_MIN_LIMIT)) ||
+                ((cellminmax.voltage_min + SOX_DELTA_MIN_LIMIT) < soc_ocv_reference_min_mV) ||
+                (cellminmax.voltage_max > (soc_ocv_reference_max_mV + SOX_DELTA_MAX_LIMIT)) ||
+                ((cellminmax.voltage_max + SOX_DELTA_MAX_LIMIT) < soc_ocv_reference_max_mV) ||
+                (sox_current_tab.current > SOX_SOC_INIT_CURRENT_LIMIT) ||
+                (sox_current_tab.current < -SOX_SOC_INIT_CURRENT_LIMIT)) {
+            /* (Re)start the window with the present cell voltages */
+            soc_ocv_window_active = TRUE;
+            soc_ocv_reference_min_mV = cellminmax.voltage_min;
+            soc_ocv_reference_max_mV = cellminmax.voltage_max;
+            soc_ocv_window_start = timestamp;
+        } else if ((uint32_t)(timestamp - soc_ocv_window_start) >= SOX_OCV_STABLE_TIME_ms) {
+            retVal = TRUE;
+        }
+    }
+    return retVal;
+}
+
+
+/**
+ * @brief   interpolates the OCV curve of sox_ocv_table at a temperature.
+ *
+ * Below the first and above the last temperature of the table, the first or
+ * last row is used.
+ *
+ * @param   temperature_degC    cell temperature in &deg;C
+ * @param   ocv_mV              OCV at the SOX_OCV_SOC_POINTS SOC points
+ */
+static void SOC_GetOcvCurve(float temperature_degC, float *ocv_mV) {
+    const float *temperatures_degC = sox_ocv_table.temperature_degC;
+    uint8_t row = 0;
+    float weight = 0.0f;
+    uint8_t i = 0;
+
+    if (temperature_degC >= temperatures_degC[SOX_OCV_TEMPERATURE_POINTS - 1u]) {
+        row = SOX_OCV_TEMPERATURE_POINTS - 2u;
+        weight = 1.0f;
+    } else if (temperature_degC > temperatures_degC[0]) {
+        while (temperature_degC >= temperatures_degC[row + 1u]) {
+            row++;
+        }
+        weight = (temperature_degC - temperatures_degC[row]) / (temperatures_degC[row + 1u] - temperatures_degC[row]);
+    }
+
+    for (i = 0; i < SOX_OCV_SOC_POINTS; i++) {
+        ocv_mV[i] = sox_ocv_table.ocv_mV[row][i] + weight * (sox_ocv_table.ocv_mV[row + 1u][i] - sox_ocv_table.ocv_mV[row][i]);
+    }
+}
+
+
 /**
  * @brief   look-up table for SOC initialization (mean, min and max).
  *
- * @param   voltage: voltage of battery cell
+ * The OCV curve is searched binary and interpolated linearly between two SOC
+ * points.
+ *
+ * @param   ocv_mV      OCV curve from SOC_GetOcvCurve(), ascending
+ * @param   voltage_mV  open circuit voltage of the cell
  *
  * @return  SOC value from 0.00% - 100.0%
  */
+static float SOC_GetFromOcvCurve(const float *ocv_mV, uint16_t voltage_mV) {
+    float soc = 0.0f;
+    uint8_t low = 0;
+    uint8_t high = SOX_OCV_SOC_POINTS - 1u;
+    uint8_t middle = 0;
+
+    if (voltage_mV <= ocv_mV[low]) {
+        soc = 0.0f;
+    } else if (voltage_mV >= ocv_mV[high]) {
+        soc = 100.0f;
+    } else {
+        /* ocv_mV[low] < voltage_mV < ocv_mV[high] holds during the search */
+        while ((low + 1u) < high) {
+            middle = (low + high) / 2u;
+            if (ocv_mV[middle] <= voltage_mV) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        soc = (low + ((voltage_mV - ocv_mV[low]) / (ocv_mV[high] - ocv_mV[low]))) * (100.0f / (SOX_OCV_SOC_POINTS - 1u));
+    }
+    return soc;
+}
 
-float SOC_GetFromVoltage(uint16_t voltage_mV) {
-    float SOC = 50.0f;
 
-    return SOC;
+void SOF_GetRecommendedLimits(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc, SOF_LIMITS_s *limits) {
+    SOF_EvaluateTable(&sof_table_recOperatingCurrent, maxtemp, mintemp, maxvolt, minvolt, maxsoc, minsoc, limits);
 }
 
+/**
+ * @brief   checks if one of the SOF inputs has moved beyond the hysteresis
+ *
+ * If so, the inputs are stored as reference for the next check.
+ *
+ * @param   maxtemp       maximum temperature in system in degC
+ * @param   mintemp       minimum temperature in system in degC
+ * @param   maxvolt       maximum voltage in system in mV
+ * @param   minvolt       minimum voltage in system in mV
+ * @param   maxsoc        maximum soc in system with resolution 0.01% (0..10000)
+ * @param   minsoc        minimum soc in system with resolution 0.01% (0..10000)
+ *
+ * @return  TRUE if the SOF has to be calculated, FALSE otherwise
+ */
+static uint8_t SOF_HasInputChanged(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc) {
+    uint8_t retVal = FALSE;
+
+    if ((sof_calculated == FALSE) ||
+            (SOF_IsOutsideHysteresis(maxtemp, sof_maxtemp, SOX_SOF_HYSTERESIS_TEMPERATURE_degC) == TRUE) ||
+            (SOF_IsOutsideHysteresis(mintemp, sof_mintemp, SOX_SOF_HYSTERESIS_TEMPERATURE_degC) == TRUE) ||
+            (SOF_IsOutsideHysteresis(maxvolt, sof_maxvolt, SOX_SOF_HYSTERESIS_VOLTAGE_mV) == TRUE) ||
+            (SOF_IsOutsideHysteresis(minvolt, sof_minvolt, SOX_SOF_HYSTERESIS_VOLTAGE_mV) == TRUE) ||
+            (SOF_IsOutsideHysteresis(maxsoc, sof_maxsoc, SOX_SOF_HYSTERESIS_SOC) == TRUE) ||
+            (SOF_IsOutsideHysteresis(minsoc, sof_minsoc, SOX_SOF_HYSTERESIS_SOC) == TRUE)) {
+        sof_calculated = TRUE;
+        sof_maxtemp = maxtemp;
+        sof_mintemp = mintemp;
+        sof_maxvolt = maxvolt;
+        sof_minvolt = minvolt;
+        sof_maxsoc = maxsoc;
+        sof_minsoc = minsoc;
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
+/**
+ * @brief   checks if a value differs from a reference by more than the hysteresis
+ *
+ * @param   value       value to check
+ * @param   reference   reference value
+ * @param   hysteresis  allowed difference
+ *
+ * @return  TRUE if the value is outside the hysteresis, FALSE otherwise
+ */
+static uint8_t SOF_IsOutsideHysteresis(int32_t value, int32_t reference, int32_t hysteresis) {
+    uint8_t retVal = FALSE;
+
+    if ((value > (reference + hysteresis)) || (value < (reference - hysteresis))) {
+        retVal = TRUE;
+    }
+    return retVal;
+}
 
 /**
  * @brief   calculates State of function which means how much current can be delivered by battery to stay in safe operating area.
  *
- * @param   maxtemp       maximum temperature in system in �C
- * @param   mintemp       minimum temperature in system in �C
+ * @param   maxtemp       maximum temperature in system in degC
+ * @param   mintemp       minimum temperature in system in degC
  * @param   maxvolt       maximum voltage in system in mV
  * @param   minvolt       minimum voltage in system in mV
  * @param   maxsoc        maximum soc in system with resolution 0.01% (0..10000)
  * @param   minsoc        minimum soc in system with resolution 0.01% (0..10000)
  */
 static void SOF_Calculate(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc) {
-    SOX_SOF_s UbasedSof = {0.0, 0.0, 0.0, 0.0};
-    SOX_SOF_s SbasedSof = {0.0, 0.0, 0.0, 0.0};
-    SOX_SOF_s TbasedSof = {0.0, 0.0, 0.0, 0.0};
+    SOF_LIMITS_s limits = {0, 0};
 
     /* Calculate maximum allowed current depending on current values */
-    SOF_CalculateVoltageBased((float)minvolt, (float)maxvolt, &UbasedSof, &sox_sof_config_maxAllowedCurrent, &sofCurveRecOperatingCurrent);
-    SOF_CalculateSocBased((float)minsoc, (float)maxsoc, &SbasedSof, &sox_sof_config_maxAllowedCurrent, &sofCurveRecOperatingCurrent);
-    SOF_CalculateTemperatureBased((float)mintemp, (float)maxtemp, &TbasedSof, &sox_sof_config_maxAllowedCurrent, &sofCurveRecOperatingCurrent);
-    SOF_MinimumOfThreeSofValues(UbasedSof, SbasedSof, TbasedSof, &sof_recOperatingCurrent);
+    SOF_EvaluateTable(&sof_table_recOperatingCurrent, maxtemp, mintemp, maxvolt, minvolt, maxsoc, minsoc, &limits);
+    SOF_LimitsToSof(&limits, &sof_recOperatingCurrent);
 
 #if BMS_TEST_CELL_SOF_LIMITS == TRUE
     /* Calculate maximum allowed current MOL level */
-    SOF_CalculateVoltageBased((float)minvolt, (float)maxvolt, &UbasedSof, &sox_sof_config_MOL, &sofCurve_MOL);
-    SOF_CalculateSocBased((float)minsoc, (float)maxsoc, &SbasedSof, &sox_sof_config_MOL, &sofCurve_MOL);
-    SOF_CalculateTemperatureBased((float)mintemp, (float)maxtemp, &TbasedSof, &sox_sof_config_MOL, &sofCurve_MOL);
-    SOF_MinimumOfThreeSofValues(UbasedSof, SbasedSof, TbasedSof, &sof_mol_Level);
+    SOF_EvaluateTable(&sof_table_MOL, maxtemp, mintemp, maxvolt, minvolt, maxsoc, minsoc, &limits);
+    SOF_LimitsToSof(&limits, &sof_mol_Level);
 
     /* Calculate maximum allowed current RSL level */
-    SOF_CalculateVoltageBased((float)minvolt, (float)maxvolt, &UbasedSof, &sox_sof_config_RSL, &sofCurve_RSL);
-    SOF_CalculateSocBased((float)minsoc, (float)maxsoc, &SbasedSof, &sox_sof_config_RSL, &sofCurve_RSL);
-    SOF_CalculateTemperatureBased((float)mintemp, (float)maxtemp, &TbasedSof, &sox_sof_config_RSL, &sofCurve_RSL);
-    SOF_MinimumOfThreeSofValues(UbasedSof, SbasedSof, TbasedSof, &sof_rsl_Level);
+    SOF_EvaluateTable(&sof_table_RSL, maxtemp, mintemp, maxvolt, minvolt, maxsoc, minsoc, &limits);
+    SOF_LimitsToSof(&limits, &sof_rsl_Level);
 
     /* Calculate maximum allowed current MSL level */
-    SOF_CalculateVoltageBased((float)minvolt, (float)maxvolt, &UbasedSof, &sox_sof_config_MSL, &sofCurve_MSL);
-    SOF_CalculateSocBased((float)minsoc, (float)maxsoc, &SbasedSof, &sox_sof_config_MSL, &sofCurve_MSL);
-    SOF_CalculateTemperatureBased((float)mintemp, (float)maxtemp, &TbasedSof, &sox_sof_config_MSL, &sofCurve_MSL);
-    SOF_MinimumOfThreeSofValues(UbasedSof, SbasedSof, TbasedSof, &sof_msl_Level);
-#else
-    sof_mol_Level.current_Charge_cont_max = BC_CURRENTMAX_CHARGE_MOL;
-    sof_mol_Level.current_Discha_cont_max = BC_CURRENTMAX_DISCHARGE_MOL;
-    sof_rsl_Level.current_Charge_cont_max = BC_CURRENTMAX_CHARGE_MOL;
-    sof_rsl_Level.current_Discha_cont_max = BC_CURRENTMAX_DISCHARGE_MOL;
-    sof_msl_Level.current_Charge_cont_max = BC_CURRENTMAX_CHARGE_MOL;
-    sof_msl_Level.current_Discha_cont_max = BC_CURRENTMAX_DISCHARGE_MOL;
+    SOF_EvaluateTable(&sof_table_MSL, maxtemp, mintemp, maxvolt, minvolt, maxsoc, minsoc, &limits);
+    SOF_LimitsToSof(&limits, &sof_msl_Level);
 #endif
 }
 
 /**
- *  @brief  calculates the SoF from voltage data (i.e., minimum and maximum voltage)
+ * @brief   calculates the current limits of a range of cells from a derating table
  *
- *  @param  MinVoltage minimum sell voltage
- *  @param  MaxVoltage maximum cell voltage
- *  @param  ResultValues Voltage-based SOF
+ * The voltage and SOC curves rise in discharge direction and fall in charge
+ * direction, the temperature curves rise towards the nominal temperature and
+ * fall above it. The minimum of the limits of all cells of the range is
+ * therefore reached at one of the extreme values of the range.
+ *
+ * @param   table         derating table of the limit level
+ * @param   maxtemp       maximum temperature in degC
+ * @param   mintemp       minimum temperature in degC
+ * @param   maxvolt       maximum voltage in mV
+ * @param   minvolt       minimum voltage in mV
+ * @param   maxsoc        maximum soc with resolution 0.01% (0..10000)
+ * @param   minsoc        minimum soc with resolution 0.01% (0..10000)
+ * @param   limits        pointer where to store the limits
  */
-static void SOF_CalculateVoltageBased(float MinVoltage, float MaxVoltage, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues) {
-    /* min voltage issues */
-    if (MinVoltage <= configLimitValues->Limit_Voltage_Discha) {
-        ResultValues->current_Discha_cont_max = 0;
-        ResultValues->current_Discha_peak_max = 0;
-    } else {
-        if (MinVoltage <= configLimitValues->Cutoff_Voltage_Discha) {
-            ResultValues->current_Discha_cont_max = (calcCurveValues->Slope_VoltageDischa * (MinVoltage-configLimitValues->Limit_Voltage_Discha));
-            ResultValues->current_Discha_peak_max = ResultValues->current_Discha_cont_max;
-        } else {
-            ResultValues->current_Discha_cont_max = configLimitValues->I_DischaMax_Cont;
-            ResultValues->current_Discha_peak_max = configLimitValues->I_DischaMax_Cont;
-        }
+static void SOF_EvaluateTable(const SOF_TABLE_s *table, int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc, SOF_LIMITS_s *limits) {
+    int32_t temperatureBased_mA = 0;
+    int32_t highTemperatureBased_mA = 0;
+
+    temperatureBased_mA = SOF_EvaluateCurve(&table->temperatureDischarge, SOF_TEMPERATURE_SCALE * (int32_t)mintemp);
+    highTemperatureBased_mA = SOF_EvaluateCurve(&table->temperatureDischarge, SOF_TEMPERATURE_SCALE * (int32_t)maxtemp);
+    if (highTemperatureBased_mA < temperatureBased_mA) {
+        temperatureBased_mA = highTemperatureBased_mA;
     }
-    /* max voltage issues */
-    if (MaxVoltage >= configLimitValues->Limit_Voltage_Charge) {
-        ResultValues->current_Charge_cont_max = 0;
-        ResultValues->current_Charge_peak_max = 0;
-    } else {
-        if (MaxVoltage >= configLimitValues->Cutoff_Voltage_Charge) {
-            ResultValues->current_Charge_cont_max =  (calcCurveValues->Slope_VoltageCharge * (MaxVoltage- configLimitValues->Limit_Voltage_Charge));
-            ResultValues->current_Charge_peak_max = ResultValues->current_Charge_cont_max;
-        } else {
-            ResultValues->current_Charge_cont_max = configLimitValues->I_ChargeMax_Cont;
-            ResultValues->current_Charge_peak_max = configLimitValues->I_ChargeMax_Cont;
-        }
+    limits->discharge_mA = SOF_MinimumOfThreeValues(SOF_EvaluateCurve(&table->voltageDischarge, minvolt),
+                                                    temperatureBased_mA,
+                                                    SOF_EvaluateCurve(&table->socDischarge, minsoc));
+
+    temperatureBased_mA = SOF_EvaluateCurve(&table->temperatureCharge, SOF_TEMPERATURE_SCALE * (int32_t)mintemp);
+    highTemperatureBased_mA = SOF_EvaluateCurve(&table->temperatureCharge, SOF_TEMPERATURE_SCALE * (int32_t)maxtemp);
+    if (highTemperatureBased_mA < temperatureBased_mA) {
+        temperatureBased_mA = highTemperatureBased_mA;
     }
+    limits->charge_mA = SOF_MinimumOfThreeValues(SOF_EvaluateCurve(&table->voltageCharge, maxvolt),
+                                                 temperatureBased_mA,
+                                                 SOF_EvaluateCurve(&table->socCharge, maxsoc));
 }
 
 /**
- * @brief   calculates the SoF from SoC data (i.e., minimum and maximum SoC of cells, both values are equal in case of Ah-counter)
+ * @brief   evaluates a derating curve with linear interpolation between the breakpoints
+ *
+ * @param   curve   derating curve
+ * @param   x       value in the units of the curve
  *
- * @param   MinSoc minimum State of Charge
- * @param   MaxSoc maximum State of Charge
- * @param   ResultValues pointer where to store the results
+ * @return  current limit in mA
  */
-static void SOF_CalculateSocBased(float MinSoc, float MaxSoc, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues) {
-    /* min voltage issues */
-    if (MinSoc <= configLimitValues->Limit_Soc_Discha) {
-        ResultValues->current_Discha_cont_max = configLimitValues->I_Limphome;
-        ResultValues->current_Discha_peak_max = configLimitValues->I_Limphome;
-    } else {
-        if (MinSoc <= configLimitValues->Cutoff_Soc_Discha) {
-            ResultValues->current_Discha_cont_max =  calcCurveValues->Slope_SocDischa * MinSoc + calcCurveValues->Offset_SocDischa;
-            ResultValues->current_Discha_peak_max =  ResultValues->current_Discha_cont_max;
-        } else {
-            ResultValues->current_Discha_cont_max =  configLimitValues->I_DischaMax_Cont;
-            ResultValues->current_Discha_peak_max =  configLimitValues->I_DischaMax_Cont;
+static int32_t SOF_EvaluateCurve(const SOF_CURVE_s *curve, int32_t x) {
+    uint8_t i = 0;
+    int32_t current_mA = curve->current_mA[0];
+
+    if (x > curve->x[0]) {
+        /* find the segment with x[i] < x <= x[i + 1] */
+        while ((i < (curve->nrOfPoints - 1u)) && (x > curve->x[i + 1u])) {
+            i++;
         }
-    }
-
-    /* max voltage issues */
-    if (MaxSoc >= configLimitValues->Limit_Soc_Charge) {
-        ResultValues->current_Charge_cont_max = 0;
-        ResultValues->current_Charge_peak_max = 0;
-    } else {
-        if (MaxSoc >= configLimitValues->Cutoff_Soc_Charge) {
-            ResultValues->current_Charge_cont_max =  calcCurveValues->Slope_SocCharge * MaxSoc + calcCurveValues->Offset_SocCharge;
-            ResultValues->current_Charge_peak_max = ResultValues->current_Charge_cont_max;
-        } else {
-            ResultValues->current_Charge_cont_max = configLimitValues->I_ChargeMax_Cont;
-            ResultValues->current_Charge_peak_max = configLimitValues->I_ChargeMax_Cont;
-        }
-    }
-}
-
-/**
- * @brief   calculates the SoF from temperature data (i.e., minimum and maximum temperature of cells)
- *
- * @param   MinTemp minimum temperature of cells
- * @param   MaxTemp maximum temperature of cells
- * @param   ResultValues pointer where to store the results
- */
-static void  SOF_CalculateTemperatureBased(float MinTemp, float MaxTemp, SOX_SOF_s *ResultValues, const SOX_SOF_CONFIG_s *configLimitValues, SOF_curve_s* calcCurveValues) {
-    SOX_SOF_s dummyResultValues = {0.0, 0.0, 0.0, 0.0};
-    /* Temperature low Discharge */
-    if (MinTemp <= configLimitValues->Limit_TLow_Discha) {
-        ResultValues->current_Discha_cont_max = configLimitValues->I_Limphome;
-        ResultValues->current_Discha_peak_max = configLimitValues->I_Limphome;
-    } else {
-        if (MinTemp <= configLimitValues->Cutoff_TLow_Discha) {
-            ResultValues->current_Discha_cont_max = calcCurveValues->Slope_TLowDischa * MinTemp + calcCurveValues->Offset_TLowDischa;
-            ResultValues->current_Discha_peak_max = ResultValues->current_Discha_cont_max;
-        } else {
-            ResultValues->current_Discha_cont_max = configLimitValues->I_DischaMax_Cont;
-            ResultValues->current_Discha_peak_max = configLimitValues->I_DischaMax_Cont;
-        }
-    }
-    /* Temperature low charge */
-    if (MinTemp <= configLimitValues->Limit_TLow_Charge) {
-        ResultValues->current_Charge_cont_max = 0;
-        ResultValues->current_Charge_peak_max = 0;
-    } else {
-        if (MinTemp <= configLimitValues->Cutoff_TLow_Charge) {
-            ResultValues->current_Charge_cont_max = calcCurveValues->Slope_TLowCharge * MinTemp + calcCurveValues->Offset_TLowCharge;
-            ResultValues->current_Charge_peak_max = ResultValues->current_Charge_cont_max;
-        } else {
-            ResultValues->current_Charge_cont_max =  configLimitValues->I_ChargeMax_Cont;
-            ResultValues->current_Charge_peak_max =  configLimitValues->I_ChargeMax_Cont;
-        }
-    }
-    /* Temperature high discharge */
-    if (MaxTemp >= configLimitValues->Limit_THigh_Discha) {
-        ResultValues->current_Discha_cont_max = 0;
-        ResultValues->current_Discha_peak_max = 0;
-        dummyResultValues.current_Discha_cont_max = 0;
-        dummyResultValues.current_Discha_peak_max = 0;
-    } else {
-        if (MaxTemp >= configLimitValues->Cutoff_THigh_Discha) {
-            dummyResultValues.current_Discha_cont_max = (calcCurveValues->Slope_THighDischa * MaxTemp + calcCurveValues->Offset_THighDischa);
-            dummyResultValues.current_Discha_peak_max = dummyResultValues.current_Discha_cont_max;
-        } else {
-            /* do nothing because this situation is handled with MinTemp */
-            dummyResultValues.current_Discha_cont_max = configLimitValues->I_DischaMax_Cont;
-            dummyResultValues.current_Discha_peak_max = configLimitValues->I_DischaMax_Cont;
-        }
-        /* take the smaller current as limit */
-        if (dummyResultValues.current_Discha_cont_max < ResultValues->current_Discha_cont_max)
-            ResultValues->current_Discha_cont_max = dummyResultValues.current_Discha_cont_max;
-        if (dummyResultValues.current_Discha_peak_max < ResultValues->current_Discha_peak_max)
-            ResultValues->current_Discha_peak_max = dummyResultValues.current_Discha_peak_max;
-    }
-    /* Temperature high Charge */
-    if (MaxTemp >= configLimitValues->Limit_THigh_Charge) {
-        ResultValues->current_Charge_cont_max = 0;
-        ResultValues->current_Charge_peak_max = 0;
-        dummyResultValues.current_Charge_cont_max = 0;
-        dummyResultValues.current_Charge_peak_max = 0;
-    } else {
-        if (MaxTemp >= configLimitValues->Cutoff_THigh_Charge) {
-            dummyResultValues.current_Charge_cont_max = (calcCurveValues->Slope_THighCharge * MaxTemp + calcCurveValues->Offset_THighCharge);
-            dummyResultValues.current_Charge_peak_max = dummyResultValues.current_Charge_cont_max;
+        if (i < (curve->nrOfPoints - 1u)) {
+            current_mA = curve->current_mA[i] + (int32_t)(((int64_t)curve->slope_q16[i] * (x - curve->x[i])) / SOF_SLOPE_SCALE);
         } else {
-            /* do nothing because this situation is handled with MinTemp */
-            dummyResultValues.current_Charge_cont_max = configLimitValues->I_ChargeMax_Cont;
-            dummyResultValues.current_Charge_peak_max = configLimitValues->I_ChargeMax_Cont;
+            current_mA = curve->current_mA[i];
         }
-        /* take the smaller current as limit */
-        if (dummyResultValues.current_Charge_cont_max < ResultValues->current_Charge_cont_max)
-            ResultValues->current_Charge_cont_max = dummyResultValues.current_Charge_cont_max;
-        if (dummyResultValues.current_Charge_peak_max < ResultValues->current_Charge_peak_max)
-            ResultValues->current_Charge_peak_max = dummyResultValues.current_Charge_peak_max;
     }
+    return current_mA;
 }
 
 /**
- * @brief   get the minimum current values of all variants of SoF calculation
+ * @brief   converts current limits in mA into SOF values in A
  *
- * @param   Ubased voltage constrained current derating values
- * @param   Sbased SOC constrained current derating values
- * @param   Tbased temperature constrained current derating values
- * @param   resultValues minimum SoF current values
+ * @param   limits          current limits in mA
+ * @param   resultValues    pointer where to store the SOF values
  */
-static void SOF_MinimumOfThreeSofValues(SOX_SOF_s Ubased, SOX_SOF_s Sbased, SOX_SOF_s Tbased, SOX_SOF_s *resultValues) {
-    resultValues->current_Charge_cont_max = SOF_MinimumOfThreeValues(Ubased.current_Charge_cont_max, Tbased.current_Charge_cont_max, Sbased.current_Charge_cont_max);
-    resultValues->current_Charge_peak_max = SOF_MinimumOfThreeValues(Ubased.current_Charge_peak_max, Tbased.current_Charge_peak_max, Sbased.current_Charge_peak_max);
-    resultValues->current_Discha_cont_max = SOF_MinimumOfThreeValues(Ubased.current_Discha_cont_max, Tbased.current_Discha_cont_max, Sbased.current_Discha_cont_max);
-    resultValues->current_Discha_peak_max = SOF_MinimumOfThreeValues(Ubased.current_Discha_peak_max, Tbased.current_Discha_peak_max, Sbased.current_Discha_peak_max);
+static void SOF_LimitsToSof(const SOF_LIMITS_s *limits, SOX_SOF_s *resultValues) {
+    resultValues->current_Charge_cont_max = (float)limits->charge_mA / 1000.0f;
+    resultValues->current_Charge_peak_max = resultValues->current_Charge_cont_max;
+    resultValues->current_Discha_cont_max = (float)limits->discharge_mA / 1000.0f;
+    resultValues->current_Discha_peak_max = resultValues->current_Discha_cont_max;
 }
 
 /**
@@ -644,8 +1339,8 @@ static void SOF_MinimumOfThreeSofValues(SOX_SOF_s Ubased, SOX_SOF_s Sbased, SOX_
  *
  * @return minimum of the 3 parameters
  */
-static float SOF_MinimumOfThreeValues(float value1, float value2, float value3) {
-    float result = 0.0;
+static int32_t SOF_MinimumOfThreeValues(int32_t value1, int32_t value2, int32_t value3) {
+    int32_t result = 0;
     if (value1 <= value2) {
         if (value3 <= value1) {
             result = value3;
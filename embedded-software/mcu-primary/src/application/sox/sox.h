@@ -62,10 +62,7 @@
  *
  */
 typedef struct {
-    uint8_t sensor_cc_used;  /*!< time in ms before the state machine processes the next state, e.g. in counts of 1ms    */
-    float cc_scaling;        /*!< scaling for the C-C value from sensor for average value */
-    float cc_scaling_min;    /*!< scaling for the C-C value from sensor for min value */
-    float cc_scaling_max;    /*!< scaling for the C-C value from sensor for max value */
+    uint8_t sensor_cc_used;  /*!< TRUE if the SOC is calculated with the current counter of the current sensor */
     uint8_t counter;                        /*!< general purpose counter */
 } SOX_STATE_s;
 
@@ -95,30 +92,98 @@ typedef struct {
 } SOX_SOC_s;
 
 /**
- * struct definition for calculating the linear SOF curve. The SOF curve is SOC,
- * voltage, temperature and charge/discharge dependent.
+ * maximum number of breakpoints of a SOF derating curve
+ */
+#define SOF_CURVE_POINTS    4u
+
+/**
+ * piecewise-linear SOF derating curve over one quantity (voltage, SOC or
+ * temperature). The curves are compiled from the SOF configuration at startup
+ * and evaluated with integer arithmetic. Below the first and above the last
+ * breakpoint the current limit is constant.
  */
 typedef struct {
-    float Slope_TLowDischa;
-    float Offset_TLowDischa;
-    float Slope_THighDischa;
-    float Offset_THighDischa;
-
-    float Slope_TLowCharge;
-    float Offset_TLowCharge;
-    float Slope_THighCharge;
-    float Offset_THighCharge;
-
-    float Slope_SocDischa;
-    float Offset_SocDischa;
-    float Slope_SocCharge;
-    float Offset_SocCharge;
-
-    float Slope_VoltageDischa;
-    float Offset_VoltageDischa;
-    float Slope_VoltageCharge;
-    float Offset_VoltageCharge;
-}SOF_curve_s;
+    uint8_t nrOfPoints;                         /*!< number of used breakpoints                                     */
+    int16_t x[SOF_CURVE_POINTS];                /*!< breakpoints, ascending                                         */
+    int32_t current_mA[SOF_CURVE_POINTS];       /*!< current limit at the breakpoints in mA                         */
+    int32_t slope_q16[SOF_CURVE_POINTS - 1u];   /*!< slope between the breakpoints in mA per unit of x, times 2^16  */
+} SOF_CURVE_s;
+
+/**
+ * derating table of one limit level (recommended operating current, MOL, RSL
+ * or MSL). Voltages are in mV, SOC in 0.01% and temperatures in 0.1 degC.
+ */
+typedef struct {
+    SOF_CURVE_s voltageDischarge;       /*!< discharge current over the minimum cell voltage        */
+    SOF_CURVE_s voltageCharge;          /*!< charge current over the maximum cell voltage           */
+    SOF_CURVE_s socDischarge;           /*!< discharge current over the minimum SOC                 */
+    SOF_CURVE_s socCharge;              /*!< charge current over the maximum SOC                    */
+    SOF_CURVE_s temperatureDischarge;   /*!< discharge current over the cell temperature            */
+    SOF_CURVE_s temperatureCharge;      /*!< charge current over the cell temperature               */
+} SOF_TABLE_s;
+
+/**
+ * current limits calculated from a derating table. The peak limits are equal
+ * to the continuous limits.
+ */
+typedef struct {
+    int32_t charge_mA;      /*!< maximum current in charge direction in mA      */
+    int32_t discharge_mA;   /*!< maximum current in discharge direction in mA   */
+} SOF_LIMITS_s;
+
+/**
+ * state of an extended Kalman filter (EKF) of the SOC of a cell, with an
+ * equivalent circuit of an ohmic resistance and one RC element
+ */
+typedef struct {
+    float soc;          /*!< SOC, unit: %                           */
+    float v_rc;         /*!< voltage over the RC element, unit: mV  */
+    float p_soc;        /*!< variance of soc, unit: %^2             */
+    float p_soc_rc;     /*!< covariance of soc and v_rc, unit: %*mV */
+    float p_rc;         /*!< variance of v_rc, unit: mV^2           */
+} SOX_EKF_s;
+
+/**
+ * inputs of one step of the EKF, equal for all cells
+ */
+typedef struct {
+    float discharge;    /*!< SOC taken from the cells during the step, unit: %  */
+    float decay;        /*!< factor of v_rc after the step                      */
+    float rc_mV;        /*!< v_rc caused by the current during the step         */
+    float ohmic_mV;     /*!< voltage over the ohmic resistance                  */
+} SOX_EKF_STEP_s;
+
+/**
+ * state of the EKF of the SOC of a cell in integer arithmetic, see SOX_EKF_s
+ */
+typedef struct {
+    int32_t soc;        /*!< SOC, unit: 1e-7 of the capacity        */
+    int32_t v_rc;       /*!< voltage over the RC element, unit: uV  */
+    int64_t p_soc;      /*!< variance of soc                        */
+    int64_t p_soc_rc;   /*!< covariance of soc and v_rc             */
+    int64_t p_rc;       /*!< variance of v_rc, unit: uV^2           */
+} SOX_EKF_FIXED_s;
+
+/**
+ * inputs of one step of the EKF in integer arithmetic, see SOX_EKF_STEP_s
+ */
+typedef struct {
+    int32_t discharge;  /*!< SOC taken from the cells during the step, unit: 1e-7 of the capacity */
+    int32_t decay;      /*!< factor of v_rc after the step, Q16                 */
+    int32_t decay2;     /*!< square of decay, Q16                               */
+    int32_t rc_uV;      /*!< v_rc caused by the current during the step         */
+    int32_t ohmic_uV;   /*!< voltage over the ohmic resistance                  */
+} SOX_EKF_FIXED_STEP_s;
+
+/**
+ * result of a complete step of the EKFs, written to the SOX data block
+ */
+typedef struct {
+    float soc_min;      /*!< minimum estimated SOC, unit: %         */
+    float soc_max;      /*!< maximum estimated SOC, unit: %         */
+    float soc_mean;     /*!< mean estimated SOC, unit: %            */
+    float variance;     /*!< largest variance of the SOC, unit: %^2 */
+} SOX_EKF_RESULT_s;
 
 /*================== Constant and Variable Definitions ====================*/
 
@@ -133,16 +198,20 @@ extern void SOC_Init(uint8_t cc_present);
 /**
  * @brief   initializes the area for SOF (where derating starts and is fully active).
  *
- * Pseudocode for linear function parameter extraction with 2 points
- *  slope = (y2 - y1) / (x2-x1)
- *  offset = y1 - (slope) * x1
- *  function y= slope * x + offset
+ * The derating curves of every limit level are compiled into the integer
+ * tables SOF_TABLE_s. The slopes are calculated here so that no division is
+ * needed at runtime.
  */
 extern void SOF_Init(void);
 
 /**
  * @brief   sets SOC value with a parameter between 0.0 and 100.0.
  *
+ * The SOC of the cells is mapped linearly from the present minimum and maximum
+ * to soc_value_min and soc_value_max. If all cells have the same SOC or
+ * soc_value_min is not below soc_value_max, all cells are set to
+ * soc_value_mean.
+ *
  * @param   soc_value_min   SOC min value to set
  * @param   soc_value_max   SOC maxn value to set
  * @param   soc_value_mean  SOC mean value to set
@@ -150,22 +219,111 @@ extern void SOF_Init(void);
 extern void SOC_SetValue(float soc_value_min, float soc_value_max, float soc_value_mean);
 
 /**
- * @brief   initializes the SOC values with lookup table (mean, min and max).
+ * @brief   sets the capacity of a cell.
+ *
+ * All cells start with SOX_CELL_CAPACITY. The SOC of the cell is kept.
+ *
+ * @param   cell            index of the cell
+ * @param   capacity_mAh    capacity of the cell in mAh
+ */
+extern void SOC_SetCellCapacity(uint16_t cell, float capacity_mAh);
+
+/**
+ * @brief   initializes the SOC values of all cells with lookup table.
  */
 extern void SOC_RecalibrateViaLookupTable(void);
 
+/**
+ * @brief   returns the SOC of a cell at rest from its open circuit voltage.
+ *
+ * The OCV curve of sox_ocv_table is interpolated at the temperature and
+ * searched for the voltage.
+ *
+ * @param   voltage_mV          open circuit voltage of the cell in mV
+ * @param   temperature_degC    cell temperature in &deg;C
+ *
+ * @return  SOC value from 0.0 to 100.0
+ */
+extern float SOC_GetFromVoltage(uint16_t voltage_mV, float temperature_degC);
+
+/**
+ * @brief   returns the SOC of several cells at rest from their open circuit voltages.
+ *
+ * Same as SOC_GetFromVoltage(), but the OCV curve is interpolated only once
+ * for all cells.
+ *
+ * @param   voltage_mV          open circuit voltages of the cells in mV
+ * @param   soc                 SOC values from 0.0 to 100.0
+ * @param   nrOfCells           number of cells
+ * @param   temperature_degC    temperature of the cells in &deg;C
+ */
+extern void SOC_GetFromVoltages(const uint16_t *voltage_mV, float *soc, uint16_t nrOfCells, float temperature_degC);
+
 /**
  * @brief   integrates current over time to calculate SOC.
+ *
+ * The charge is subtracted from every cell, the SOC of the cells and their
+ * minimum, maximum and mean are written to the database.
  */
 extern void SOC_Calculation(void);
 
+/**
+ * @brief   estimates the SOC with extended Kalman filters.
+ *
+ * The filters predict the SOC with the charge counted by SOC_Calculation()
+ * since the last step and correct it with the cell voltages, see
+ * SOX_EKF_MODE. The estimated SOC and its variance are published when all
+ * filters have been updated and written to the database with the next
+ * SOC of the Coulomb counter, see SOC_Calculation(). Called cyclically by
+ * the algorithm module.
+ *
+ * A step can be split over several calls: every call updates the next
+ * nrOfFilters filters, the inputs of the step are taken in the first call.
+ *
+ * @param   nrOfFilters maximum number of filters updated in this call (at least one)
+ *
+ * @return  TRUE if the step is finished, FALSE if more calls are needed
+ */
+extern uint8_t SOC_Estimation(uint16_t nrOfFilters);
+
+/**
+ * @brief   discards an unfinished step of SOC_Estimation().
+ *
+ * The next call of SOC_Estimation() starts a new step with new inputs. The
+ * filters not updated in the discarded step do not see the charge of that
+ * step, the correction with the cell voltages compensates this.
+ */
+extern void SOC_EstimationRestart(void);
+
 /**
  * @brief   triggers SOF calculation
  *
- * Calculation made with the function SOF_Calculate().
+ * Calculation made with the function SOF_Calculate(). The calculation is
+ * skipped as long as the minimum and maximum cell voltage, temperature and SOC
+ * stay within the hysteresis SOX_SOF_HYSTERESIS_VOLTAGE_mV,
+ * SOX_SOF_HYSTERESIS_TEMPERATURE_degC and SOX_SOF_HYSTERESIS_SOC around the
+ * values of the last calculation.
  */
 extern void SOF_Calculation(void);
 
+/**
+ * @brief   calculates the recommended operating current for a range of cells
+ *
+ * The limits are calculated from the derating tables of SOF_Init() with
+ * integer arithmetic only. For a single cell, minimum and maximum values are
+ * equal. The limits of a range are the minimum of the limits of its cells, so
+ * the function can be called per cell or per module at the measurement rate.
+ *
+ * @param   maxtemp     maximum temperature in degC
+ * @param   mintemp     minimum temperature in degC
+ * @param   maxvolt     maximum voltage in mV
+ * @param   minvolt     minimum voltage in mV
+ * @param   maxsoc      maximum SOC with resolution 0.01% (0..10000)
+ * @param   minsoc      minimum SOC with resolution 0.01% (0..10000)
+ * @param   limits      pointer where to store the limits
+ */
+extern void SOF_GetRecommendedLimits(int16_t maxtemp, int16_t mintemp, uint16_t maxvolt, uint16_t minvolt, uint16_t maxsoc, uint16_t minsoc, SOF_LIMITS_s *limits);
+
 
 /*================== Function Implementations =============================*/
 
@@ -52,6 +52,8 @@
 /*================== Includes =============================================*/
 #include "appltask.h"
 
+#include "algo.h"
+#include "database.h"
 #include "runtime_stats_light.h"
 
 /*================== Macros and Definitions ===============================*/
@@ -118,6 +120,21 @@ StaticTask_t xAppl_aperiodic_TaskStruct;
  */
 StackType_t xAppl_aperiodic_Stack[ APPL_TSK_APERIODIC_STACKSIZE ];
 
+/**
+ *  Definition of task handle background
+ */
+static TaskHandle_t appl_handle_tsk_background;
+
+/**
+ * @brief Task Struct for #appl_handle_tsk_background.
+ */
+StaticTask_t xAppl_background_TaskStruct;
+
+/**
+ * Stack of #appl_handle_tsk_background.
+ */
+StackType_t xAppl_background_Stack[ APPL_TSK_BACKGROUND_STACKSIZE ];
+
 
 #if BUILD_DIAG_ENABLE_TASK_STATISTICS
 static TASK_METRICS_s appl_metric_tsk_1ms = {
@@ -143,13 +160,43 @@ static TASK_METRICS_s appl_metric_tsk_aperiodic = {
         .jitter = 0,
         .lastCalltime = 0,
 };
+
+static TASK_METRICS_s appl_metric_tsk_background = {
+        .call_period = 0,
+        .jitter = 0,
+        .lastCalltime = 0,
+};
 #endif /* BUILD_DIAG_ENABLE_TASK_STATISTICS */
 
 /*================== Function Prototypes ==================================*/
-
+static void APPL_WaitForEvents_10ms(uint32_t startTime, uint32_t cycleTime);
 
 /*================== Function Implementations =============================*/
 
+/**
+ * @brief   waits until the next cycle of the 10ms task and handles database notifications
+ *
+ * Replaces OS_taskDelayUntil() in the 10ms task. While waiting, the task
+ * blocks on its notification value and calls APPL_Event_10ms() as soon as a
+ * subscribed database block has been updated. The notification value is
+ * cleared on wake-up, so all updates up to then are handled with one call.
+ *
+ * @param   startTime   start time of the current cycle in ms
+ * @param   cycleTime   cycle time of the task in ms
+ */
+static void APPL_WaitForEvents_10ms(uint32_t startTime, uint32_t cycleTime) {
+    uint32_t wakeTime = startTime + cycleTime;
+    uint32_t currentTime = OS_getOSSysTick();
+    uint32_t events = 0;
+
+    while ((int32_t)(wakeTime - currentTime) > 0) {
+        if (xTaskNotifyWait(0u, 0xFFFFFFFFu, &events, (TickType_t)((wakeTime - currentTime) / portTICK_RATE_MS)) == pdTRUE) {
+            APPL_Event_10ms(events);
+        }
+        currentTime = OS_getOSSysTick();
+    }
+}
+
 void APPL_CreateTask(void) {
     /* Cyclic Task 1ms */
     appl_handle_tsk_1ms = xTaskCreateStatic(
@@ -182,6 +229,14 @@ void APPL_CreateTask(void) {
             appl_tskdef_aperiodic.Stacksize, NULL,
             appl_tskdef_aperiodic.Priority, xAppl_aperiodic_Stack,
             &xAppl_aperiodic_TaskStruct);
+
+    /* Background Task */
+    appl_handle_tsk_background = xTaskCreateStatic(
+            (TaskFunction_t) APPL_TSK_Background,
+            (const portCHAR *) "APPL_TSK_Background",
+            appl_tskdef_background.Stacksize, NULL,
+            appl_tskdef_background.Priority, xAppl_background_Stack,
+            &xAppl_background_TaskStruct);
 }
 
 void APPL_CreateMutex(void) {
@@ -218,13 +273,16 @@ void APPL_TSK_Cyclic_10ms(void) {
 
     OS_taskDelayUntil(&os_schedulerstarttime, appl_tskdef_cyclic_10ms.Phase);
 
+    /* Event-driven processing of new database entries */
+    DB_Subscribe(DATA_BLOCK_ID_CURRENT_SENSOR, appl_handle_tsk_10ms, APPL_EVENT_CURRENT_SENSOR);
+
     while (1) {
         uint32_t currentTime = OS_getOSSysTick();
         APPL_Cyclic_10ms();
 #if BUILD_DIAG_ENABLE_TASK_STATISTICS
         uint32_t time_entry_into_wait = OS_getOSSysTick();
 #endif /* BUILD_DIAG_ENABLE_TASK_STATISTICS */
-        OS_taskDelayUntil(&currentTime, appl_tskdef_cyclic_10ms.CycleTime);
+        APPL_WaitForEvents_10ms(currentTime, appl_tskdef_cyclic_10ms.CycleTime);
 #if BUILD_DIAG_ENABLE_TASK_STATISTICS
         diag_calc_runtime_stats(&appl_metric_tsk_10ms, appl_tskdef_cyclic_10ms.CycleTime, time_entry_into_wait);
 #endif /* BUILD_DIAG_ENABLE_TASK_STATISTICS */
@@ -237,6 +295,9 @@ void APPL_TSK_Cyclic_100ms(void) {
 
     OS_taskDelayUntil(&os_schedulerstarttime, appl_tskdef_cyclic_100ms.Phase);
 
+    /* Algorithms are scheduled in this task */
+    ALGO_Init();
+
     while (1) {
         uint32_t currentTime = OS_getOSSysTick();
         APPL_Cyclic_100ms();
@@ -268,3 +329,25 @@ void APPL_TSK_Aperiodic(void) {
 #endif /* BUILD_DIAG_ENABLE_TASK_STATISTICS */
   }
 }
+
+void APPL_TSK_Background(void) {
+    while (os_boot != OS_SYSTEM_RUNNING) {
+    }
+
+    OS_taskDelayUntil(&os_schedulerstarttime, appl_tskdef_background.Phase);
+
+    while (1) {
+        uint32_t currentTime = OS_getOSSysTick();
+        while (APPL_Background() == TRUE) {
+            /* Let the other tasks with the lowest priority run between the steps */
+            taskYIELD();
+        }
+#if BUILD_DIAG_ENABLE_TASK_STATISTICS
+        uint32_t time_entry_into_wait = OS_getOSSysTick();
+#endif /* BUILD_DIAG_ENABLE_TASK_STATISTICS */
+        OS_taskDelayUntil(&currentTime, appl_tskdef_background.CycleTime);
+#if BUILD_DIAG_ENABLE_TASK_STATISTICS
+        diag_calc_runtime_stats(&appl_metric_tsk_background, appl_tskdef_background.CycleTime, time_entry_into_wait);
+#endif /* BUILD_DIAG_ENABLE_TASK_STATISTICS */
+    }
+}
@@ -101,6 +101,11 @@ extern void APPL_TSK_Cyclic_100ms(void);
  */
 extern void APPL_TSK_Aperiodic(void);
 
+/**
+ * @brief   background application task
+ */
+extern void APPL_TSK_Background(void);
+
 /*================== Function Implementations =============================*/
 
 #endif /* APPLTASK_H_ */
@@ -337,6 +337,9 @@ const CAN_MSG_TX_TYPE_s can_CAN0_messages_tx[] = {
         { 0x1E2, 8, 1000, 40, NULL_PTR },  /*!< Running average current 2 */
 
         { 0x1F0, 8, 1000, 40, NULL_PTR },  /*!< Pack voltage */
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+        { 0x1F8, 8, 1000, 40, NULL_PTR },  /*!< Database access statistics */
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
         { 0x200, 8, 200, 20, NULL_PTR },  /*!< Cell voltages module 0 cells 0 1 2 */
         { 0x201, 8, 200, 20, NULL_PTR },  /*!< Cell voltages module 0 cells 3 4 5 */
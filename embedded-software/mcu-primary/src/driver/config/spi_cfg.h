@@ -73,6 +73,10 @@
  */
 #define SPI_WAKEUP_WAIT_TIME        0
 
+/**
+ * Chip select of the devices: SPI_NSS_PORT1 for spi_devices[0], SPI_NSS_PORT2
+ * for spi_devices[1], ... (busID of SPI_SetCS())
+ */
 #define SPI_NSS_PORT1   IO_PIN_BMS_INTERFACE_SPI_NSS
 
 #define SPI_HASEEPROM
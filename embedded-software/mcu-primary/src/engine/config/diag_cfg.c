@@ -148,6 +148,7 @@ DIAG_CH_CFG_s  diag_ch_cfg[] = {
     {DIAG_CH_DATA_BUS_FAILURE,                          "DATA_BUS_FAILURE",                     DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
     {DIAG_CH_INSTRUCTION_BUS_FAILURE,                   "INSTRUCTION_BUS",                      DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
     {DIAG_CH_HARDFAULT_NOTHANDLED,                      "HARDFAULT_NOTHANDLED",                 DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
+    {DIAG_CH_ALGO_OVERRUN,                              "ALGO_OVERRUN",                         DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
 
     {DIAG_CH_CONFIGASSERT,                              "CONFIGASSERT",                         DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
     {DIAG_CH_SYSTEMMONITORING_TIMEOUT,                  "SYSTEMMONITORING_TIMEOUT",             DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
@@ -297,6 +298,9 @@ DIAG_CH_CFG_s  diag_ch_cfg[] = {
     {DIAG_CH_PLAUSIBILITY_CELL_VOLTAGE,    "PL_CELL_VOLT",    DIAG_ERROR_SENSITIVITY_HIGH, DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_plausibility_check},
     {DIAG_CH_PLAUSIBILITY_CELL_TEMP,       "PL_CELL_TEMP",    DIAG_ERROR_SENSITIVITY_HIGH, DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_plausibility_check},
     {DIAG_CH_PLAUSIBILITY_PACK_VOLTAGE,    "PL_PACK_VOLT",    DIAG_ERROR_PLAUSIBILITY_PACK_SENSITIVITY, DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_plausibility_check},
+
+    /* LTC measurement jobs */
+    {DIAG_CH_LTC_JOB_DEADLINE,                          "LTC_JOB_DEADLINE",                     DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
 };
 
 
@@ -331,9 +335,32 @@ DIAG_SYSMON_CH_CFG_s diag_sysmon_ch_cfg[] = {
 };
 
 
+/**
+ * diagnosis channels that freeze the history of the database (see
+ * database_history.h) when their error occurs, so the records before the
+ * violation of a maximum safety limit are kept for analysis
+ */
+static const DIAG_CH_ID_e diag_history_trigger[] = {
+    DIAG_CH_CELLVOLTAGE_OVERVOLTAGE_MSL,
+    DIAG_CH_CELLVOLTAGE_UNDERVOLTAGE_MSL,
+    DIAG_CH_TEMP_OVERTEMPERATURE_CHARGE_MSL,
+    DIAG_CH_TEMP_OVERTEMPERATURE_DISCHARGE_MSL,
+    DIAG_CH_TEMP_UNDERTEMPERATURE_CHARGE_MSL,
+    DIAG_CH_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL,
+    DIAG_CH_OVERCURRENT_CHARGE_CELL_MSL,
+    DIAG_CH_OVERCURRENT_DISCHARGE_CELL_MSL,
+    DIAG_CH_OVERCURRENT_CHARGE_PL0_MSL,
+    DIAG_CH_OVERCURRENT_CHARGE_PL1_MSL,
+    DIAG_CH_OVERCURRENT_DISCHARGE_PL0_MSL,
+    DIAG_CH_OVERCURRENT_DISCHARGE_PL1_MSL,
+};
+
+
 DIAG_DEV_s  diag_dev = {
     .nr_of_ch   = sizeof(diag_ch_cfg)/sizeof(DIAG_CH_CFG_s),
     .ch_cfg     = &diag_ch_cfg[0],
+    .nr_of_history_triggers = sizeof(diag_history_trigger)/sizeof(DIAG_CH_ID_e),
+    .history_trigger        = &diag_history_trigger[0],
 };
 
 /*================== Static Function Implementations ========================*/
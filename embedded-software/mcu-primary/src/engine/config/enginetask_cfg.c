@@ -84,6 +84,13 @@ OS_Task_Definition_s eng_tskdef_diagnosis    = { 0,      1,  OS_PRIORITY_BELOW_R
 
 /*================== Function Implementations =============================*/
 
+void ENG_MemoryInit(void) {
+#ifdef HAL_SDRAM_MODULE_ENABLED
+    SDRAM_Init();
+#endif
+}
+
+
 void ENG_PostOSInit(void) {
     uint32_t retErrorCode = 0;
     EEPR_ERRORTYPES_e err_type = 0;
@@ -96,10 +103,6 @@ void ENG_PostOSInit(void) {
     }
     retErrorCode = 0;
 
-#ifdef HAL_SDRAM_MODULE_ENABLED
-    SDRAM_Init();
-#endif
-
     retErrorCode = CAN_Init();
     if (retErrorCode != 0) {
         DIAG_Handler(DIAG_CH_CAN_INIT_FAILURE, DIAG_EVENT_NOK, retErrorCode);   /* error event in eeprom driver */
@@ -129,6 +129,14 @@ extern OS_Task_Definition_s eng_tskdef_diagnosis;
  */
 extern void ENG_Init(void);
 
+/**
+ * @brief   initializes the external memory
+ *
+ * Called from the engine task before DATA_Init(), as data blocks can be placed
+ * in the external SDRAM
+ */
+extern void ENG_MemoryInit(void);
+
 /**
  * @brief   reads non-volatile memory and initializes the sys module
  *
@@ -256,6 +256,7 @@ void ENG_CreateQueues(void) {
 }
 
 void ENG_TSK_Engine(void) {
+    ENG_MemoryInit();
     DATA_Init();
     ENG_PostOSInit();
 
@@ -218,6 +218,24 @@
 #define BUILD_DIAG_ENABLE_TASK_STATISTICS        1
 /* #define BUILD_DIAG_ENABLE_TASK_STATISTICS      0 */
 
+/**
+ * @brief Enable database statistics
+ *
+ * If this define is set to 1, the accesses to the database are counted
+ * and can be read with DB_GetStatistics().
+ */
+/* #define BUILD_DIAG_ENABLE_DB_STATISTICS          1 */
+#define BUILD_DIAG_ENABLE_DB_STATISTICS          0
+
+/**
+ * @brief Enable the emulation of the LTC daisy-chain
+ *
+ * If this define is set to 1, the SPI frames of the LTC driver are answered
+ * by an emulated daisy-chain (ltcemu.c) instead of the slave boards.
+ */
+/* #define BUILD_MODULE_ENABLE_LTC_EMULATION        1 */
+#define BUILD_MODULE_ENABLE_LTC_EMULATION        0
+
 /**
  * A variable defined as ``(type) MEM_BKP_SRAM (name)`` will be stored in the
  * RAM which is backuped by a button cell. Therefore as long as the power
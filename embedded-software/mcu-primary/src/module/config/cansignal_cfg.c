@@ -84,6 +84,9 @@ static uint32_t cans_getPackVoltage(uint32_t, void *);
 static uint32_t cans_getminmaxvolt(uint32_t, void *);
 static uint32_t cans_getminmaxtemp(uint32_t, void *);
 static uint32_t cans_getisoguard(uint32_t, void *);
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+static uint32_t cans_getdbstatistics(uint32_t, void *);
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
 
 /* RX/Setter functions */
@@ -192,6 +195,12 @@ const CANS_signal_s cans_CAN0_signals_tx[] = {
 
     { {CAN0_MSG_PackVoltage}, 0, 32, 0, UINT32_MAX, 1, 0, littleEndian, &cans_getPackVoltage },  /*!< CAN0_SIG_PackVolt_Battery */
     { {CAN0_MSG_PackVoltage}, 32, 32, 0, UINT32_MAX, 1, 0, littleEndian, &cans_getPackVoltage },  /*!< CAN0_SIG_PackVolt_PowerNet */
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    { {CAN0_MSG_DatabaseStatistics}, 0, 16, 0, UINT16_MAX, 1, 0, littleEndian, &cans_getdbstatistics },  /*!< CAN0_SIG_DB_QueueFullDrops */
+    { {CAN0_MSG_DatabaseStatistics}, 16, 16, 0, UINT16_MAX, 1, 0, littleEndian, &cans_getdbstatistics },  /*!< CAN0_SIG_DB_MaxQueueWait */
+    { {CAN0_MSG_DatabaseStatistics}, 32, 8, 0, UINT8_MAX, 1, 0, littleEndian, &cans_getdbstatistics },  /*!< CAN0_SIG_DB_HotBlockID */
+    { {CAN0_MSG_DatabaseStatistics}, 40, 24, 0, 16777215, 1, 0, littleEndian, &cans_getdbstatistics },  /*!< CAN0_SIG_DB_HotBlockWrites */
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
     /* Module 0 cell voltages */
     { {CAN0_MSG_Mod0_Cellvolt_0}, 0, 8, 0, UINT8_MAX, 1, 0, littleEndian, &cans_getvolt },  /*!< CAN0_SIG_Mod0_volt_valid_0_2 */
@@ -1241,6 +1250,18 @@ uint32_t cans_getcanerr(uint32_t sigIdx, void *value) {
     static DATA_BLOCK_BALANCING_CONTROL_s balancing_tab;
     static DATA_BLOCK_SYSTEMSTATE_s systemstate_tab;
 
+    /* Error and limit flags are read consistently in one database access */
+    static const DATA_READ_REQUEST_s canerr_requests[] = {
+        {&canerr_tab, DATA_BLOCK_ID_ERRORSTATE},
+        {&canMSL_tab, DATA_BLOCK_ID_MSL},
+        {&canRSL_tab, DATA_BLOCK_ID_RSL},
+        {&canMOL_tab, DATA_BLOCK_ID_MOL},
+    };
+    static const DATA_READ_REQUEST_s canfeedback_requests[] = {
+        {&cancontfeedback_tab, DATA_BLOCK_ID_CONTFEEDBACK},
+        {&canilckfeedback_tab, DATA_BLOCK_ID_ILCKFEEDBACK},
+    };
+
     static uint8_t tmp = 0;
 
     if (value != NULL_PTR) {
@@ -1248,10 +1269,7 @@ uint32_t cans_getcanerr(uint32_t sigIdx, void *value) {
             case CAN0_SIG_GS0_general_error:
 
                 /* First signal in CAN_MSG_GeneralState messages -> get database entry */
-                DB_ReadBlock(&canerr_tab, DATA_BLOCK_ID_ERRORSTATE);
-                DB_ReadBlock(&canMSL_tab, DATA_BLOCK_ID_MSL);
-                DB_ReadBlock(&canRSL_tab, DATA_BLOCK_ID_RSL);
-                DB_ReadBlock(&canMOL_tab, DATA_BLOCK_ID_MOL);
+                DB_ReadBlocks(canerr_requests, sizeof(canerr_requests)/sizeof(canerr_requests[0]));
                 tmp = 0;
 
                 /* Check maximum safety limit flags */
@@ -1424,8 +1442,7 @@ uint32_t cans_getcanerr(uint32_t sigIdx, void *value) {
                 break;
 
             case CAN0_SIG_GS2_state_cont_interlock:
-                DB_ReadBlock(&cancontfeedback_tab, DATA_BLOCK_ID_CONTFEEDBACK);
-                DB_ReadBlock(&canilckfeedback_tab, DATA_BLOCK_ID_ILCKFEEDBACK);
+                DB_ReadBlocks(canfeedback_requests, sizeof(canfeedback_requests)/sizeof(canfeedback_requests[0]));
                 cancontfeedback_tab.contactor_feedback &= ~(1 << 9);
                 cancontfeedback_tab.contactor_feedback |= canilckfeedback_tab.interlock_feedback << 9;
                 *(uint32_t *)value = cancontfeedback_tab.contactor_feedback;
@@ -1833,6 +1850,51 @@ static uint32_t cans_getPackVoltage(uint32_t sigIdx, void *value) {
 }
 
 
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+static uint32_t cans_getdbstatistics(uint32_t sigIdx, void *value) {
+    uint32_t retVal = 0;
+    float canData = 0;
+    static DATA_STATISTICS_s dbStatistics_tab;
+    static uint8_t hotBlock = 0;
+
+    if (value != NULL_PTR) {
+       switch (sigIdx) {
+           case CAN0_SIG_DB_QueueFullDrops:
+               /* first signal to call function */
+               DB_GetStatistics(&dbStatistics_tab);
+               /* Data block with the most writes */
+               hotBlock = 0;
+               for (uint8_t i = 0; i < DATA_MAX_BLOCK_NR; i++) {
+                   if (dbStatistics_tab.block[i].writes > dbStatistics_tab.block[hotBlock].writes) {
+                       hotBlock = i;
+                   }
+               }
+               canData = cans_checkLimits((float)dbStatistics_tab.queue_full_drops, sigIdx);
+               break;
+
+           case CAN0_SIG_DB_MaxQueueWait:
+               canData = cans_checkLimits((float)dbStatistics_tab.max_queue_wait, sigIdx);
+               break;
+
+           case CAN0_SIG_DB_HotBlockID:
+               canData = cans_checkLimits((float)hotBlock, sigIdx);
+               break;
+
+           case CAN0_SIG_DB_HotBlockWrites:
+               canData = cans_checkLimits((float)dbStatistics_tab.block[hotBlock].writes, sigIdx);
+               break;
+
+           default:
+               break;
+       }
+       /* Apply offset and factor */
+       *(uint32_t *)value = (uint32_t)((canData + cans_CAN0_signals_tx[sigIdx].offset) * cans_CAN0_signals_tx[sigIdx].factor);
+    }
+    return retVal;
+}
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
+
 static uint32_t cans_setcurr(uint32_t sigIdx, void *value) {
     int32_t currentValue;
     int32_t temperatureValue;
@@ -116,6 +116,9 @@ typedef enum {
     CAN0_MSG_Current_1,  /*!< Moving average current 10s 30s */
     CAN0_MSG_Current_2,  /*!< Moving average current 60s configurable duration */
     CAN0_MSG_PackVoltage,  /*!< Pack voltage */
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    CAN0_MSG_DatabaseStatistics,  /*!< Database access statistics */
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
 
     CAN0_MSG_Mod0_Cellvolt_0,  /*!< Module 0 Cell voltages 0-2 */
     CAN0_MSG_Mod0_Cellvolt_1,  /*!< Module 0 Cell voltages 3-5 */
@@ -327,6 +330,13 @@ typedef enum {
     CAN0_SIG_PackVolt_Battery,
     CAN0_SIG_PackVolt_PowerNet,
 
+#if BUILD_DIAG_ENABLE_DB_STATISTICS == 1
+    CAN0_SIG_DB_QueueFullDrops,
+    CAN0_SIG_DB_MaxQueueWait,
+    CAN0_SIG_DB_HotBlockID,
+    CAN0_SIG_DB_HotBlockWrites,
+#endif /* BUILD_DIAG_ENABLE_DB_STATISTICS */
+
     CAN0_SIG_Mod0_volt_valid_0_2,
     CAN0_SIG_Mod0_volt_0,
     CAN0_SIG_Mod0_volt_1,
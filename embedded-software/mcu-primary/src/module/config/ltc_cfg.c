@@ -233,6 +233,37 @@ const uint8_t ltc_voltage_input_used[BS_MAX_SUPPORTED_CELLS] = {
 };
 
 
+/**
+ * SPI of each daisy-chain, daisy-chain 0 first. Each SPI needs its own DMA
+ * streams in spi_cfg.c and its chip select in spi_cfg.h. Only spi_devices[0]
+ * is connected to the isoSPI interface of the BMS-Master, spi_devices[1] is
+ * used for the EEPROM and has no DMA.
+ */
+SPI_HandleType_s * const ltc_chain_spi[LTC_N_CHAINS] = {
+    LTC_SPI_HANDLE,
+};
+
+
+/**
+ * Scheduling parameters of the measurement jobs, must be adapted to the application.
+ * Cell voltages and multiplexer sequence are measured in every cycle and only
+ * monitored: their period is the target, the deadline the allowed delay beyond it.
+ * The other jobs are only started if their slice fits into the target period of
+ * the cell voltages, or into period and deadline if they are late themselves.
+ * Jobs with period 0 are only started on request (MEAS_Request_...()).
+ */
+const LTC_JOB_CFG_s ltc_job_cfg[LTC_JOB_NR_OF_JOBS] = {
+    /* priority, period_ms, deadline_ms, sliceTime_ms */
+    {0,   20,   30,  0},    /* LTC_JOB_VOLTAGE          */
+    {0,  200,  200,  0},    /* LTC_JOB_MUX_SEQUENCE     */
+    {1,   40,   60,  3},    /* LTC_JOB_BALANCECONTROL   */
+    {2,    0,  200,  5},    /* LTC_JOB_BALANCEFEEDBACK  */
+    {3,    0,  500,  8},    /* LTC_JOB_TEMP_SENS        */
+    {3,    0,  500,  8},    /* LTC_JOB_USER_IO          */
+    {4,    0, 1000,  8},    /* LTC_JOB_EEPROM           */
+    {5, LTC_OPENWIRE_JOB_PERIOD_ms, LTC_OPENWIRE_JOB_DEADLINE_ms, LTC_OPENWIRE_JOB_SLICE_ms},    /* LTC_JOB_OPENWIRE_CHECK   */
+};
+
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
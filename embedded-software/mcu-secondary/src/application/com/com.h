@@ -54,6 +54,11 @@
  * teston                     -- Enables testmode
  * printcontactorinfo         -- prints the contactor info (number of switches and the contactor hard switch entries
  * printdiaginfo              -- prints the diagnosis info
+ * printdbstats               -- get the access statistics of the database
+ * resetdbstats               -- reset the access statistics of the database
+ * freezehistory              -- stop recording the database history after the post-trigger time
+ * dumphistory                -- print the records of the frozen database history
+ * restarthistory             -- discard the database history and restart recording
  * gettime                    -- prints mcu time and date
  * getruntime                 -- get runtime since last reset
  * getoperatingtime           -- get total operating time
@@ -122,6 +127,14 @@ extern void COM_printTimeAndDate(void);
  */
 extern void COM_printHelpCommand(void);
 
+/**
+ * @brief Prints the next line of the database history if a dump was requested
+ *
+ * The history is printed line by line, this function needs to be called
+ * cyclically, e.g. in APPL_Aperiodic().
+ */
+extern void COM_printDatabaseHistory(void);
+
 
 /**
  * @brief UART_vWrite provides an interface to send data.
@@ -154,6 +167,7 @@ void SYSCALL_Init(void);
 
 __attribute__((weak)) void COM_Decoder(void);
 __attribute__((weak)) void COM_printHelpCommand(void);
+__attribute__((weak)) void COM_printDatabaseHistory(void);
 
 /*================== Function Implementations =============================*/
 
@@ -98,4 +98,5 @@ void APPL_Cyclic_100ms(void) {
 void APPL_Aperiodic(void) {
     COM_Decoder();
     COM_printHelpCommand();
+    COM_printDatabaseHistory();
 }
@@ -59,47 +59,39 @@
 #include "general.h"
 
 #include "batterysystem_cfg.h"
+#include "database_blocks_cfg.h"
 
 /*================== Macros and Definitions =================================*/
 
 /**
- * @brief maximum amount of data block
+ * @brief maximum number of change-notification subscriptions
  *
- * this value is extendible but limitation is done due to RAM consumption and performance
+ * see DB_Subscribe()
  */
-#define DATA_MAX_BLOCK_NR                24        /* max 24 Blocks currently supported*/
+#define DATA_MAX_SUBSCRIPTIONS           (8u)
 
 /**
- * @brief data block identification number
+ * @brief memory section of the history rings (internal SRAM)
+ *
+ * The history of a data block is configured in database_cfg.yml, see
+ * database_history.h
  */
-typedef enum {
-    DATA_BLOCK_00       =  0,
-    DATA_BLOCK_01       =  1,
-    DATA_BLOCK_02       =  2,
-    DATA_BLOCK_03       =  3,
-    DATA_BLOCK_04       =  4,
-    DATA_BLOCK_05       =  5,
-    DATA_BLOCK_06       =  6,
-    DATA_BLOCK_07       =  7,
-    DATA_BLOCK_08       =  8,
-    DATA_BLOCK_09       =  9,
-    DATA_BLOCK_10       = 10,
-    DATA_BLOCK_11       = 11,
-    DATA_BLOCK_12       = 12,
-    DATA_BLOCK_13       = 13,
-    DATA_BLOCK_14       = 14,
-    DATA_BLOCK_15       = 15,
-    DATA_BLOCK_16       = 16,
-    DATA_BLOCK_17       = 17,
-    DATA_BLOCK_18       = 18,
-    DATA_BLOCK_19       = 19,
-    DATA_BLOCK_20       = 20,
-    DATA_BLOCK_21       = 21,
-    DATA_BLOCK_22       = 22,
-    DATA_BLOCK_23       = 23,
-    DATA_BLOCK_MAX      = DATA_MAX_BLOCK_NR,
-} DATA_BLOCK_ID_TYPE_e;
+#define DATA_HISTORY_PLACEMENT
 
+/**
+ * @brief number of delta records after which the complete data block is
+ *        recorded again
+ *
+ * Decoding of the history starts at a complete record. A smaller value loses
+ * less records at the overwritten end of the ring, a larger value needs less
+ * memory per record.
+ */
+#define DATA_HISTORY_KEYFRAME_INTERVAL   (64u)
+
+/**
+ * @brief time in ms the history keeps recording after the freeze was triggered
+ */
+#define DATA_HISTORY_POST_TRIGGER_MS     (2000u)
 
 /**
  * @brief data block access types
@@ -116,6 +108,7 @@ typedef enum {
  */
 typedef struct {
     void *blockptr;
+    void *blockptr2;        /*!< second buffer of a double-buffered data block, otherwise NULL_PTR */
     uint16_t datalength;
 } DATA_BASE_HEADER_s;
 
@@ -123,38 +116,18 @@ typedef struct {
  * configuration struct of database device
  */
 typedef struct {
-    uint8_t nr_of_blockheader;
+    uint16_t nr_of_blockheader;
     DATA_BASE_HEADER_s *blockheaderptr;
 } DATA_BASE_HEADER_DEV_s;
 
-
 /**
- * Definitions for each database entry
- */
-#define DATA_BLOCK_ID_CELLVOLTAGE                   DATA_BLOCK_00
-#define DATA_BLOCK_ID_CELLTEMPERATURE               DATA_BLOCK_01
-#define DATA_BLOCK_ID_SOX                           DATA_BLOCK_02
-#define DATA_BLOCK_ID_BALANCING_CONTROL_VALUES      DATA_BLOCK_03
-#define DATA_BLOCK_ID_BALANCING_FEEDBACK_VALUES     DATA_BLOCK_04
-#define DATA_BLOCK_ID_CURRENT_SENSOR                DATA_BLOCK_05
-#define DATA_BLOCK_ID_HW_INFO                       DATA_BLOCK_06
-#define DATA_BLOCK_ID_STATEREQUEST                  DATA_BLOCK_07
-#define DATA_BLOCK_ID_MINMAX                        DATA_BLOCK_08
-#define DATA_BLOCK_ID_ISOGUARD                      DATA_BLOCK_09
-#define DATA_BLOCK_ID_SLAVE_CONTROL                 DATA_BLOCK_10
-#define DATA_BLOCK_ID_OPEN_WIRE                     DATA_BLOCK_11
-#define DATA_BLOCK_ID_LTC_DEVICE_PARAMETER          DATA_BLOCK_12
-#define DATA_BLOCK_ID_LTC_ACCURACY                  DATA_BLOCK_13
-#define DATA_BLOCK_ID_ERRORSTATE                    DATA_BLOCK_14
-#define DATA_BLOCK_ID_MSL                           DATA_BLOCK_15
-#define DATA_BLOCK_ID_RSL                           DATA_BLOCK_16
-#define DATA_BLOCK_ID_MOL                           DATA_BLOCK_17
-#define DATA_BLOCK_ID_MOV_AVERAGE                   DATA_BLOCK_18
-#define DATA_BLOCK_ID_CONTFEEDBACK                  DATA_BLOCK_19
-#define DATA_BLOCK_ID_ILCKFEEDBACK                  DATA_BLOCK_20
-#define DATA_BLOCK_ID_SYSTEMSTATE                   DATA_BLOCK_21
-#define DATA_BLOCK_ID_SOF                           DATA_BLOCK_22
-#define DATA_BLOCK_ID_ALLGPIOVOLTAGE                DATA_BLOCK_23
+ * configuration struct of the history of a data block
+ */
+typedef struct {
+    DATA_BLOCK_ID_TYPE_e blockID;   /*!< recorded data block                */
+    uint8_t *ringptr;               /*!< ring buffer of the records         */
+    uint32_t ringsize;              /*!< size of the ring buffer in bytes   */
+} DATA_HISTORY_CFG_s;
 
 
 /**
@@ -169,6 +142,8 @@ typedef struct {
     uint32_t sumOfCells[BS_NR_OF_MODULES];      /*!< unit: mV                                            */
     uint8_t valid_socPECs[BS_NR_OF_MODULES];    /*!< 0 -> if PEC okay; 1 -> PEC error                    */
     uint32_t packVoltage_mV;                    /*!< uint: mV                                            */
+    uint16_t measurementPeriod_ms;              /*!< achieved period of the cell voltage measurement     */
+    uint8_t adcMode;                            /*!< LTC ADC mode of the measurement (LTC_ADCMODE_e)     */
     uint8_t state;                              /*!< for future use                                      */
 } DATA_BLOCK_CELLVOLTAGE_s;
 
@@ -180,6 +155,7 @@ typedef struct {
     uint32_t timestamp;                     /*!< timestamp of database entry                */
     uint32_t previous_timestamp;            /*!< timestamp of last database entry           */
     uint8_t openwire[BS_NR_OF_MODULES * (BS_NR_OF_BAT_CELLS_PER_MODULE+1)];   /*!< 1 -> open wire, 0 -> everything ok */
+    uint32_t completed_checks;              /*!< number of open-wire checks that covered all cells */
     uint8_t state;                          /*!< for future use                       */
 } DATA_BLOCK_OPENWIRE_s;
 
@@ -192,6 +168,7 @@ typedef struct {
     uint32_t previous_timestamp;                   /*!< timestamp of last database entry                        */
     int16_t temperature[BS_NR_OF_TEMP_SENSORS];    /*!< unit: degree Celsius                                    */
     uint16_t valid_temperature[BS_NR_OF_MODULES];  /*!< bitmask if temperatures are valid. 0->valid, 1->invalid */
+    uint16_t refreshTime_ms;                       /*!< time to measure all temperature sensors of the pack     */
     uint8_t state;                                 /*!< for future use                                          */
 } DATA_BLOCK_CELLTEMPERATURE_s;
 
@@ -205,6 +182,11 @@ typedef struct {
     float soc_mean;                     /*!< 0.0 <= soc_mean <= 100.0           */
     float soc_min;                      /*!< 0.0 <= soc_min <= 100.0            */
     float soc_max;                      /*!< 0.0 <= soc_max <= 100.0            */
+    uint16_t soc_cell[BS_NR_OF_BAT_CELLS];  /*!< SOC of every cell, unit: 0.01%  */
+    float soc_ekf_mean;                 /*!< SOC estimated by the Kalman filter, unit: %        */
+    float soc_ekf_min;                  /*!< minimum SOC estimated by the Kalman filter, unit: % */
+    float soc_ekf_max;                  /*!< maximum SOC estimated by the Kalman filter, unit: % */
+    float soc_ekf_variance;             /*!< largest variance of the estimated SOC, unit: %^2   */
     uint8_t state;                      /*!<                                    */
 } DATA_BLOCK_SOX_s;
 
@@ -557,6 +539,19 @@ typedef struct {
  */
 extern const DATA_BASE_HEADER_DEV_s data_base_dev;
 
+#if DATA_HISTORY_NR > 0
+/**
+ * @brief history rings of the data blocks, generated from database_cfg.yml
+ */
+extern const DATA_HISTORY_CFG_s data_history_cfg[DATA_HISTORY_NR];
+
+/**
+ * @brief buffer of the record that is appended to a history ring, generated
+ *        from database_cfg.yml
+ */
+extern uint8_t data_history_record[];
+#endif /* DATA_HISTORY_NR > 0 */
+
 /*================== Extern Function Prototypes =============================*/
 
 #endif /* DATABASE_CFG_H_ */
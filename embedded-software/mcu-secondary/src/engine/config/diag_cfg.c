@@ -189,6 +189,9 @@ DIAG_CH_CFG_s  diag_ch_cfg[] = {
     /* Plausibility checks */
     {DIAG_CH_PLAUSIBILITY_CELL_VOLTAGE,    "PL_CELL_VOLT",    DIAG_ERROR_SENSITIVITY_HIGH, DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_plausibility_check},
     {DIAG_CH_PLAUSIBILITY_CELL_TEMP,       "PL_CELL_TEMP",    DIAG_ERROR_SENSITIVITY_HIGH, DIAG_RECORDING_ENABLED, DIAG_ENABLED, DIAG_error_plausibility_check},
+
+    /* LTC measurement jobs */
+    {DIAG_CH_LTC_JOB_DEADLINE,                          "LTC_JOB_DEADLINE",                     DIAG_ERROR_SENSITIVITY_HIGH,              DIAG_RECORDING_ENABLED, DIAG_ENABLED, dummyfu},
 };
 
 
@@ -208,9 +211,26 @@ DIAG_SYSMON_CH_CFG_s diag_sysmon_ch_cfg[] = {
 };
 
 
+/**
+ * diagnosis channels that freeze the history of the database (see
+ * database_history.h) when their error occurs, so the records before the
+ * violation of a maximum safety limit are kept for analysis
+ */
+static const DIAG_CH_ID_e diag_history_trigger[] = {
+    DIAG_CH_CELLVOLTAGE_OVERVOLTAGE_MSL,
+    DIAG_CH_CELLVOLTAGE_UNDERVOLTAGE_MSL,
+    DIAG_CH_TEMP_OVERTEMPERATURE_CHARGE_MSL,
+    DIAG_CH_TEMP_OVERTEMPERATURE_DISCHARGE_MSL,
+    DIAG_CH_TEMP_UNDERTEMPERATURE_CHARGE_MSL,
+    DIAG_CH_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL,
+};
+
+
 DIAG_DEV_s  diag_dev = {
     .nr_of_ch   = sizeof(diag_ch_cfg)/sizeof(DIAG_CH_CFG_s),
     .ch_cfg     = &diag_ch_cfg[0],
+    .nr_of_history_triggers = sizeof(diag_history_trigger)/sizeof(DIAG_CH_ID_e),
+    .history_trigger        = &diag_history_trigger[0],
 };
 
 /*================== Static Function Implementations ========================*/
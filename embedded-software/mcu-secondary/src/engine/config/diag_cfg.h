@@ -105,7 +105,7 @@ typedef enum {
     DIAG_CH_CALIB_EEPR_FAILURE,                     /*  */
     DIAG_CH_CAN_INIT_FAILURE,                       /*  */
     DIAG_CH_VIC_INIT_FAILURE,
-    /* HW-/SW-Runtime events: 16-31 */
+    /* HW-/SW-Runtime events: 7-16 */
     DIAG_CH_DIV_BY_ZERO_FAILURE,                    /*  */
     DIAG_CH_UNDEF_INSTRUCTION_FAILURE,              /*  */
     DIAG_CH_DATA_BUS_FAILURE,                       /*  */
@@ -116,7 +116,7 @@ typedef enum {
     DIAG_CH_RUNTIME_ERROR_RESERVED_3,               /*  reserved for future needs */
     DIAG_CH_CONFIGASSERT,                           /*  */
     DIAG_CH_SYSTEMMONITORING_TIMEOUT,               /*  */
-    /* Measurement events: 32-47 */
+    /* Measurement events: 17-33 */
     DIAG_CH_CANS_MAX_VALUE_VIOLATE,
     DIAG_CH_CANS_MIN_VALUE_VIOLATE,
     DIAG_CH_CANS_CAN_MOD_FAILURE,
@@ -135,7 +135,7 @@ typedef enum {
     DIAG_CH_LTC_MUX,                                /* LTC */
     DIAG_CH_LTC_CONFIG,                             /* LTC */
 
-/* Contactor events: 64-79 */
+/* Contactor events: 34-37 */
     DIAG_CH_CONTACTOR_DAMAGED, /* Opening contactor at over current */
     DIAG_CH_CONTACTOR_OPENING, /* counter for contactor opening */
     DIAG_CH_CONTACTOR_CLOSING, /* counter for contactor closing */
@@ -147,6 +147,8 @@ typedef enum {
     DIAG_CH_CRIT_LOW_COIN_CELL_VOLTAGE, /* coin cell voltage */
     DIAG_CH_PLAUSIBILITY_CELL_VOLTAGE, /* plausibility checks */
     DIAG_CH_PLAUSIBILITY_CELL_TEMP, /* plausibility checks */
+    /* Channels added later are appended to keep the ids of the channels above */
+    DIAG_CH_LTC_JOB_DEADLINE,                       /* LTC measurement job started after its deadline */
     DIAG_ID_MAX, /* MAX indicator - do not change */
 } DIAG_CH_ID_e;
 
@@ -239,6 +241,8 @@ typedef struct {
 typedef struct {
     uint8_t nr_of_ch;       /*!< number of entries in DIAG_CH_CFG_s */
     DIAG_CH_CFG_s *ch_cfg;  /*!< pointer to diag channel config struct */
+    uint8_t nr_of_history_triggers;         /*!< number of entries in history_trigger */
+    const DIAG_CH_ID_e *history_trigger;    /*!< channels that freeze the database history when their error occurs */
 } DIAG_DEV_s;
 
 /**
@@ -88,6 +88,28 @@
 /* #define LTC_DISCARD_MUX_CHECK TRUE */
 #define LTC_DISCARD_MUX_CHECK FALSE
 
+/**
+ * Pipelined measurement cycle: the multiplexer is configured while the cell voltages
+ * are converted and the multiplexer input is converted while the cell voltages are read.
+ * If FALSE, the conversions and the multiplexer configuration are done one after another.
+ */
+/* #define LTC_PIPELINED_MEASUREMENT TRUE */
+#define LTC_PIPELINED_MEASUREMENT FALSE
+
+/**
+ * The pipelined measurement cycle sends commands to the LTCs while their ADC is converting:
+ * the multiplexer input is selected over I2C (WRCOMM/STCOMM) during the cell voltage
+ * conversion (ADCV) and the cell voltages are read (RDCV) during the multiplexer input
+ * conversion (ADAX). Set to TRUE only if the data sheet of the used LTC allows these
+ * commands during a conversion in the configured ADC modes.
+ */
+/* #define LTC_COMMANDS_DURING_CONVERSION_ALLOWED TRUE */
+#define LTC_COMMANDS_DURING_CONVERSION_ALLOWED FALSE
+
+#if (LTC_PIPELINED_MEASUREMENT == TRUE) && (LTC_COMMANDS_DURING_CONVERSION_ALLOWED != TRUE)
+#error "The pipelined measurement cycle needs LTC_COMMANDS_DURING_CONVERSION_ALLOWED"
+#endif
+
 /**
  * Number of used LTC-ICs
  */
@@ -115,6 +137,17 @@
  */
 #define LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE 8
 
+/**
+ * Batched multiplexer measurement: instead of one step of the multiplexer
+ * sequence, up to LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE steps are measured
+ * in each measurement cycle (until the end of the sequence). Consecutive steps
+ * on a temperature multiplexer (GPIO1) and on a user multiplexer (GPIO2) are
+ * selected together and converted with one ADAX command. The default sequence
+ * only uses multiplexer 0, so its steps are converted one by one.
+ */
+/* #define LTC_MUX_BATCHED_MEASUREMENT TRUE */
+#define LTC_MUX_BATCHED_MEASUREMENT FALSE
+
 /**
  * Number of multiplexed channels per LTC-IC
  */
@@ -132,6 +165,47 @@
 /* #define LTC_VOLTAGE_MEASUREMENT_MODE LTC_ADCMODE_FILTERED_DCP0 */
 /* #define LTC_VOLTAGE_MEASUREMENT_MODE LTC_ADCMODE_FAST_DCP0 */
 
+/**
+ * Adaptive measurement mode for voltages: at the start of every measurement
+ * cycle, the mode is selected from the current sensor data. At a high change
+ * of current the fast mode is used for a short latency, after the battery has
+ * been at rest for LTC_ADAPTIVE_REST_TIME_ms the filtered mode for accuracy,
+ * otherwise LTC_VOLTAGE_MEASUREMENT_MODE. Without valid current measurements,
+ * LTC_VOLTAGE_MEASUREMENT_MODE is used.
+ */
+/* #define LTC_ADAPTIVE_ADC_MODE TRUE */
+#define LTC_ADAPTIVE_ADC_MODE FALSE
+
+/**
+ * Change of current in mA/s from which on the fast mode is used
+ */
+#define LTC_ADAPTIVE_FAST_DIDT_mA_per_s     20000
+
+/**
+ * Time in ms the fast mode is kept after the last high change of current
+ */
+#define LTC_ADAPTIVE_FAST_HOLD_TIME_ms      1000
+
+/**
+ * Current in mA (absolute value) below which the battery is at rest
+ */
+#define LTC_ADAPTIVE_REST_CURRENT_mA        1000
+
+/**
+ * Change of current in mA/s below which the battery is at rest
+ */
+#define LTC_ADAPTIVE_REST_DIDT_mA_per_s     500
+
+/**
+ * Time in ms the battery has to be at rest before the filtered mode is used
+ */
+#define LTC_ADAPTIVE_REST_TIME_ms           10000
+
+/**
+ * Age in ms from which on a current measurement is not used anymore
+ */
+#define LTC_ADAPTIVE_CURRENT_TIMEOUT_ms     500
+
 /**
  *  Measurement modus for GPIOs
  */
@@ -161,6 +235,26 @@
 
 #define LTC_SPI_PRESCALER   *LTC_SPI_HANDLE.Init.BaudRatePrescaler
 
+/**
+ * Number of daisy-chains. Each daisy-chain is connected to its own SPI (see
+ * ltc_chain_spi[] in ltc_cfg.c). Daisy-chain 0 contains the first
+ * LTC_N_LTC_PER_CHAIN modules, daisy-chain 1 the next ones and so on.
+ * All SPIs must use the same clock as LTC_SPI_HANDLE.
+ * The transmissions are started one daisy-chain after the other, only their
+ * DMA transfers overlap. The BMS-Master has a single isoSPI interface
+ * (spi_devices[0]), so more than one daisy-chain needs additional hardware.
+ */
+#define LTC_N_CHAINS        1
+
+/**
+ * Number of LTCs in each daisy-chain
+ */
+#define LTC_N_LTC_PER_CHAIN     (LTC_N_LTC/LTC_N_CHAINS)
+
+#if (LTC_N_LTC % LTC_N_CHAINS) != 0
+#error "The number of LTCs must be a multiple of the number of daisy-chains"
+#endif
+
 /**
  * start definition of LTC timings
  * Twake (see LTC datasheet)
@@ -186,12 +280,12 @@
  * time for the first initialization of the daisy chain
  * see LTC6804 datasheet page 41
  */
-#define LTC_STATEMACH_DAISY_CHAIN_FIRST_INITIALIZATION_TIME     ((LTC_TWAKE_US*LTC_N_LTC)/1000)
+#define LTC_STATEMACH_DAISY_CHAIN_FIRST_INITIALIZATION_TIME     ((LTC_TWAKE_US*LTC_N_LTC_PER_CHAIN)/1000)
 /**
  * time for the second initialization of the daisy chain
  * see LTC6804 datasheet page 41
  */
-#define LTC_STATEMACH_DAISY_CHAIN_SECOND_INITIALIZATION_TIME    ((LTC_TREADY_US*LTC_N_LTC)/1000)
+#define LTC_STATEMACH_DAISY_CHAIN_SECOND_INITIALIZATION_TIME    ((LTC_TREADY_US*LTC_N_LTC_PER_CHAIN)/1000)
 
 
 /*
@@ -267,11 +361,11 @@
 
 /**
  * ------------------- OPEN WIRE CHECK ------------------------
- * If open-wire check is performed cell voltages and temperatures are not
- * updated and thus old values can be transmitted on the CAN bus. Check time
- * is dependent on module configuration and external capacitance. Activate
- * open-wire check with care! See table below for various measured open-wire
- * check durations!
+ * The open-wire check is split into a pull-up and a pull-down slice, which are
+ * started by the measurement scheduler in two different measurement cycles
+ * (see ltc_job_cfg[]). Check time is dependent on module configuration and
+ * external capacitance. Each slice must fit into the deadline of the cell
+ * voltages, see table below for various measured open-wire check durations!
  */
 
 /* #define LTC_STANDBY_PERIODIC_OPEN_WIRE_CHECK TRUE */
@@ -306,7 +400,7 @@
 /**
  * Number of required ADOW commands because of external C-Pin capacitance and
  * the respective duration to perform an open wire check for 14 modules with
- * 12 cells each. During this time no cell voltages and temperatures are measured!
+ * 12 cells each (both slices).
  * +----------------+--------------+---------------+----------+----------+
  * | External C pin | Normal  mode | Filtered mode | Duration | Duration |
  * | capacitance    |              |               |  normal  | filtered |
@@ -319,6 +413,50 @@
  */
 #define LTC_NMBR_REQ_ADOW_COMMANDS      2
 
+/**
+ * Distributed open-wire check: each open-wire job checks only one group of cell
+ * inputs (ADOW channel selection: inputs n, n+6 and n+12, for the 15 cell
+ * LTC6812 inputs n, n+5 and n+10) of all modules. The job is started
+ * periodically by the measurement scheduler, so that the whole battery pack is
+ * checked within LTC_OPENWIRE_COVERAGE_TIME_ms without delaying the cell
+ * voltages. The periodic open-wire checks above are not needed in this mode.
+ */
+/* #define LTC_OPENWIRE_DISTRIBUTED TRUE */
+#define LTC_OPENWIRE_DISTRIBUTED FALSE
+
+/**
+ * Time in ms in which the distributed open-wire check covers all cells,
+ * unless the scheduler reports a missed deadline of the open-wire job
+ */
+#define LTC_OPENWIRE_COVERAGE_TIME_ms   1200
+
+/**
+ * Number of consecutive detections before a wire is set open in the distributed
+ * open-wire check (a complete open-wire check sets it at the first detection)
+ */
+#define LTC_OPENWIRE_CONFIRMATIONS      2
+
+#if BS_MAX_SUPPORTED_CELLS == 15
+#define LTC_OPENWIRE_NR_OF_CELL_GROUPS  5
+#else
+#define LTC_OPENWIRE_NR_OF_CELL_GROUPS  6
+#endif
+
+/**
+ * Period, deadline and initial slice time in ms of the open-wire job. In the
+ * distributed mode one cell group is checked every period, period and
+ * deadline together cover all groups within LTC_OPENWIRE_COVERAGE_TIME_ms.
+ */
+#if LTC_OPENWIRE_DISTRIBUTED == TRUE
+#define LTC_OPENWIRE_JOB_PERIOD_ms      (LTC_OPENWIRE_COVERAGE_TIME_ms / (2 * LTC_OPENWIRE_NR_OF_CELL_GROUPS))
+#define LTC_OPENWIRE_JOB_DEADLINE_ms    LTC_OPENWIRE_JOB_PERIOD_ms
+#define LTC_OPENWIRE_JOB_SLICE_ms       4
+#else
+#define LTC_OPENWIRE_JOB_PERIOD_ms      0
+#define LTC_OPENWIRE_JOB_DEADLINE_ms    2000
+#define LTC_OPENWIRE_JOB_SLICE_ms       12
+#endif
+
 /**
  * Number of Bytes to be transmitted in daisy-chain
  * For first 4 Bytes:
@@ -337,13 +475,28 @@
  */
 #define LTC_N_BYTES_FOR_DATA_TRANSMISSION_DATA_ONLY   (0+(6*LTC_N_LTC))
 
+/**
+ * Number of Bytes to be transmitted in one daisy-chain
+ * (command and data of LTC_N_LTC_PER_CHAIN LTCs)
+ */
+#define LTC_N_BYTES_FOR_CHAIN_TRANSMISSION   (4+(8*LTC_N_LTC_PER_CHAIN))
+
 
-/* Transmit functions */
-#define LTC_SendWakeUp()                SPI_Transmit(LTC_SPI_HANDLE, (uint8_t *) ltc_cmdDummy, 1)
-#define LTC_SendI2CCmd(txbuf)           SPI_Transmit(LTC_SPI_HANDLE, txbuf, 4+9)
-#define LTC_SendData(txbuf)             SPI_Transmit(LTC_SPI_HANDLE, txbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION)
-#define LTC_SendCmd(command)            SPI_Transmit(LTC_SPI_HANDLE, (uint8_t *) command, 4)
-#define LTC_ReceiveData(txbuf, rxbuf)    SPI_TransmitReceive(LTC_SPI_HANDLE, txbuf, rxbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION)
+/* Transmit functions of one daisy-chain, answered by the emulation (ltcemu.h) if enabled */
+#if BUILD_MODULE_ENABLE_LTC_EMULATION == 1
+#define LTC_ChainTransmit(chain, txbuf, size)               LTCEMU_Transmit((chain)*LTC_N_LTC_PER_CHAIN, txbuf, size)
+#define LTC_ChainTransmitReceive(chain, txbuf, rxbuf, size)  LTCEMU_TransmitReceive((chain)*LTC_N_LTC_PER_CHAIN, txbuf, rxbuf, size)
+#else
+#define LTC_ChainTransmit(chain, txbuf, size)               SPI_Transmit(ltc_chain_spi[(chain)], txbuf, size)
+#define LTC_ChainTransmitReceive(chain, txbuf, rxbuf, size)  SPI_TransmitReceive(ltc_chain_spi[(chain)], txbuf, rxbuf, size)
+#endif
+
+/* Transmit functions, to all daisy-chains one after the other (see ltc.c) */
+#define LTC_SendWakeUp()                LTC_TransmitAllChains((uint8_t *) ltc_cmdDummy, 1)
+#define LTC_SendI2CCmd(txbuf)           LTC_TransmitAllChains(txbuf, 4+9)
+#define LTC_SendData(txbuf)             LTC_TransmitDataAllChains(txbuf)
+#define LTC_SendCmd(command)            LTC_TransmitAllChains((uint8_t *) command, 4)
+#define LTC_ReceiveData(txbuf, rxbuf)    LTC_ReceiveDataAllChains(txbuf, rxbuf)
 
 
 /*================== Constant and Variable Definitions ====================*/
@@ -365,6 +518,16 @@ extern const uint8_t ltc_muxsensortemperatur_cfg[BS_NR_OF_TEMP_SENSORS_PER_MODUL
  */
 extern const uint8_t ltc_voltage_input_used[BS_MAX_SUPPORTED_CELLS];
 
+/**
+ * SPI of each daisy-chain
+ */
+extern SPI_HandleType_s * const ltc_chain_spi[LTC_N_CHAINS];
+
+/**
+ * Scheduling parameters of the measurement jobs, indexed by LTC_JOB_e
+ */
+extern const LTC_JOB_CFG_s ltc_job_cfg[LTC_JOB_NR_OF_JOBS];
+
 /*================== Function Prototypes ==================================*/
 
 /**
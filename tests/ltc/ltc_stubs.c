@@ -0,0 +1,214 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_stubs.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Database, diag, OS and SPI stubs of the LTC host tests
+ */
+
+/*================== Includes =============================================*/
+#include "ltc_stubs.h"
+
+#include <string.h>
+#include "os.h"
+#include "spi.h"
+
+/*================== Constant and Variable Definitions ====================*/
+DATA_BLOCK_CELLVOLTAGE_s test_cellvoltage;
+DATA_BLOCK_CELLTEMPERATURE_s test_celltemperature;
+uint32_t test_tick = 0;
+uint32_t test_diag_nok[DIAG_ID_MAX];
+
+static DATA_BLOCK_ALLGPIOVOLTAGE_s test_allgpiovoltage;
+static DATA_BLOCK_BALANCING_CONTROL_s test_balancing_control;
+static DATA_BLOCK_BALANCING_FEEDBACK_s test_balancing_feedback;
+static DATA_BLOCK_CURRENT_SENSOR_s test_current;
+static DATA_BLOCK_MINMAX_s test_minmax;
+static DATA_BLOCK_OPENWIRE_s test_openwire;
+static DATA_BLOCK_SLAVE_CONTROL_s test_slave_control;
+
+/** SPI of the LTC daisy-chain, APB2 clock with prescaler 128 as in spi_cfg.c */
+SPI_HandleType_s spi_devices[] = {
+    {
+        .Instance = SPI1,
+        .Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_128,
+    },
+};
+
+/*================== Function Prototypes ==================================*/
+static void *TEST_GetBlock(DATA_BLOCK_ID_TYPE_e blockID, uint32_t *size);
+
+/*================== Function Implementations =============================*/
+
+/**
+ * @brief   gets the storage of a data block.
+ *
+ * @param   blockID     ID of the data block
+ * @param   size        size of the data block in bytes
+ *
+ * @return  pointer to the storage of the data block
+ */
+static void *TEST_GetBlock(DATA_BLOCK_ID_TYPE_e blockID, uint32_t *size) {
+    void *block = NULL_PTR;
+
+    switch (blockID) {
+        case DATA_BLOCK_ID_CELLVOLTAGE:
+            block = &test_cellvoltage;
+            *size = sizeof(test_cellvoltage);
+            break;
+        case DATA_BLOCK_ID_CELLTEMPERATURE:
+            block = &test_celltemperature;
+            *size = sizeof(test_celltemperature);
+            break;
+        case DATA_BLOCK_ID_ALLGPIOVOLTAGE:
+            block = &test_allgpiovoltage;
+            *size = sizeof(test_allgpiovoltage);
+            break;
+        case DATA_BLOCK_ID_BALANCING_CONTROL_VALUES:
+            block = &test_balancing_control;
+            *size = sizeof(test_balancing_control);
+            break;
+        case DATA_BLOCK_ID_BALANCING_FEEDBACK_VALUES:
+            block = &test_balancing_feedback;
+            *size = sizeof(test_balancing_feedback);
+            break;
+        case DATA_BLOCK_ID_CURRENT_SENSOR:
+            block = &test_current;
+            *size = sizeof(test_current);
+            break;
+        case DATA_BLOCK_ID_MINMAX:
+            block = &test_minmax;
+            *size = sizeof(test_minmax);
+            break;
+        case DATA_BLOCK_ID_OPEN_WIRE:
+            block = &test_openwire;
+            *size = sizeof(test_openwire);
+            break;
+        case DATA_BLOCK_ID_SLAVE_CONTROL:
+            block = &test_slave_control;
+            *size = sizeof(test_slave_control);
+            break;
+        default:
+            *size = 0;
+            break;
+    }
+    return block;
+}
+
+STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e blockID) {
+    uint32_t size = 0;
+    void *block = TEST_GetBlock(blockID, &size);
+
+    if (block == NULL_PTR) {
+        return E_NOT_OK;
+    }
+    memcpy(dataptrtoReceiver, block, size);
+    return E_OK;
+}
+
+void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e blockID) {
+    uint32_t size = 0;
+    void *block = TEST_GetBlock(blockID, &size);
+
+    if (block != NULL_PTR) {
+        memcpy(block, dataptrfromSender, size);
+    }
+}
+
+DIAG_RETURNTYPE_e DIAG_Handler(DIAG_CH_ID_e diag_ch_id, DIAG_EVENT_e event, uint32_t item_nr) {
+    (void)item_nr;
+    if (event == DIAG_EVENT_NOK) {
+        test_diag_nok[diag_ch_id]++;
+    }
+    return DIAG_HANDLER_RETURN_OK;
+}
+
+STD_RETURN_TYPE_e DIAG_checkEvent(STD_RETURN_TYPE_e cond, DIAG_CH_ID_e diag_ch_id, uint32_t item_nr) {
+    DIAG_Handler(diag_ch_id, (cond == E_OK) ? DIAG_EVENT_OK : DIAG_EVENT_NOK, item_nr);
+    return cond;
+}
+
+void DIAG_SysMonNotify(DIAG_SYSMON_MODULE_ID_e module_id, uint32_t state) {
+    (void)module_id;
+    (void)state;
+}
+
+uint32_t OS_getOSSysTick(void) {
+    return test_tick;
+}
+
+void OS_TaskEnter_Critical(void) {
+}
+
+void OS_TaskExit_Critical(void) {
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+    return 45000000u;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void) {
+    return 90000000u;
+}
+
+STD_RETURN_TYPE_e SPI_Transmit(SPI_HandleType_s *hspi, uint8_t *pData, uint16_t Size) {
+    (void)hspi;
+    (void)pData;
+    (void)Size;
+    return E_NOT_OK;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceive(SPI_HandleType_s *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size) {
+    (void)hspi;
+    (void)pTxData;
+    (void)pRxData;
+    (void)Size;
+    return E_NOT_OK;
+}
+
+STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void) {
+    return FALSE;
+}
@@ -0,0 +1,87 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    database_blocks_cfg.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  DATA
+ *
+ * @brief   Replacement of the generated database block IDs for host tests
+ *
+ * Only the data blocks read or written by the LTC module are listed.
+ */
+
+#ifndef DATABASE_BLOCKS_CFG_H_
+#define DATABASE_BLOCKS_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+/**
+ * @brief number of data blocks in the database
+ */
+#define DATA_MAX_BLOCK_NR   (9u)
+
+/**
+ * @brief number of data blocks with a history ring
+ */
+#define DATA_HISTORY_NR     (0u)
+
+/**
+ * @brief data block identification number
+ */
+typedef enum {
+    DATA_BLOCK_ID_CELLVOLTAGE               = 0,
+    DATA_BLOCK_ID_CELLTEMPERATURE           = 1,
+    DATA_BLOCK_ID_ALLGPIOVOLTAGE            = 2,
+    DATA_BLOCK_ID_BALANCING_CONTROL_VALUES  = 3,
+    DATA_BLOCK_ID_BALANCING_FEEDBACK_VALUES = 4,
+    DATA_BLOCK_ID_CURRENT_SENSOR            = 5,
+    DATA_BLOCK_ID_MINMAX                    = 6,
+    DATA_BLOCK_ID_OPEN_WIRE                 = 7,
+    DATA_BLOCK_ID_SLAVE_CONTROL             = 8,
+    DATA_BLOCK_MAX                          = DATA_MAX_BLOCK_NR,
+} DATA_BLOCK_ID_TYPE_e;
+
+#endif /* DATABASE_BLOCKS_CFG_H_ */
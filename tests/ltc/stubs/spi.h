@@ -0,0 +1,95 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    spi.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  SPI
+ *
+ * @brief   Replacement of the SPI driver for host tests, implemented in ltc_stubs.c
+ *
+ * The frames of the LTC module go to the LTC emulator, so only the handle
+ * fields read by ltc.c and the transfer state are needed.
+ */
+
+#ifndef SPI_H_
+#define SPI_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+/** SPI peripherals compared by LTC_GetSPIClock() */
+#define SPI1    ((void *)1)
+#define SPI2    ((void *)2)
+#define SPI3    ((void *)3)
+#define SPI4    ((void *)4)
+#define SPI5    ((void *)5)
+#define SPI6    ((void *)6)
+
+/** SPI prescaler of 128, as in spi_cfg.c */
+#define SPI_BAUDRATEPRESCALER_128   (0x30u)
+
+#define SPI_WAKEUP_WAIT_TIME        0
+
+/**
+ * SPI handle with the fields read by the LTC module
+ */
+typedef struct {
+    void *Instance;                     /*!< SPI peripheral             */
+    struct {
+        uint32_t BaudRatePrescaler;     /*!< prescaler of the SPI clock */
+    } Init;
+} SPI_HandleType_s;
+
+/*================== Constant and Variable Definitions ====================*/
+extern SPI_HandleType_s spi_devices[];
+
+/*================== Function Prototypes ==================================*/
+extern uint32_t HAL_RCC_GetPCLK1Freq(void);
+extern uint32_t HAL_RCC_GetPCLK2Freq(void);
+extern STD_RETURN_TYPE_e SPI_Transmit(SPI_HandleType_s *hspi, uint8_t *pData, uint16_t Size);
+extern STD_RETURN_TYPE_e SPI_TransmitReceive(SPI_HandleType_s *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+extern STD_RETURN_TYPE_e SPI_IsTransmitOngoing(void);
+
+#endif /* SPI_H_ */
@@ -0,0 +1,385 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltc_mux.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test of the batched multiplexer measurement of the LTC module
+ *
+ * ltc.c is included with LTC_MUX_BATCHED_MEASUREMENT set to TRUE, so that its
+ * static functions can be called, and sends its frames to the LTC emulator.
+ *
+ * - LTC_MuxStepJoinsConversion() groups a mixed sequence into conversions of
+ *   one temperature (GPIO1) and one user multiplexer (GPIO2) step and never
+ *   joins two steps of the default sequence, which are all on multiplexer 0.
+ * - LTC_SaveMuxMeasurement() stores the values of a joined conversion and
+ *   a PEC error only invalidates the measured sensor of the affected LTC.
+ * - LTC_Trigger() measures the mixed and the default sequence with the
+ *   expected number of ADAX commands and stores the emulated values.
+ *
+ * Build and run from the repository root:
+ *
+ *     P=embedded-software/mcu-primary/src; C=embedded-software/mcu-common/src
+ *     gcc -std=c99 -DTEST_NR_OF_MODULES=4 -Itests/ltc/stubs -Itests/ltc -I$C/module/ltc -I$P/module/config \
+ *         -I$P/engine/config -I$P/general/config -I$C/engine/database -I$C/engine/diag -I$C/driver/ltcemu -I$C/util \
+ *         tests/ltc/test_ltc_mux.c tests/ltc/ltc_stubs.c $P/module/config/ltc_cfg.c $C/module/ltc/ltc_pec.c \
+ *         $C/module/ltc/slaveplausibility.c $C/driver/ltcemu/ltcemu.c -lm -o test_ltc_mux
+ *     ./test_ltc_mux
+ */
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+#undef LTC_MUX_BATCHED_MEASUREMENT
+#define LTC_MUX_BATCHED_MEASUREMENT TRUE
+
+#include "ltc.c"
+
+#include <stdio.h>
+#include "ltc_stubs.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** number of steps of the mixed multiplexer sequence */
+#define TEST_MIXED_STEPS        10u
+
+/** number of ADAX commands for the mixed sequence (see test_mixed_seq) */
+#define TEST_MIXED_CONVERSIONS  5u
+
+/**
+ * temperature in degC of the inputs of multiplexer 0, distinct for every LTC
+ * and channel (at most 4 LTCs)
+ */
+#define TEST_TEMPERATURE(device, ch)        ((int16_t)(8u*(device) + (ch)))
+
+/**
+ * raw value of the inputs of multiplexer 0 in 100uV: ltc_cfg.c converts 1V to
+ * 10 degC, the 50mV offset keeps the float conversion from truncating below
+ * TEST_TEMPERATURE()
+ */
+#define TEST_RAW_TEMPERATURE(device, ch)    ((uint16_t)(1000u*(uint16_t)TEST_TEMPERATURE(device, ch) + 500u))
+
+/**
+ * raw value of the inputs of the user multiplexers in 100uV, stored in mV,
+ * with 0.05mV offset against truncation
+ */
+#define TEST_RAW_USER(device, mux, ch)      ((uint16_t)(20005u + 1000u*(device) + 100u*(mux) + 10u*(ch)))
+#define TEST_USER_mV(device, mux, ch)       ((uint16_t)(TEST_RAW_USER(device, mux, ch)/10u))
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * Temperature multiplexer 0 (GPIO1) mixed with the user multiplexer 1 (GPIO2),
+ * with the user multiplexer 2, which is also connected to GPIO2, switched off.
+ * 5 conversions in 2 measurement cycles, as commented.
+ */
+static LTC_MUX_CH_CFG_s test_mixed_seq[TEST_MIXED_STEPS] = {
+    {2, 0xFF},          /* switched off, no conversion                  */
+    {0, 0}, {1, 0},     /* GPIO1 + GPIO2                                */
+    {0, 1}, {1, 1},     /* GPIO1 + GPIO2                                */
+    {1, 2}, {0, 2},     /* GPIO2 + GPIO1                                */
+    {1, 3}, {0, 3},     /* GPIO2 + GPIO1, 8 steps measured in the cycle */
+    {0, 4},             /* GPIO1 in the next cycle                      */
+};
+
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static void TEST_Grouping(void);
+static void TEST_SaveMuxMeasurement(void);
+static void TEST_Sequence(LTC_MUX_CH_CFG_s *seq, uint16_t nr_of_steps, uint32_t conversions, const char *name);
+static uint32_t TEST_CountConversions(LTC_MUX_CH_CFG_s *seq, uint16_t nr_of_steps, uint32_t *cycles);
+static void TEST_SetMuxInputs(void);
+static void TEST_RunTrigger(uint32_t time_ms);
+static void TEST_RunSequences(uint32_t sequences);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    LTC_MUX_SEQUENZ_s default_seq = ltc_mux_seq;
+
+    TEST_Grouping();
+    TEST_SaveMuxMeasurement();
+    TEST_Sequence(test_mixed_seq, TEST_MIXED_STEPS, TEST_MIXED_CONVERSIONS, "mixed sequence");
+    TEST_Sequence(default_seq.seqptr, default_seq.nr_of_steps, default_seq.nr_of_steps, "default sequence");
+
+    if (test_failures == 0u) {
+        printf("test_ltc_mux: OK\n");
+    } else {
+        printf("test_ltc_mux: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   checks the grouping of the sequence steps into conversions
+ */
+static void TEST_Grouping(void) {
+    uint32_t cycles = 0;
+    uint32_t conversions = 0;
+
+    conversions = TEST_CountConversions(test_mixed_seq, TEST_MIXED_STEPS, &cycles);
+    TEST_Expect(conversions == TEST_MIXED_CONVERSIONS, "mixed sequence conversions", conversions);
+    TEST_Expect(cycles == 2u, "mixed sequence cycles", cycles);
+
+    /* all steps of the default sequence are on multiplexer 0 (GPIO1): one conversion each, all in one cycle */
+    conversions = TEST_CountConversions(ltc_mux_seq.seqptr, ltc_mux_seq.nr_of_steps, &cycles);
+    TEST_Expect(conversions == ltc_mux_seq.nr_of_steps, "default sequence conversions", conversions);
+    TEST_Expect(cycles == 1u, "default sequence cycles", cycles);
+}
+
+/**
+ * @brief   groups a sequence like the state machine and counts the conversions
+ *
+ * @param   seq             multiplexer sequence
+ * @param   nr_of_steps     number of steps of the sequence
+ * @param   cycles          number of measurement cycles needed for the sequence
+ *
+ * @return  number of ADAX commands for the sequence
+ */
+static uint32_t TEST_CountConversions(LTC_MUX_CH_CFG_s *seq, uint16_t nr_of_steps, uint32_t *cycles) {
+    uint32_t conversions = 0;
+
+    *cycles = 0;
+    ltc_state.muxmeas_seqptr = seq;
+    ltc_state.muxmeas_seqendptr = seq + nr_of_steps;
+    while (ltc_state.muxmeas_seqptr < ltc_state.muxmeas_seqendptr) {
+        (*cycles)++;
+        ltc_state.muxStepsInCycle = 0;
+        do {
+            ltc_state.muxmeas_selectptr = ltc_state.muxmeas_seqptr;
+            while (LTC_MuxStepJoinsConversion(ltc_state.muxmeas_selectptr+1) == TRUE) {
+                ltc_state.muxmeas_selectptr++;
+            }
+            if (ltc_state.muxmeas_seqptr->muxCh == 0xFF) {
+                /* switched off: no conversion and not counted as measurement */
+                ltc_state.muxmeas_seqptr++;
+            } else {
+                conversions++;
+                while (ltc_state.muxmeas_seqptr <= ltc_state.muxmeas_selectptr) {
+                    ltc_state.muxmeas_seqptr++;
+                    ltc_state.muxStepsInCycle++;
+                }
+            }
+        } while ((ltc_state.muxStepsInCycle < LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE) &&
+                (ltc_state.muxmeas_seqptr < ltc_state.muxmeas_seqendptr));
+    }
+    return conversions;
+}
+
+/**
+ * @brief   stores a joined GPIO1/GPIO2 conversion read from the emulator, with and without PEC error
+ */
+static void TEST_SaveMuxMeasurement(void) {
+    LTC_MUX_CH_CFG_s pair[2] = {{0, 3}, {2, 5}};
+    uint16_t i = 0;
+
+    LTCEMU_Init(LTC_N_LTC, LTC_N_LTC_PER_CHAIN);
+    TEST_SetMuxInputs();
+    for (i=0; i < LTC_N_LTC; i++) {
+        ltc_celltemperature.valid_temperature[i] = 0;
+        LTC_ErrorTable[i].PEC_valid = TRUE;
+    }
+
+    /* the emulator answers with the selected channel of each multiplexer */
+    TEST_Expect(LTC_SetMuxChannel(ltc_TXBuffer, ltc_TXPECbuffer, pair[0].muxID, pair[0].muxCh) == E_OK, "select GPIO1", 0);
+    TEST_Expect(LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock) == E_OK, "clock GPIO1", 0);
+    TEST_Expect(LTC_SetMuxChannel(ltc_TXBuffer, ltc_TXPECbuffer, pair[1].muxID, pair[1].muxCh) == E_OK, "select GPIO2", 0);
+    TEST_Expect(LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock) == E_OK, "clock GPIO2", 0);
+    TEST_Expect(LTC_StartGPIOMeasurement(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_ALLCHANNEL) == E_OK, "ADAX", 0);
+
+    /* the answer of LTC 2 is corrupted */
+    LTCEMU_InjectPECError(2, 1);
+    TEST_Expect(LTC_RX((uint8_t*)(ltc_cmdRDAUXA), ltc_RXPECbuffer) == E_OK, "RDAUXA", 0);
+    TEST_Expect(LTC_RX_PECCheck(ltc_RXPECbuffer) == E_NOT_OK, "PEC error", 0);
+    LTC_SaveMuxMeasurement(ltc_RXPECbuffer, &pair[0]);
+    LTC_SaveMuxMeasurement(ltc_RXPECbuffer, &pair[1]);
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        uint8_t sensor = ltc_muxsensortemperatur_cfg[pair[0].muxCh];
+        if (i == 2u) {
+            TEST_Expect(ltc_celltemperature.valid_temperature[i] == (1u << sensor), "invalid sensor of the PEC error", i);
+        } else {
+            TEST_Expect(ltc_celltemperature.valid_temperature[i] == 0u, "valid sensors", i);
+            TEST_Expect(ltc_celltemperature.temperature[i*BS_NR_OF_TEMP_SENSORS_PER_MODULE+sensor] ==
+                    TEST_TEMPERATURE(i, pair[0].muxCh), "temperature of joined conversion", i);
+        }
+        /* user multiplexer values are stored without PEC check */
+        TEST_Expect(ltc_user_mux.value[i*LTC_N_MUX_CHANNELS_PER_MUX*LTC_N_USER_MUX_PER_LTC+8u+pair[1].muxCh] ==
+                TEST_USER_mV(i, 2u, pair[1].muxCh), "user value of joined conversion", i);
+    }
+
+    /* a valid measurement of another sensor keeps the invalid flag of the first one */
+    pair[0].muxCh = 4;
+    LTC_SetMuxChannel(ltc_TXBuffer, ltc_TXPECbuffer, pair[0].muxID, pair[0].muxCh);
+    LTC_I2CClock(ltc_TXBufferClock, ltc_TXPECBufferClock);
+    LTC_StartGPIOMeasurement(LTC_GPIO_MEASUREMENT_MODE, LTC_ADCMEAS_SINGLECHANNEL_GPIO1);
+    LTC_RX((uint8_t*)(ltc_cmdRDAUXA), ltc_RXPECbuffer);
+    TEST_Expect(LTC_RX_PECCheck(ltc_RXPECbuffer) == E_OK, "no PEC error", 0);
+    LTC_SaveMuxMeasurement(ltc_RXPECbuffer, &pair[0]);
+    TEST_Expect(ltc_celltemperature.valid_temperature[2] == (1u << ltc_muxsensortemperatur_cfg[3]), "invalid flag kept", 2);
+    TEST_Expect(ltc_celltemperature.temperature[2*BS_NR_OF_TEMP_SENSORS_PER_MODULE+ltc_muxsensortemperatur_cfg[4]] ==
+            TEST_TEMPERATURE(2u, 4u), "temperature after PEC error", 2);
+}
+
+/**
+ * @brief   measures a multiplexer sequence with LTC_Trigger() and the emulator
+ *
+ * @param   seq             multiplexer sequence
+ * @param   nr_of_steps     number of steps of the sequence
+ * @param   conversions     expected number of ADAX commands per sequence
+ * @param   name            name of the sequence in the messages
+ */
+static void TEST_Sequence(LTC_MUX_CH_CFG_s *seq, uint16_t nr_of_steps, uint32_t conversions, const char *name) {
+    LTCEMU_STATISTICS_s statistics;
+    uint32_t adax = 0;
+    uint32_t sequences = 10u;
+    uint16_t i = 0;
+    uint16_t step = 0;
+
+    ltc_mux_seq.seqptr = seq;
+    ltc_mux_seq.nr_of_steps = nr_of_steps;
+    ltc_state.state = LTC_STATEMACH_UNINITIALIZED;
+    ltc_state.substate = 0;
+    ltc_state.timer = 0;
+    TEST_Expect(LTC_SetStateRequest(LTC_STATE_INIT_REQUEST) == LTC_OK, "init request", 0);
+
+    /* the emulator is initialized by the first call */
+    TEST_RunTrigger(1u);
+    TEST_SetMuxInputs();
+    TEST_RunTrigger(999u);
+
+    /* a whole number of sequences, from one restart of the sequence to another */
+    TEST_RunSequences(1u);
+    LTCEMU_GetStatistics(&statistics);
+    adax = statistics.adax;
+    TEST_RunSequences(sequences);
+    LTCEMU_GetStatistics(&statistics);
+    adax = statistics.adax - adax;
+
+    printf("test_ltc_mux: %s, %u steps, %u ADAX per sequence, sequence refreshed every %u ms\n",
+            name, (unsigned int)nr_of_steps, (unsigned int)(adax/sequences), (unsigned int)test_celltemperature.refreshTime_ms);
+    TEST_Expect(adax == conversions*sequences, name, adax);
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        for (step=0; step < nr_of_steps; step++) {
+            if (seq[step].muxCh == 0xFF) {
+                continue;
+            }
+            if (seq[step].muxID == 0u) {
+                uint8_t sensor = ltc_muxsensortemperatur_cfg[seq[step].muxCh];
+                TEST_Expect(test_celltemperature.temperature[i*BS_NR_OF_TEMP_SENSORS_PER_MODULE+sensor] ==
+                        TEST_TEMPERATURE(i, seq[step].muxCh), "temperature", i*100u+step);
+                TEST_Expect((test_celltemperature.valid_temperature[i] & (1u << sensor)) == 0u, "valid temperature", i*100u+step);
+            } else {
+                uint16_t ch = (seq[step].muxID == 1u) ? seq[step].muxCh : (uint16_t)(8u + seq[step].muxCh);
+                TEST_Expect(ltc_user_mux.value[i*LTC_N_MUX_CHANNELS_PER_MUX*LTC_N_USER_MUX_PER_LTC+ch] ==
+                        TEST_USER_mV(i, seq[step].muxID, seq[step].muxCh), "user value", i*100u+step);
+            }
+        }
+    }
+    TEST_Expect(test_diag_nok[DIAG_CH_LTC_PEC] == 0u, "PEC errors", test_diag_nok[DIAG_CH_LTC_PEC]);
+    TEST_Expect(test_diag_nok[DIAG_CH_LTC_MUX] == 0u, "multiplexer errors", test_diag_nok[DIAG_CH_LTC_MUX]);
+}
+
+/**
+ * @brief   sets a distinct raw value on every multiplexer input of the emulator
+ */
+static void TEST_SetMuxInputs(void) {
+    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
+        for (uint8_t ch = 0; ch < LTCEMU_NR_OF_MUX_CHANNELS; ch++) {
+            LTCEMU_SetMuxVoltage(i, 0, ch, TEST_RAW_TEMPERATURE(i, ch));
+            LTCEMU_SetMuxVoltage(i, 1, ch, TEST_RAW_USER(i, 1u, ch));
+            LTCEMU_SetMuxVoltage(i, 2, ch, TEST_RAW_USER(i, 2u, ch));
+        }
+    }
+}
+
+/**
+ * @brief   calls LTC_Trigger() every ms like the 1ms task
+ *
+ * @param   time_ms     duration in ms
+ */
+static void TEST_RunTrigger(uint32_t time_ms) {
+    for (uint32_t t = 0; t < time_ms; t++) {
+        test_tick++;
+        LTC_Trigger();
+    }
+}
+
+/**
+ * @brief   calls LTC_Trigger() until the multiplexer sequence was restarted a number of times
+ *
+ * @param   sequences   number of restarts of the sequence
+ */
+static void TEST_RunSequences(uint32_t sequences) {
+    LTC_MUX_CH_CFG_s *previous = ltc_state.muxmeas_seqptr;
+
+    while (sequences > 0u) {
+        TEST_RunTrigger(1u);
+        if ((ltc_state.muxmeas_seqptr == ltc_mux_seq.seqptr) && (previous != ltc_mux_seq.seqptr)) {
+            sequences--;
+        }
+        previous = ltc_state.muxmeas_seqptr;
+    }
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
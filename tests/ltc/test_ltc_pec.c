@@ -0,0 +1,196 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltc_pec.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test of the LTC PEC functions
+ *
+ * Compares LTC_pec15_calcFrame() and LTC_pec15_checkFrames() with the
+ * reference LTC_pec15_calc(). The negative tests corrupt the data and the PEC
+ * of single devices and check that exactly these devices are rejected.
+ *
+ * Build and run from the repository root:
+ *
+ *     gcc -std=c99 -Wall -Wextra -Itests/ltc/stubs -Iembedded-software/mcu-common/src/module/ltc \
+ *         tests/ltc/test_ltc_pec.c embedded-software/mcu-common/src/module/ltc/ltc_pec.c -o test_ltc_pec
+ *     ./test_ltc_pec
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "ltc_pec.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** number of devices in the tested daisy-chain */
+#define TEST_NR_OF_DEVICES      40u
+
+/** CRC15 polynomial including x^15, a PEC differing by it leaves the CRC remainder 0 */
+#define TEST_PEC_POLYNOMIAL     0xC599u
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_seed = 12345u;
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static uint8_t TEST_Random(void);
+static void TEST_FillChain(uint8_t *data, uint16_t nr_of_devices);
+static void TEST_SetPEC(uint8_t *slot, uint16_t pec);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    uint8_t data[TEST_NR_OF_DEVICES*8u];
+    uint8_t corrupted[TEST_NR_OF_DEVICES*8u];
+    uint32_t validmask[LTC_PEC_MASK_WORDS(TEST_NR_OF_DEVICES)];
+    uint32_t expected = 0;
+    uint16_t pec = 0;
+    uint16_t errors = 0;
+
+    for (uint16_t run = 0; run < 100u; run++) {
+        TEST_FillChain(data, TEST_NR_OF_DEVICES);
+
+        /* the 32 bit implementation calculates the reference PEC */
+        for (uint16_t i = 0; i < TEST_NR_OF_DEVICES; i++) {
+            TEST_Expect(LTC_pec15_calcFrame(&data[i*8u]) == LTC_pec15_calc(6, &data[i*8u]), "calcFrame", i);
+        }
+
+        /* an intact chain is accepted completely */
+        errors = LTC_pec15_checkFrames(data, TEST_NR_OF_DEVICES, validmask);
+        TEST_Expect(errors == 0u, "intact chain", errors);
+        TEST_Expect((validmask[0] == 0xFFFFFFFFu) && (validmask[1] == 0xFFu), "intact mask", validmask[1]);
+
+        /* every single bit error in the data or the PEC is detected in the right device */
+        for (uint16_t bit = 0; bit < 64u; bit++) {
+            uint16_t device = (uint16_t)((run + bit) % TEST_NR_OF_DEVICES);
+            memcpy(corrupted, data, sizeof(data));
+            corrupted[device*8u + bit/8u] ^= (uint8_t)(0x80u >> (bit % 8u));
+            errors = LTC_pec15_checkFrames(corrupted, TEST_NR_OF_DEVICES, validmask);
+            expected = (uint32_t)1u << (device % 32u);
+            TEST_Expect(errors == 1u, "single bit error count", bit);
+            TEST_Expect((validmask[device/32u] & expected) == 0u, "single bit error mask", bit);
+        }
+
+        /* a PEC that differs from the correct one by the polynomial is rejected */
+        memcpy(corrupted, data, sizeof(data));
+        pec = LTC_pec15_calc(6, &corrupted[8u]);
+        TEST_SetPEC(&corrupted[8u], (uint16_t)(pec ^ TEST_PEC_POLYNOMIAL));
+        errors = LTC_pec15_checkFrames(corrupted, TEST_NR_OF_DEVICES, validmask);
+        TEST_Expect((errors == 1u) && ((validmask[0] & 0x02u) == 0u), "polynomial PEC error", pec);
+    }
+
+    /* of all 2^16 received PECs of a device, only the correct one is accepted */
+    TEST_FillChain(data, 1u);
+    pec = LTC_pec15_calc(6, data);
+    for (uint32_t received = 0; received <= 0xFFFFu; received++) {
+        TEST_SetPEC(data, (uint16_t)received);
+        errors = LTC_pec15_checkFrames(data, 1u, validmask);
+        TEST_Expect((errors == 0u) == (received == pec), "exhaustive PEC", received);
+    }
+
+    if (test_failures == 0u) {
+        printf("test_ltc_pec: OK\n");
+    } else {
+        printf("test_ltc_pec: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   returns a pseudo random byte (linear congruential generator, reproducible)
+ *
+ * @return  random byte
+ */
+static uint8_t TEST_Random(void) {
+    test_seed = (test_seed * 1103515245u) + 12345u;
+    return (uint8_t)(test_seed >> 16);
+}
+
+/**
+ * @brief   fills the slots of a daisy-chain with random data and the correct PECs
+ *
+ * @param   data            first byte of the first device
+ * @param   nr_of_devices   number of devices
+ */
+static void TEST_FillChain(uint8_t *data, uint16_t nr_of_devices) {
+    for (uint16_t i = 0; i < nr_of_devices; i++) {
+        for (uint8_t j = 0; j < 6u; j++) {
+            data[i*8u + j] = TEST_Random();
+        }
+        TEST_SetPEC(&data[i*8u], LTC_pec15_calc(6, &data[i*8u]));
+    }
+}
+
+/**
+ * @brief   writes the PEC after the 6 data bytes of a slot (MSB first)
+ *
+ * @param   slot    first byte of the slot
+ * @param   pec     PEC to write
+ */
+static void TEST_SetPEC(uint8_t *slot, uint16_t pec) {
+    slot[6] = (uint8_t)(pec >> 8);
+    slot[7] = (uint8_t)pec;
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
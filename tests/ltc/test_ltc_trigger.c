@@ -0,0 +1,198 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltc_trigger.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test and benchmark of LTC_Trigger() with the LTC emulator
+ *
+ * ltc.c is included to count the calls of LTC_Trigger() that run the state
+ * machine. Its frames go to the LTC emulator, which answers at once. The test
+ * calls LTC_Trigger() every ms of simulated time for TEST_DURATION_ms and
+ * checks that every cell voltage set in the emulator is stored in the database
+ * without SPI or PEC errors.
+ *
+ * Printed per measurement cycle (one ADCV command):
+ * - simulated time: the emulator finishes every SPI transfer at once, so this
+ *   only contains the conversion and wake-up waits of the state machine. It is
+ *   a lower bound of the cycle time on the target, not a measurement of it.
+ * - calls of LTC_Trigger() and calls that ran the state machine
+ * - host CPU time of LTC_Trigger() including the emulator
+ *
+ * The number of modules is set with -DTEST_NR_OF_MODULES (1 to 128, the
+ * default configuration of the primary MCU otherwise).
+ *
+ * Build and run from the repository root:
+ *
+ *     P=embedded-software/mcu-primary/src; C=embedded-software/mcu-common/src
+ *     gcc -std=c99 -O2 -DTEST_NR_OF_MODULES=12 -Itests/ltc/stubs -Itests/ltc -I$C/module/ltc -I$P/module/config \
+ *         -I$P/engine/config -I$P/general/config -I$C/engine/database -I$C/engine/diag -I$C/driver/ltcemu -I$C/util \
+ *         tests/ltc/test_ltc_trigger.c tests/ltc/ltc_stubs.c $P/module/config/ltc_cfg.c $C/module/ltc/ltc_pec.c \
+ *         $C/module/ltc/slaveplausibility.c $C/driver/ltcemu/ltcemu.c -lm -o test_ltc_trigger
+ *     ./test_ltc_trigger
+ */
+
+/*================== Includes =============================================*/
+#define _POSIX_C_SOURCE 199309L
+
+#include "ltc.c"
+
+#include <stdio.h>
+#include <time.h>
+#include "ltc_stubs.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** simulated time of the benchmark */
+#define TEST_DURATION_ms        60000u
+
+/** raw value of a cell voltage in 100uV, distinct per cell, stored in mV with 0.05mV offset against truncation */
+#define TEST_RAW_CELL(device, cell)     ((uint16_t)(30005u + 1000u*(cell) + 10u*((device) % 100u)))
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static double TEST_Seconds(void);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    LTCEMU_STATISTICS_s statistics;
+    uint32_t calls = 0;
+    uint32_t steps = 0;
+    uint32_t cycles = 0;
+    uint32_t adcv = 0;
+    double start = 0.0;
+    double cpu = 0.0;
+    uint16_t i = 0;
+    uint8_t j = 0;
+
+    TEST_Expect(LTC_SetStateRequest(LTC_STATE_INIT_REQUEST) == LTC_OK, "init request", 0);
+    test_tick++;
+    LTC_Trigger();
+    for (i=0; i < LTC_N_LTC; i++) {
+        for (j=0; j < BS_NR_OF_BAT_CELLS_PER_MODULE; j++) {
+            LTCEMU_SetCellVoltage(i, j, TEST_RAW_CELL(i, j));
+        }
+    }
+
+    /* initialization and first measurement cycles */
+    while (test_tick < 1000u) {
+        test_tick++;
+        LTC_Trigger();
+    }
+    LTCEMU_GetStatistics(&statistics);
+    adcv = statistics.adcv;
+    TEST_Expect(adcv > 0u, "measurement started", adcv);
+
+    start = TEST_Seconds();
+    while (calls < TEST_DURATION_ms) {
+        /* the state machine runs unless LTC_Trigger() only counts down its timer */
+        if ((ltc_state.check_spi_flag == TRUE) || (ltc_state.timer <= 1u)) {
+            steps++;
+        }
+        test_tick++;
+        LTC_Trigger();
+        calls++;
+    }
+    cpu = TEST_Seconds() - start;
+    LTCEMU_GetStatistics(&statistics);
+    cycles = statistics.adcv - adcv;
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        for (j=0; j < BS_NR_OF_BAT_CELLS_PER_MODULE; j++) {
+            TEST_Expect(test_cellvoltage.voltage[i*BS_NR_OF_BAT_CELLS_PER_MODULE+j] == TEST_RAW_CELL(i, j)/10u,
+                    "cell voltage", i*100u+j);
+        }
+    }
+    TEST_Expect(cycles > 0u, "measurement cycles", cycles);
+    TEST_Expect(test_diag_nok[DIAG_CH_LTC_SPI] == 0u, "SPI errors", test_diag_nok[DIAG_CH_LTC_SPI]);
+    TEST_Expect(test_diag_nok[DIAG_CH_LTC_PEC] == 0u, "PEC errors", test_diag_nok[DIAG_CH_LTC_PEC]);
+
+    if (cycles > 0u) {
+        printf("test_ltc_trigger: %u LTCs, %u measurement cycles in %u ms simulated time\n",
+                (unsigned int)LTC_N_LTC, (unsigned int)cycles, (unsigned int)TEST_DURATION_ms);
+        printf("test_ltc_trigger: per cycle %.2f ms simulated, %.1f calls, %.1f state machine steps, %.2f us host CPU time\n",
+                (double)TEST_DURATION_ms/cycles, (double)calls/cycles, (double)steps/cycles, cpu*1e6/cycles);
+    }
+    if (test_failures == 0u) {
+        printf("test_ltc_trigger: OK\n");
+    } else {
+        printf("test_ltc_trigger: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   returns the CPU time of the process
+ *
+ * @return  CPU time in s
+ */
+static double TEST_Seconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
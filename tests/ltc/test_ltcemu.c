@@ -0,0 +1,314 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltcemu.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host round trip test of the LTC emulator
+ *
+ * Sends commands with correct PECs to the emulated daisy-chain and checks the
+ * answers with the PEC functions of the LTC module: cell voltage and
+ * multiplexer readings, injected PEC errors, open wires (ADOW with pull-up
+ * and pull-down), multiplexer ACK/NACK, commands with a wrong PEC and the
+ * order of the write and read frames of 2 daisy-chains.
+ *
+ * Build and run from the repository root:
+ *
+ *     C=embedded-software/mcu-common/src
+ *     gcc -std=c99 -Wall -Wextra -Itests/ltc/stubs -I$C/module/ltc -I$C/driver/ltcemu \
+ *         tests/ltc/test_ltcemu.c $C/module/ltc/ltc_pec.c $C/driver/ltcemu/ltcemu.c -o test_ltcemu
+ *     ./test_ltcemu
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "ltc_pec.h"
+#include "ltcemu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** number of emulated devices */
+#define TEST_NR_OF_DEVICES      8u
+
+/** size of a frame with one data slot per device */
+#define TEST_FRAME_SIZE         (4u + 8u*TEST_NR_OF_DEVICES)
+
+/** commands (see LTC6811 data sheet), ADCV/ADOW/ADAX in normal mode on all channels */
+#define TEST_CMD_WRCFG          0x001u
+#define TEST_CMD_RDCFG          0x002u
+#define TEST_CMD_RDCVA          0x004u
+#define TEST_CMD_RDCVB          0x006u
+#define TEST_CMD_RDAUXA         0x00Cu
+#define TEST_CMD_WRCOMM         0x721u
+#define TEST_CMD_RDCOMM         0x722u
+#define TEST_CMD_STCOMM         0x723u
+#define TEST_CMD_ADCV           0x360u
+#define TEST_CMD_ADOW_PUP       0x368u
+#define TEST_CMD_ADOW_PDN       0x328u
+#define TEST_CMD_ADAX           0x560u
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static void TEST_Command(uint8_t *frame, uint16_t command);
+static void TEST_SetPEC(uint8_t *slot);
+static uint16_t TEST_Value(const uint8_t *rx, uint16_t device, uint8_t index);
+static void TEST_SelectMux(uint8_t mux, uint8_t channel);
+static void TEST_TwoChains(void);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    uint8_t tx[TEST_FRAME_SIZE];
+    uint8_t rx[TEST_FRAME_SIZE];
+    uint32_t validmask[LTC_PEC_MASK_WORDS(TEST_NR_OF_DEVICES)];
+    LTCEMU_STATISTICS_s statistics;
+    uint16_t pullup = 0;
+    uint16_t pulldown = 0;
+
+    LTCEMU_Init(TEST_NR_OF_DEVICES, TEST_NR_OF_DEVICES);
+
+    /* cell voltages: cells 3 to 5 are in register group B */
+    LTCEMU_SetCellVoltage(3, 4, 12345);
+    TEST_Command(tx, TEST_CMD_ADCV);
+    LTCEMU_Transmit(0, tx, 4);
+    TEST_Command(tx, TEST_CMD_RDCVB);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    TEST_Expect(LTC_pec15_checkFrames(&rx[4], TEST_NR_OF_DEVICES, validmask) == 0u, "RDCVB PEC", 0);
+    TEST_Expect(TEST_Value(rx, 3, 1) == 12345u, "set cell voltage", TEST_Value(rx, 3, 1));
+    TEST_Expect(TEST_Value(rx, 2, 1) == 37000u, "default cell voltage", TEST_Value(rx, 2, 1));
+
+    /* an injected PEC error only affects the answer of its device */
+    LTCEMU_InjectPECError(5, 1);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    TEST_Expect(LTC_pec15_checkFrames(&rx[4], TEST_NR_OF_DEVICES, validmask) == 1u, "injected PEC error", 5);
+    TEST_Expect(validmask[0] == (0xFFu & ~(1u << 5)), "injected PEC error mask", validmask[0]);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    TEST_Expect(LTC_pec15_checkFrames(&rx[4], TEST_NR_OF_DEVICES, validmask) == 0u, "PEC error injected once", 5);
+
+    /* open wire 4 of device 1: cell 4 is lower with pull-up than with pull-down */
+    LTCEMU_SetOpenWire(1, 4, TRUE);
+    TEST_Command(tx, TEST_CMD_ADOW_PUP);
+    LTCEMU_Transmit(0, tx, 4);
+    TEST_Command(tx, TEST_CMD_RDCVB);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    pullup = TEST_Value(rx, 1, 1);
+    TEST_Command(tx, TEST_CMD_ADOW_PDN);
+    LTCEMU_Transmit(0, tx, 4);
+    TEST_Command(tx, TEST_CMD_RDCVB);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    pulldown = TEST_Value(rx, 1, 1);
+    TEST_Expect((int32_t)pullup - (int32_t)pulldown < -4000, "open wire", pulldown - pullup);
+    TEST_Expect(TEST_Value(rx, 0, 1) == 37000u, "no open wire", TEST_Value(rx, 0, 1));
+
+    /* multiplexer 1 channel 2, missing on device 6: ACK/NACK in RDCOMM and value on GPIO2 */
+    LTCEMU_SetMuxVoltage(2, 1, 2, 22222);
+    LTCEMU_SetMuxPresent(6, 1, FALSE);
+    TEST_SelectMux(1, 2);
+    TEST_Command(tx, TEST_CMD_RDCOMM);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    TEST_Expect(LTC_pec15_checkFrames(&rx[4], TEST_NR_OF_DEVICES, validmask) == 0u, "RDCOMM PEC", 0);
+    TEST_Expect((rx[4+8*2+1] & 0x0Fu) == 0x07u, "multiplexer ACK", rx[4+8*2+1]);
+    TEST_Expect((rx[4+8*6+1] & 0x0Fu) == 0x0Fu, "multiplexer NACK", rx[4+8*6+1]);
+    TEST_Command(tx, TEST_CMD_ADAX);
+    LTCEMU_Transmit(0, tx, 4);
+    TEST_Command(tx, TEST_CMD_RDAUXA);
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    TEST_Expect(TEST_Value(rx, 2, 1) == 22222u, "multiplexer on GPIO2", TEST_Value(rx, 2, 1));
+    TEST_Expect(TEST_Value(rx, 6, 1) == 15000u, "missing multiplexer", TEST_Value(rx, 6, 1));
+
+    /* a command with a wrong PEC is ignored */
+    TEST_Command(tx, TEST_CMD_RDAUXA);
+    tx[3] ^= 1u;
+    LTCEMU_TransmitReceive(0, tx, rx, TEST_FRAME_SIZE);
+    LTCEMU_GetStatistics(&statistics);
+    TEST_Expect(statistics.commandPECErrors == 1u, "command PEC error", statistics.commandPECErrors);
+    TEST_Expect(statistics.injectedPECErrors == 1u, "injected PEC errors", statistics.injectedPECErrors);
+    TEST_Expect(statistics.adcv == 1u, "ADCV count", statistics.adcv);
+    TEST_Expect(statistics.adax == 1u, "ADAX count", statistics.adax);
+    TEST_Expect(statistics.stcomm == 1u, "STCOMM count", statistics.stcomm);
+
+    TEST_TwoChains();
+
+    if (test_failures == 0u) {
+        printf("test_ltcemu: OK\n");
+    } else {
+        printf("test_ltcemu: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   writes a command and its PEC to the first 4 bytes of a frame
+ *
+ * @param   frame       frame to be sent
+ * @param   command     11 bit command code
+ */
+static void TEST_Command(uint8_t *frame, uint16_t command) {
+    uint16_t pec = 0;
+
+    frame[0] = (uint8_t)(command >> 8);
+    frame[1] = (uint8_t)command;
+    pec = LTC_pec15_calc(2, frame);
+    frame[2] = (uint8_t)(pec >> 8);
+    frame[3] = (uint8_t)pec;
+}
+
+/**
+ * @brief   writes the PEC after the 6 data bytes of a slot (MSB first)
+ *
+ * @param   slot    first byte of the slot
+ */
+static void TEST_SetPEC(uint8_t *slot) {
+    uint16_t pec = LTC_pec15_calc(6, slot);
+
+    slot[6] = (uint8_t)(pec >> 8);
+    slot[7] = (uint8_t)pec;
+}
+
+/**
+ * @brief   gets a 16 bit value of a register group read from the daisy-chain
+ *
+ * @param   rx      answer of the daisy-chain
+ * @param   device  device in the daisy-chain
+ * @param   index   value in the register group (0 to 2)
+ *
+ * @return  value (LSB first)
+ */
+static uint16_t TEST_Value(const uint8_t *rx, uint16_t device, uint8_t index) {
+    const uint8_t *slot = &rx[4u + 8u*device + 2u*index];
+
+    return (uint16_t)(slot[0] | (slot[1] << 8));
+}
+
+/**
+ * @brief   selects a channel of an ADG728 multiplexer on all devices (WRCOMM, STCOMM)
+ *
+ * @param   mux         multiplexer index
+ * @param   channel     channel
+ */
+static void TEST_SelectMux(uint8_t mux, uint8_t channel) {
+    uint8_t tx[TEST_FRAME_SIZE];
+    uint8_t address = (uint8_t)(0x98u | (mux << 1));
+    uint8_t data = (uint8_t)(1u << channel);
+
+    TEST_Command(tx, TEST_CMD_WRCOMM);
+    for (uint16_t i = 0; i < TEST_NR_OF_DEVICES; i++) {
+        uint8_t *slot = &tx[4u + 8u*i];
+        /* START, address, master ACK; data, master NACK + STOP; no transmit */
+        slot[0] = (uint8_t)(0x60u | (address >> 4));
+        slot[1] = (uint8_t)((address << 4) | 0x08u);
+        slot[2] = (uint8_t)(data >> 4);
+        slot[3] = (uint8_t)((data << 4) | 0x09u);
+        slot[4] = 0x7Fu;
+        slot[5] = 0xF9u;
+        TEST_SetPEC(slot);
+    }
+    LTCEMU_Transmit(0, tx, TEST_FRAME_SIZE);
+    TEST_Command(tx, TEST_CMD_STCOMM);
+    LTCEMU_Transmit(0, tx, 4u + 9u*3u);
+}
+
+/**
+ * @brief   writes and reads the configuration of 2 daisy-chains like ltc.c
+ *
+ * The write frame holds the data of the last module first. The last
+ * daisy-chain gets the first slots, the other one the following slots.
+ * The answers of daisy-chain 1 are appended to those of daisy-chain 0.
+ */
+static void TEST_TwoChains(void) {
+    enum { CHAINS = 2, PER_CHAIN = TEST_NR_OF_DEVICES/CHAINS };
+    uint8_t all[TEST_FRAME_SIZE];
+    uint8_t frame[4u + 8u*PER_CHAIN];
+    uint8_t rx[TEST_FRAME_SIZE];
+    uint8_t tx[4];
+    uint32_t validmask[LTC_PEC_MASK_WORDS(TEST_NR_OF_DEVICES)];
+
+    LTCEMU_Init(TEST_NR_OF_DEVICES, PER_CHAIN);
+    TEST_Command(all, TEST_CMD_WRCFG);
+    for (uint16_t i = 0; i < TEST_NR_OF_DEVICES; i++) {
+        uint8_t *slot = &all[4u + 8u*i];
+        memset(slot, 0, 6);
+        slot[0] = (uint8_t)(0xA0u + (TEST_NR_OF_DEVICES - 1u - i));
+        TEST_SetPEC(slot);
+    }
+    for (uint16_t chain = 0; chain < CHAINS; chain++) {
+        uint16_t block = CHAINS - 1u - chain;
+        memcpy(frame, all, 4);
+        memcpy(&frame[4], &all[4u + 8u*block*PER_CHAIN], 8u*PER_CHAIN);
+        TEST_Expect(LTCEMU_Transmit(chain*PER_CHAIN, frame, sizeof(frame)) == E_OK, "WRCFG", chain);
+    }
+
+    TEST_Command(tx, TEST_CMD_RDCFG);
+    LTCEMU_TransmitReceive(0, tx, rx, sizeof(frame));
+    LTCEMU_TransmitReceive(PER_CHAIN, tx, frame, sizeof(frame));
+    memcpy(&rx[4u + 8u*PER_CHAIN], &frame[4], 8u*PER_CHAIN);
+    TEST_Expect(LTC_pec15_checkFrames(&rx[4], TEST_NR_OF_DEVICES, validmask) == 0u, "RDCFG PEC", 0);
+    for (uint16_t i = 0; i < TEST_NR_OF_DEVICES; i++) {
+        TEST_Expect(rx[4u + 8u*i] == 0xA0u + i, "configuration of module", i);
+    }
+    TEST_Expect(LTCEMU_Transmit(TEST_NR_OF_DEVICES, tx, 4) == E_NOT_OK, "device out of range", TEST_NR_OF_DEVICES);
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
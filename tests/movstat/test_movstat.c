@@ -0,0 +1,270 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_movstat.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test of the moving statistics
+ *
+ * Adds pseudo random samples to two signals and compares the sum, number of
+ * samples, mean, minimum, maximum and RMS of every window after every sample
+ * with a reference that recalculates the window from the stored samples:
+ *  - windows of 1, 2, 7, 50 and 63 samples, 10^8 samples by default
+ *  - windows of 10, 50, 100, 300 and 600 samples, 3.2*10^6 samples
+ *
+ * The samples alternate every 2^20 samples between the range +-2^28, small
+ * values, a constant value and the range +-2^19. The mean and RMS have to be
+ * equal to the float division of the exact sums. For comparison, the
+ * deviation of a running float mean over 50 samples at the end of the
+ * constant phases is printed.
+ *
+ * Build and run from the repository root, the number of samples of the
+ * first signal can be passed as argument:
+ *
+ *     gcc -std=c99 -O2 -Wall -Wextra -Itests/movstat/stubs -Iembedded-software/mcu-common/src/util \
+ *         tests/movstat/test_movstat.c embedded-software/mcu-common/src/util/movstat.c -lm -o test_movstat
+ *     ./test_movstat [samples]
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "movstat.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** number of windows of a signal */
+#define TEST_NR_OF_WINDOWS      5u
+
+/** length of the rings of the short and the long windows */
+#define TEST_RING_SHORT         64u
+#define TEST_RING_LONG          601u
+
+/** default number of samples of the short and the long windows */
+#define TEST_SAMPLES_SHORT      100000000u
+#define TEST_SAMPLES_LONG       3200000u
+
+/** window of the running float mean printed for comparison */
+#define TEST_FLOAT_WINDOW       50u
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint64_t test_seed = 88172645463325252ull;
+static uint32_t test_failures = 0;
+
+static const uint32_t test_lengths_short[TEST_NR_OF_WINDOWS] = {1u, 2u, 7u, 50u, 63u};
+static const uint32_t test_lengths_long[TEST_NR_OF_WINDOWS] = {10u, 50u, 100u, 300u, 600u};
+
+static uint64_t test_prefix_sum[TEST_RING_LONG];
+static uint64_t test_prefix_sum_squares[TEST_RING_LONG];
+static uint32_t test_min_queues[TEST_NR_OF_WINDOWS][TEST_RING_LONG];
+static uint32_t test_max_queues[TEST_NR_OF_WINDOWS][TEST_RING_LONG];
+static MOVSTAT_WINDOW_s test_windows[TEST_NR_OF_WINDOWS];
+static int32_t test_samples[TEST_RING_LONG];    /*!< samples of the reference */
+
+/*================== Function Prototypes ==================================*/
+
+static int32_t TEST_Sample(uint32_t index);
+static void TEST_Signal(const uint32_t *lengths, uint32_t ringLength, uint32_t nrOfSamples);
+static void TEST_Configuration(void);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(int argc, char **argv) {
+    uint32_t samples = TEST_SAMPLES_SHORT;
+
+    if (argc > 1) {
+        samples = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+
+    TEST_Configuration();
+    TEST_Signal(test_lengths_short, TEST_RING_SHORT, samples);
+    TEST_Signal(test_lengths_long, TEST_RING_LONG, TEST_SAMPLES_LONG);
+
+    if (test_failures == 0u) {
+        printf("test_movstat: OK\n");
+    } else {
+        printf("test_movstat: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   returns the next sample (xorshift generator, reproducible)
+ *
+ * @param   index   number of the sample, selects the range of the sample
+ *
+ * @return  sample
+ */
+static int32_t TEST_Sample(uint32_t index) {
+    int32_t sample = 0;
+
+    test_seed ^= test_seed << 13;
+    test_seed ^= test_seed >> 7;
+    test_seed ^= test_seed << 17;
+    switch ((index >> 20) & 3u) {
+        case 0:
+            sample = (int32_t)(test_seed & 0x1FFFFFFFu) - 0x10000000;
+            break;
+        case 1:
+            sample = (int32_t)(test_seed % 2001u) - 1000;
+            break;
+        case 2:
+            sample = 123456;
+            break;
+        default:
+            sample = (int32_t)(test_seed & 0xFFFFFu) - 0x80000;
+            break;
+    }
+    return sample;
+}
+
+/**
+ * @brief   adds samples to a signal and compares all windows with the reference after every sample
+ *
+ * @param   lengths         lengths of the TEST_NR_OF_WINDOWS windows
+ * @param   ringLength      length of the rings, longest window + 1
+ * @param   nrOfSamples     number of samples
+ */
+static void TEST_Signal(const uint32_t *lengths, uint32_t ringLength, uint32_t nrOfSamples) {
+    MOVSTAT_s movstat = {test_prefix_sum, test_prefix_sum_squares, ringLength, test_windows, TEST_NR_OF_WINDOWS, 0};
+    const MOVSTAT_WINDOW_s *window = NULL_PTR;
+    float running_mean = 0.0f;
+    double deviation = 0.0;
+    uint32_t count = 0;
+    int64_t sum = 0;
+    uint64_t squares = 0;
+    int32_t min = 0;
+    int32_t max = 0;
+    int32_t sample = 0;
+
+    for (uint8_t k = 0; k < TEST_NR_OF_WINDOWS; k++) {
+        test_windows[k].length = lengths[k];
+        test_windows[k].statistics = MOVSTAT_MIN | MOVSTAT_MAX | MOVSTAT_RMS;
+        test_windows[k].minQueue = test_min_queues[k];
+        test_windows[k].maxQueue = test_max_queues[k];
+    }
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_OK, "init", ringLength);
+
+    for (uint32_t i = 0; i < nrOfSamples; i++) {
+        sample = TEST_Sample(i);
+        test_samples[i % ringLength] = sample;
+        MOVSTAT_AddSample(&movstat, sample);
+
+        running_mean += sample/(float)TEST_FLOAT_WINDOW;
+        if (i >= TEST_FLOAT_WINDOW) {
+            running_mean -= test_samples[(i - TEST_FLOAT_WINDOW) % ringLength]/(float)TEST_FLOAT_WINDOW;
+        }
+
+        for (uint8_t k = 0; k < TEST_NR_OF_WINDOWS; k++) {
+            window = &test_windows[k];
+            count = ((i + 1u) < lengths[k]) ? (i + 1u) : lengths[k];
+            sum = 0;
+            squares = 0;
+            min = INT32_MAX;
+            max = INT32_MIN;
+            for (uint32_t j = 0; j < count; j++) {
+                sample = test_samples[(i + ringLength - j) % ringLength];
+                sum += sample;
+                squares += (uint64_t)((int64_t)sample*sample);
+                min = (sample < min) ? sample : min;
+                max = (sample > max) ? sample : max;
+            }
+            TEST_Expect((window->sum == sum) && (window->nrOfSamples == count), "sum", i);
+            TEST_Expect(window->mean == ((float)sum/count), "mean", i);
+            TEST_Expect((window->min == min) && (window->max == max), "minimum and maximum", i);
+            TEST_Expect(window->rms == sqrtf((float)squares/count), "rms", i);
+            if ((lengths[k] == TEST_FLOAT_WINDOW) && (((i >> 20) & 3u) == 2u) && ((i & 0xFFFFFu) == 0xFFFFFu)) {
+                deviation = fmax(deviation, fabs((double)running_mean - ((double)sum/count)));
+            }
+        }
+    }
+    printf("test_movstat: %u samples, windows %u to %u, running float mean over %u samples deviates by up to %.1f\n",
+            (unsigned int)nrOfSamples, (unsigned int)lengths[0], (unsigned int)lengths[TEST_NR_OF_WINDOWS - 1u],
+            (unsigned int)TEST_FLOAT_WINDOW, deviation);
+}
+
+/**
+ * @brief   checks that MOVSTAT_Init() rejects invalid configurations
+ */
+static void TEST_Configuration(void) {
+    MOVSTAT_s movstat = {test_prefix_sum, NULL_PTR, TEST_RING_SHORT, test_windows, 1u, 0};
+
+    test_windows[0].length = TEST_RING_SHORT - 1u;
+    test_windows[0].statistics = 0;
+    test_windows[0].minQueue = NULL_PTR;
+    test_windows[0].maxQueue = NULL_PTR;
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_OK, "mean only", 0);
+
+    test_windows[0].length = TEST_RING_SHORT;
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_NOT_OK, "window longer than the ring", 0);
+    test_windows[0].length = 0;
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_NOT_OK, "empty window", 0);
+    test_windows[0].length = 1u;
+    test_windows[0].statistics = MOVSTAT_MIN;
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_NOT_OK, "minimum without queue", 0);
+    test_windows[0].statistics = MOVSTAT_MAX;
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_NOT_OK, "maximum without queue", 0);
+    test_windows[0].statistics = MOVSTAT_RMS;
+    TEST_Expect(MOVSTAT_Init(&movstat) == E_NOT_OK, "rms without squares", 0);
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_stubs.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Database, NVRAM, BMS and OS stubs of the SOX host tests
+ */
+
+/*================== Includes =============================================*/
+#include "sox_stubs.h"
+
+#include <string.h>
+#include "nvramhandler.h"
+#include "os.h"
+
+/*================== Constant and Variable Definitions ====================*/
+DATA_BLOCK_CELLVOLTAGE_s test_cellvoltage;
+DATA_BLOCK_CURRENT_SENSOR_s test_current;
+DATA_BLOCK_MINMAX_s test_minmax;
+DATA_BLOCK_SOX_s test_sox;
+DATA_BLOCK_SOF_s test_sof;
+BMS_CURRENT_FLOW_STATE_e test_bms_state = BMS_AT_REST;
+uint32_t test_tick = 0;
+SOX_SOC_s test_nvm_soc = {50.0f, 50.0f, 50.0f, 0, 0, 0, 0};
+uint32_t test_nvm_soc_writes = 0;
+
+/*================== Function Implementations =============================*/
+
+STD_RETURN_TYPE_e DB_ReadBlock(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e blockID) {
+    switch (blockID) {
+        case DATA_BLOCK_ID_CELLVOLTAGE:
+            memcpy(dataptrtoReceiver, &test_cellvoltage, sizeof(test_cellvoltage));
+            break;
+        case DATA_BLOCK_ID_CURRENT_SENSOR:
+            memcpy(dataptrtoReceiver, &test_current, sizeof(test_current));
+            break;
+        case DATA_BLOCK_ID_MINMAX:
+            memcpy(dataptrtoReceiver, &test_minmax, sizeof(test_minmax));
+            break;
+        case DATA_BLOCK_ID_SOX:
+            memcpy(dataptrtoReceiver, &test_sox, sizeof(test_sox));
+            break;
+        case DATA_BLOCK_ID_SOF:
+            memcpy(dataptrtoReceiver, &test_sof, sizeof(test_sof));
+            break;
+        default:
+            /* other data blocks are not used by the tests, only the timestamps are cleared */
+            memset(dataptrtoReceiver, 0, 2u * sizeof(uint32_t));
+            break;
+    }
+    return E_OK;
+}
+
+void DB_WriteBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e blockID) {
+    if (blockID == DATA_BLOCK_ID_SOX) {
+        memcpy(&test_sox, dataptrfromSender, sizeof(test_sox));
+    } else if (blockID == DATA_BLOCK_ID_SOF) {
+        memcpy(&test_sof, dataptrfromSender, sizeof(test_sof));
+    }
+}
+
+STD_RETURN_TYPE_e DB_BorrowBlock(DATA_BLOCK_BORROW_s *borrow, DATA_BLOCK_ID_TYPE_e blockID) {
+    if (blockID != DATA_BLOCK_ID_CELLVOLTAGE) {
+        return E_NOT_OK;
+    }
+    borrow->dataptr = &test_cellvoltage;
+    borrow->blockID = blockID;
+    borrow->buffer = 0;
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e DB_ReleaseBlock(DATA_BLOCK_BORROW_s *borrow) {
+    borrow->dataptr = NULL_PTR;
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e NVM_getSOC(SOX_SOC_s *dest_ptr) {
+    *dest_ptr = test_nvm_soc;
+    return E_OK;
+}
+
+STD_RETURN_TYPE_e NVM_setSOC(SOX_SOC_s *ptr) {
+    test_nvm_soc = *ptr;
+    test_nvm_soc_writes++;
+    return E_OK;
+}
+
+BMS_CURRENT_FLOW_STATE_e BMS_GetBatterySystemState(void) {
+    return test_bms_state;
+}
+
+uint32_t OS_getOSSysTick(void) {
+    return test_tick;
+}
+
+void OS_TaskEnter_Critical(void) {
+}
+
+void OS_TaskExit_Critical(void) {
+}
@@ -0,0 +1,75 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_stubs.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Database, NVRAM, BMS and OS stubs of the SOX host tests
+ *
+ * DB_ReadBlock() returns the test_* data blocks set by the test,
+ * DB_WriteBlock() copies the SOX and SOF data blocks to test_sox and test_sof.
+ */
+
+#ifndef SOX_STUBS_H_
+#define SOX_STUBS_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "database.h"
+#include "bms.h"
+#include "sox.h"
+
+/*================== Constant and Variable Definitions ====================*/
+extern DATA_BLOCK_CELLVOLTAGE_s test_cellvoltage;       /*!< read by DB_ReadBlock() and DB_BorrowBlock() */
+extern DATA_BLOCK_CURRENT_SENSOR_s test_current;        /*!< read by DB_ReadBlock() */
+extern DATA_BLOCK_MINMAX_s test_minmax;                 /*!< read by DB_ReadBlock() */
+extern DATA_BLOCK_SOX_s test_sox;                       /*!< last SOX data block written by DB_WriteBlock() */
+extern DATA_BLOCK_SOF_s test_sof;                       /*!< last SOF data block written by DB_WriteBlock() */
+extern BMS_CURRENT_FLOW_STATE_e test_bms_state;         /*!< returned by BMS_GetBatterySystemState() */
+extern uint32_t test_tick;                              /*!< returned by OS_getOSSysTick() in ms */
+extern SOX_SOC_s test_nvm_soc;                          /*!< SOC stored in the NVRAM */
+extern uint32_t test_nvm_soc_writes;                    /*!< number of calls of NVM_setSOC() */
+
+#endif /* SOX_STUBS_H_ */
@@ -0,0 +1,210 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_sox_cells.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test and benchmark of the SOC of the single cells
+ *
+ * Checks the coulomb counting of SOC_Calculation() for all cells, the
+ * remainder of small charges, the clamping at 0% and 100%, cells with a
+ * different capacity, SOC_SetValue() and the recalibration of every cell
+ * with its own open circuit voltage. Then measures the time of
+ * SOC_Calculation() per cell on the host.
+ *
+ * Build and run from the repository root, add -DTEST_NR_OF_MODULES=<n> to
+ * change the number of cells:
+ *
+ *     S=embedded-software/mcu-primary/src
+ *     gcc -std=c99 -O2 -Wall -Wextra -Itests/sox/stubs -I$S/application/sox -I$S/application/config \
+ *         -I$S/general/config -I$S/engine/config -Iembedded-software/mcu-common/src/engine/database \
+ *         tests/sox/test_sox_cells.c tests/sox/sox_stubs.c $S/application/sox/sox.c \
+ *         $S/application/config/sox_cfg.c -lm -o test_sox_cells
+ *     ./test_sox_cells
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "sox_stubs.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** capacity of the cells in As, see SOX_CELL_CAPACITY */
+#define TEST_CAPACITY_As        ((double)SOX_CELL_CAPACITY*3.6)
+
+/** number of cell updates of the benchmark */
+#define TEST_BENCHMARK_CELLS    (20000000u)
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static void TEST_Step(int32_t current_mA, uint32_t duration_ms);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    float soc = 0.0f;
+    float expected = 0.0f;
+    clock_t start = 0;
+    double duration_ns = 0.0;
+    uint32_t calls = 0;
+
+    test_bms_state = BMS_DISCHARGING;
+    test_nvm_soc.mean = 50.0f;
+    test_nvm_soc.min = 50.0f;
+    test_nvm_soc.max = 50.0f;
+    SOC_Init(FALSE);
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        TEST_Expect(test_sox.soc_cell[i] == 5000u, "initial SOC", i);
+    }
+
+    /* 100 A for 10 s in steps of 10 ms */
+    for (uint16_t i = 0; i < 1000u; i++) {
+        TEST_Step(100000, 10u);
+    }
+    expected = (float)(50.0 - 100.0*1000.0/TEST_CAPACITY_As);
+    TEST_Expect(fabsf(test_sox.soc_mean - expected) < 1e-3f, "coulomb counting", (uint32_t)(test_sox.soc_mean*1000.0f));
+
+    /* charges below the resolution of the cells are not lost: 1000000 times 3 mA for 7 ms */
+    soc = test_sox.soc_mean;
+    for (uint32_t i = 0; i < 1000000u; i++) {
+        TEST_Step(3, 7u);
+    }
+    expected = (float)(100.0*21.0/TEST_CAPACITY_As);
+    TEST_Expect(fabsf((soc - test_sox.soc_mean) - expected) < 2e-4f, "remainder", (uint32_t)(test_sox.soc_mean*1000.0f));
+
+    /* the SOC is clamped at 0% and 100% */
+    TEST_Step(100000, 3600000u);
+    TEST_Expect((test_sox.soc_max == 0.0f) && (test_sox.soc_cell[0] == 0u), "empty", test_sox.soc_cell[0]);
+    TEST_Step(-10000, (uint32_t)(TEST_CAPACITY_As*1000.0/10.0/2.0));
+    TEST_Expect(fabsf(test_sox.soc_mean - 50.0f) < 1e-3f, "charge after empty", (uint32_t)(test_sox.soc_mean*1000.0f));
+    TEST_Step(-100000, 3600000u);
+    TEST_Expect((test_sox.soc_min == 100.0f) && (test_sox.soc_cell[BS_NR_OF_BAT_CELLS - 1u] == 10000u), "full", test_sox.soc_cell[0]);
+
+    /* a cell with half of the capacity discharges twice as fast */
+    SOC_SetCellCapacity(3, SOX_CELL_CAPACITY/2.0f);
+    TEST_Step(20000, (uint32_t)(TEST_CAPACITY_As*1000.0/20.0/20.0));
+    TEST_Expect(test_sox.soc_cell[3] == 9000u, "half capacity", test_sox.soc_cell[3]);
+    TEST_Expect(test_sox.soc_cell[0] == 9500u, "full capacity", test_sox.soc_cell[0]);
+    TEST_Expect((test_sox.soc_min == 90.0f) && (test_sox.soc_max == 95.0f), "minimum and maximum", (uint32_t)test_sox.soc_min);
+
+    /* SOC_SetValue() keeps the order of the cells */
+    SOC_SetValue(40.0f, 60.0f, 50.0f);
+    TEST_Expect((test_sox.soc_cell[3] == 4000u) && (test_sox.soc_cell[0] == 6000u), "set spread", test_sox.soc_cell[3]);
+    SOC_SetValue(30.0f, 30.0f, 30.0f);
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        TEST_Expect(test_sox.soc_cell[i] == 3000u, "set value", i);
+    }
+
+    /* at rest, every cell is recalibrated with its own open circuit voltage */
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        test_cellvoltage.voltage[i] = (uint16_t)(2100u + 20u*(i % 20u));
+    }
+    test_minmax.voltage_min = 2100;
+    test_minmax.voltage_max = 2480;
+    test_minmax.temperature_mean = 10.0f;
+    test_current.current = 0;
+    test_bms_state = BMS_AT_REST;
+    for (test_tick = 0; test_tick <= (SOX_OCV_STABLE_TIME_ms + 100u); test_tick += 100u) {
+        SOC_Calculation();
+    }
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        expected = SOC_GetFromVoltage(test_cellvoltage.voltage[i], 10.0f)*100.0f;
+        TEST_Expect(fabsf(test_sox.soc_cell[i] - expected) <= 1.0f, "recalibrated cell", i);
+    }
+
+    /* benchmark of the coulomb counting */
+    test_bms_state = BMS_DISCHARGING;
+    calls = TEST_BENCHMARK_CELLS/BS_NR_OF_BAT_CELLS + 1000u;
+    start = clock();
+    for (uint32_t i = 0; i < calls; i++) {
+        TEST_Step(((i & 1u) != 0u) ? 5000 : -4000, 10u);
+    }
+    duration_ns = (double)(clock() - start)*1e9/CLOCKS_PER_SEC/calls;
+    printf("test_sox_cells: %u cells, %.0f ns per SOC_Calculation(), %.2f ns per cell on the host\n",
+            (unsigned int)BS_NR_OF_BAT_CELLS, duration_ns, duration_ns/BS_NR_OF_BAT_CELLS);
+
+    if (test_failures == 0u) {
+        printf("test_sox_cells: OK\n");
+    } else {
+        printf("test_sox_cells: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   publishes a new current measurement and calls SOC_Calculation()
+ *
+ * @param   current_mA      current, positive in discharge direction
+ * @param   duration_ms     time since the previous measurement
+ */
+static void TEST_Step(int32_t current_mA, uint32_t duration_ms) {
+    test_current.previous_timestamp_cur = test_current.timestamp_cur;
+    test_current.timestamp_cur += duration_ms;
+    test_current.current = current_mA;
+    SOC_Calculation();
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
@@ -0,0 +1,297 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_sox_ekf.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host benchmark of the SOC estimation with a simulated drive profile
+ *
+ * No recorded current and voltage profiles are available, the cells are
+ * simulated: an equivalent circuit with one RC element whose resistances,
+ * time constant and capacities differ from the ones of the filters, a random
+ * current profile with rests and 4 mV of measurement noise. The Coulomb
+ * counter starts 10% below the true SOC.
+ *
+ * After the filters have converged (15 min), the minimum and maximum SOC of
+ * the filters and of the Coulomb counter in the SOX data block are compared
+ * with the true SOC of the cells. The test fails if the filters are not more
+ * accurate than the Coulomb counter, or if their rms error exceeds 1.5% or
+ * their maximum error 3%. The time of SOC_Estimation() on the host
+ * is printed.
+ *
+ * The filters are selected with SOX_EKF_MODE and SOX_EKF_FIXED_POINT in
+ * sox_cfg.h. Build and run from the repository root, add
+ * -DTEST_NR_OF_MODULES=<n> to change the number of cells:
+ *
+ *     S=embedded-software/mcu-primary/src
+ *     gcc -std=c99 -O2 -Wall -Wextra -Itests/sox/stubs -I$S/application/sox -I$S/application/config \
+ *         -I$S/general/config -I$S/engine/config -Iembedded-software/mcu-common/src/engine/database \
+ *         tests/sox/test_sox_ekf.c tests/sox/sox_stubs.c $S/application/sox/sox.c \
+ *         $S/application/config/sox_cfg.c -lm -o test_sox_ekf
+ *     ./test_sox_ekf
+ */
+
+/*================== Includes =============================================*/
+/* clock_gettime() */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "sox_stubs.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** @{
+ * parameters of the simulated cells, the filters use the values of sox_cfg.h
+ */
+#define TEST_R0_mOhm            (1.2)
+#define TEST_R1_mOhm            (1.0)
+#define TEST_TAU1_ms            (25000.0)
+#define TEST_NOISE_mV           (4.0)
+/** @} */
+
+/** row of sox_ocv_table used by the simulated cells (25 degC) */
+#define TEST_OCV_ROW            (2u)
+
+/** period of SOC_Calculation() and of SOC_Estimation() in ms */
+#define TEST_PERIOD_CURRENT_ms  (10u)
+#define TEST_PERIOD_EKF_ms      (100u)
+
+/** period of the changes of the current in ms */
+#define TEST_PERIOD_PROFILE_ms  (20000u)
+
+/** duration of the profile and time until the filters have converged in ms */
+#define TEST_DURATION_ms        (2u*3600u*1000u)
+#define TEST_CONVERGED_ms       (15u*60u*1000u)
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_seed = 12345u;
+static uint32_t test_failures = 0;
+
+static double test_soc[BS_NR_OF_BAT_CELLS];         /*!< true SOC of the cells, unit: % */
+static double test_v_rc[BS_NR_OF_BAT_CELLS];        /*!< voltage over the RC element, unit: mV */
+static double test_capacity[BS_NR_OF_BAT_CELLS];    /*!< true capacity of the cells, unit: mAh */
+
+/*================== Function Prototypes ==================================*/
+
+static double TEST_Random(void);
+static double TEST_Ocv(double soc);
+static void TEST_SimulateCells(int32_t current_mA, uint32_t duration_ms);
+static void TEST_MeasureCells(int32_t current_mA, uint32_t time);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    int32_t current_mA = 0;
+    double soc_min = 0.0;
+    double soc_max = 0.0;
+    double error = 0.0;
+    double ekf_square = 0.0;
+    double ekf_max = 0.0;
+    double coulomb_square = 0.0;
+    double coulomb_max = 0.0;
+    uint32_t samples = 0;
+    uint32_t calls = 0;
+    double duration_ns = 0.0;
+    struct timespec start;
+    struct timespec end;
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        test_soc[i] = 60.0 + 5.0*(2.0*TEST_Random() - 1.0);
+        test_capacity[i] = SOX_CELL_CAPACITY*(1.0 + 0.03*(2.0*TEST_Random() - 1.0));
+        test_v_rc[i] = 0.0;
+    }
+    test_nvm_soc.min = 50.0f;
+    test_nvm_soc.max = 50.0f;
+    test_nvm_soc.mean = 50.0f;
+    test_minmax.temperature_mean = 25.0f;
+    test_bms_state = BMS_DISCHARGING;
+    SOC_Init(FALSE);
+
+    for (uint32_t time = TEST_PERIOD_CURRENT_ms; time <= TEST_DURATION_ms; time += TEST_PERIOD_CURRENT_ms) {
+        if ((time % TEST_PERIOD_PROFILE_ms) == TEST_PERIOD_CURRENT_ms) {
+            /* rests and a mean discharge current of about 5 A */
+            current_mA = (TEST_Random() < 0.2) ? 0 : (int32_t)((TEST_Random()*160.0 - 75.0)*1000.0);
+        }
+        TEST_SimulateCells(current_mA, TEST_PERIOD_CURRENT_ms);
+
+        test_current.previous_timestamp_cur = test_current.timestamp_cur;
+        test_current.timestamp_cur = time;
+        test_current.current = current_mA;
+        test_tick = time;
+        SOC_Calculation();
+
+        /* the result of the last estimation step has been written with the SOC of the Coulomb counter */
+        if (((time % TEST_PERIOD_EKF_ms) == TEST_PERIOD_CURRENT_ms) && (time > TEST_CONVERGED_ms)) {
+            soc_min = test_soc[0];
+            soc_max = test_soc[0];
+            for (uint16_t i = 1; i < BS_NR_OF_BAT_CELLS; i++) {
+                soc_min = (test_soc[i] < soc_min) ? test_soc[i] : soc_min;
+                soc_max = (test_soc[i] > soc_max) ? test_soc[i] : soc_max;
+            }
+            error = fabs(test_sox.soc_ekf_min - soc_min);
+            ekf_square += error*error;
+            ekf_max = (error > ekf_max) ? error : ekf_max;
+            error = fabs(test_sox.soc_ekf_max - soc_max);
+            ekf_square += error*error;
+            ekf_max = (error > ekf_max) ? error : ekf_max;
+            error = fabs(test_sox.soc_min - soc_min);
+            coulomb_square += error*error;
+            coulomb_max = (error > coulomb_max) ? error : coulomb_max;
+            error = fabs(test_sox.soc_max - soc_max);
+            coulomb_square += error*error;
+            coulomb_max = (error > coulomb_max) ? error : coulomb_max;
+            samples += 2u;
+        }
+
+        if ((time % TEST_PERIOD_EKF_ms) == 0u) {
+            TEST_MeasureCells(current_mA, time);
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            (void)SOC_Estimation(BS_NR_OF_BAT_CELLS);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            duration_ns += (double)(end.tv_sec - start.tv_sec)*1e9 + (double)(end.tv_nsec - start.tv_nsec);
+            calls++;
+        }
+    }
+
+    printf("test_sox_ekf: %u cells, mode %u, fixed point %u\n",
+            (unsigned int)BS_NR_OF_BAT_CELLS, (unsigned int)SOX_EKF_MODE, (unsigned int)SOX_EKF_FIXED_POINT);
+    printf("test_sox_ekf: error of the minimum and maximum SOC: EKF rms %.2f%% max %.2f%%, Coulomb counter rms %.2f%% max %.2f%%\n",
+            sqrt(ekf_square/samples), ekf_max, sqrt(coulomb_square/samples), coulomb_max);
+    printf("test_sox_ekf: %.0f ns per SOC_Estimation() on the host\n", duration_ns/calls);
+    TEST_Expect(ekf_square < coulomb_square, "EKF more accurate than the Coulomb counter", (uint32_t)(100.0*sqrt(ekf_square/samples)));
+    TEST_Expect(sqrt(ekf_square/samples) < 1.5, "rms EKF error below 1.5%", (uint32_t)(100.0*sqrt(ekf_square/samples)));
+    TEST_Expect(ekf_max < 3.0, "maximum EKF error below 3%", (uint32_t)(100.0*ekf_max));
+
+    if (test_failures == 0u) {
+        printf("test_sox_ekf: OK\n");
+    } else {
+        printf("test_sox_ekf: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   returns a pseudo random number (linear congruential generator, reproducible)
+ *
+ * @return  random number in [0, 1)
+ */
+static double TEST_Random(void) {
+    test_seed = (test_seed * 1103515245u) + 12345u;
+    return (double)(test_seed >> 8)/16777216.0;
+}
+
+/**
+ * @brief   interpolates the open circuit voltage of the simulated cells
+ *
+ * @param   soc     SOC in %
+ *
+ * @return  open circuit voltage in mV
+ */
+static double TEST_Ocv(double soc) {
+    double x = soc/100.0*(SOX_OCV_SOC_POINTS - 1u);
+    int32_t point = (int32_t)x;
+
+    point = (point < 0) ? 0 : point;
+    point = (point > (int32_t)(SOX_OCV_SOC_POINTS - 2u)) ? (int32_t)(SOX_OCV_SOC_POINTS - 2u) : point;
+    return sox_ocv_table.ocv_mV[TEST_OCV_ROW][point] +
+            (x - point)*(sox_ocv_table.ocv_mV[TEST_OCV_ROW][point + 1] - sox_ocv_table.ocv_mV[TEST_OCV_ROW][point]);
+}
+
+/**
+ * @brief   discharges the simulated cells
+ *
+ * @param   current_mA      current, positive in discharge direction
+ * @param   duration_ms     duration of the current
+ */
+static void TEST_SimulateCells(int32_t current_mA, uint32_t duration_ms) {
+    double decay = exp(-(double)duration_ms/TEST_TAU1_ms);
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        test_soc[i] -= current_mA*(double)duration_ms/(test_capacity[i]*3600.0*1000.0)*100.0;
+        test_v_rc[i] = decay*test_v_rc[i] + TEST_R1_mOhm*current_mA/1000.0*(1.0 - decay);
+    }
+}
+
+/**
+ * @brief   writes the noisy terminal voltages of the simulated cells to the cell voltage and minmax data blocks
+ *
+ * @param   current_mA  current, positive in discharge direction
+ * @param   time        time of the measurement in ms
+ */
+static void TEST_MeasureCells(int32_t current_mA, uint32_t time) {
+    double voltage = 0.0;
+    uint16_t voltage_min = UINT16_MAX;
+    uint16_t voltage_max = 0;
+
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        voltage = TEST_Ocv(test_soc[i]) - test_v_rc[i] - TEST_R0_mOhm*current_mA/1000.0 + TEST_NOISE_mV*(TEST_Random() - 0.5);
+        test_cellvoltage.voltage[i] = (uint16_t)(voltage + 0.5);
+        voltage_min = (test_cellvoltage.voltage[i] < voltage_min) ? test_cellvoltage.voltage[i] : voltage_min;
+        voltage_max = (test_cellvoltage.voltage[i] > voltage_max) ? test_cellvoltage.voltage[i] : voltage_max;
+    }
+    test_cellvoltage.timestamp = time;
+    test_minmax.timestamp = time;
+    test_minmax.voltage_min = voltage_min;
+    test_minmax.voltage_max = voltage_max;
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
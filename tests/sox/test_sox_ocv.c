@@ -0,0 +1,254 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_sox_ocv.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test of the SOC lookup in the open circuit voltage table
+ *
+ * Compares SOC_GetFromVoltage() with a reference that interpolates the OCV
+ * table bilinearly and inverts it by bisection, at every mV between 1700 mV
+ * and 2650 mV and every degC between -30 degC and 55 degC. Checks that
+ * SOC_GetFromVoltages() returns the same values and that SOC_Calculation()
+ * recalibrates the SOC only after the cell voltages were stable for
+ * SOX_OCV_STABLE_TIME_ms while the battery system is at rest.
+ *
+ * Build and run from the repository root:
+ *
+ *     S=embedded-software/mcu-primary/src
+ *     gcc -std=c99 -Wall -Wextra -Itests/sox/stubs -I$S/application/sox -I$S/application/config \
+ *         -I$S/general/config -I$S/engine/config -Iembedded-software/mcu-common/src/engine/database \
+ *         tests/sox/test_sox_ocv.c tests/sox/sox_stubs.c $S/application/sox/sox.c \
+ *         $S/application/config/sox_cfg.c -lm -o test_sox_ocv
+ *     ./test_sox_ocv
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <math.h>
+#include "sox_stubs.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** accepted deviation from the reference in % SOC */
+#define TEST_MAX_DEVIATION      (0.001)
+
+/** period of the calls of SOC_Calculation() in ms */
+#define TEST_PERIOD_ms          (100u)
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static double TEST_OcvReference(double soc, double temperature);
+static double TEST_SocReference(double voltage, double temperature);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    uint16_t voltages[BS_NR_OF_BAT_CELLS];
+    float soc[BS_NR_OF_BAT_CELLS];
+    double deviation = 0.0;
+    float previous = 0.0f;
+    float result = 0.0f;
+    uint32_t calibration_start = 1000u;
+
+    /* the SOC points of the table are hit exactly */
+    for (uint8_t row = 0; row < SOX_OCV_TEMPERATURE_POINTS; row++) {
+        for (uint8_t point = 0; point < SOX_OCV_SOC_POINTS; point++) {
+            result = SOC_GetFromVoltage(sox_ocv_table.ocv_mV[row][point], sox_ocv_table.temperature_degC[row]);
+            deviation = fabs(result - (100.0*point/(SOX_OCV_SOC_POINTS - 1u)));
+            TEST_Expect(deviation <= TEST_MAX_DEVIATION, "table point", row*100u + point);
+        }
+    }
+
+    /* between the points, the lookup equals the reference, including the clamping outside of the table */
+    for (int16_t temperature = -30; temperature <= 55; temperature++) {
+        previous = -1.0f;
+        for (uint16_t voltage = 1700u; voltage <= 2650u; voltage++) {
+            result = SOC_GetFromVoltage(voltage, (float)temperature);
+            deviation = fabs(result - TEST_SocReference(voltage, temperature));
+            TEST_Expect(deviation <= TEST_MAX_DEVIATION, "reference", voltage);
+            TEST_Expect(result >= previous, "monotonic", voltage);
+            previous = result;
+        }
+    }
+
+    /* the lookup of all cells equals the lookup of the single cells */
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        voltages[i] = (uint16_t)(1750u + (i*37u) % 850u);
+    }
+    SOC_GetFromVoltages(voltages, soc, BS_NR_OF_BAT_CELLS, 12.5f);
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        TEST_Expect(soc[i] == SOC_GetFromVoltage(voltages[i], 12.5f), "all cells", i);
+    }
+
+    /* a drift larger than SOX_DELTA_MIN_LIMIT restarts the relaxation time */
+    for (uint16_t i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        test_cellvoltage.voltage[i] = 2205;
+    }
+    test_minmax.voltage_min = 2200;
+    test_minmax.voltage_max = 2210;
+    test_minmax.voltage_mean = 2205;
+    test_minmax.temperature_mean = 25.0f;
+    test_nvm_soc.min = 80.0f;
+    test_nvm_soc.max = 80.0f;
+    test_nvm_soc.mean = 80.0f;
+    test_bms_state = BMS_AT_REST;
+    SOC_Init(FALSE);
+    test_nvm_soc_writes = 0;
+    for (test_tick = 1000u; test_tick < (calibration_start + SOX_OCV_STABLE_TIME_ms); test_tick += TEST_PERIOD_ms) {
+        if (test_tick == 20000u) {
+            test_minmax.voltage_min = 2200 - SOX_DELTA_MIN_LIMIT - 1;
+            calibration_start = test_tick;
+        }
+        SOC_Calculation();
+    }
+    TEST_Expect(test_nvm_soc_writes == 0u, "no recalibration after drift", test_tick);
+
+    /* the SOC is recalibrated SOX_OCV_STABLE_TIME_ms after the drift */
+    SOC_Calculation();
+    TEST_Expect(test_nvm_soc_writes > 0u, "recalibration", test_nvm_soc_writes);
+    deviation = fabs(test_nvm_soc.mean - TEST_SocReference(2205, 25));
+    TEST_Expect(deviation <= 0.01, "recalibrated SOC", (uint32_t)(test_nvm_soc.mean*100.0f));
+
+    /* a current flow restarts the relaxation time */
+    test_bms_state = BMS_DISCHARGING;
+    test_nvm_soc_writes = 0;
+    SOC_Calculation();
+    test_bms_state = BMS_AT_REST;
+    test_tick += TEST_PERIOD_ms;
+    SOC_Calculation();
+    TEST_Expect(test_nvm_soc_writes == 0u, "no recalibration after current flow", test_nvm_soc_writes);
+
+    if (test_failures == 0u) {
+        printf("test_sox_ocv: OK\n");
+    } else {
+        printf("test_sox_ocv: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   interpolates the OCV table bilinearly, the temperature is clamped to the table
+ *
+ * @param   soc             SOC in %
+ * @param   temperature     temperature in degC
+ *
+ * @return  open circuit voltage in mV
+ */
+static double TEST_OcvReference(double soc, double temperature) {
+    const SOX_OCV_TABLE_s *table = &sox_ocv_table;
+    uint8_t row = 0;
+    double weight = 0.0;
+
+    if (temperature >= table->temperature_degC[SOX_OCV_TEMPERATURE_POINTS - 1u]) {
+        row = SOX_OCV_TEMPERATURE_POINTS - 2u;
+        weight = 1.0;
+    } else if (temperature > table->temperature_degC[0]) {
+        while (temperature >= table->temperature_degC[row + 1u]) {
+            row++;
+        }
+        weight = (temperature - table->temperature_degC[row])/(table->temperature_degC[row + 1u] - table->temperature_degC[row]);
+    }
+
+    double x = soc/100.0*(SOX_OCV_SOC_POINTS - 1u);
+    uint8_t point = (uint8_t)x;
+    if (point >= (SOX_OCV_SOC_POINTS - 1u)) {
+        point = SOX_OCV_SOC_POINTS - 2u;
+    }
+    double fraction = x - point;
+    double lower = table->ocv_mV[row][point] + fraction*(table->ocv_mV[row][point + 1u] - table->ocv_mV[row][point]);
+    double upper = table->ocv_mV[row + 1u][point] + fraction*(table->ocv_mV[row + 1u][point + 1u] - table->ocv_mV[row + 1u][point]);
+    return lower + weight*(upper - lower);
+}
+
+/**
+ * @brief   inverts TEST_OcvReference() by bisection
+ *
+ * @param   voltage         open circuit voltage in mV
+ * @param   temperature     temperature in degC
+ *
+ * @return  SOC in %, clamped to 0% and 100%
+ */
+static double TEST_SocReference(double voltage, double temperature) {
+    double low = 0.0;
+    double high = 100.0;
+
+    if (voltage <= TEST_OcvReference(0.0, temperature)) {
+        return 0.0;
+    }
+    if (voltage >= TEST_OcvReference(100.0, temperature)) {
+        return 100.0;
+    }
+    for (uint8_t i = 0; i < 60u; i++) {
+        double middle = (low + high)/2.0;
+        if (TEST_OcvReference(middle, temperature) <= voltage) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return (low + high)/2.0;
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
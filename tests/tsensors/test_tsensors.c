@@ -0,0 +1,194 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_tsensors.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup TESTS
+ * @prefix  TEST
+ *
+ * @brief   Host test of the generated temperature sensor models
+ *
+ * For every sensor of tsensors_cfg.yml and every ADC voltage from 0 mV to
+ * 3300 mV, compares TSENSORS_GetTempFromTable(),
+ * TSENSORS_GetTempFromPolynomial() and TSENSORS_GetTempFromPolynomial_cdegC()
+ * with the temperature of the model in tsensors_cfg.yml. In the operating
+ * range of the model, all three have to be within 0.1 degC of it. Outside of
+ * it, they have to report the voltage as out of range, with the sign of the
+ * temperature given by the position of the NTC in the resistor divider.
+ *
+ * The table ends on a multiple of its step. The voltages between the last
+ * step and the upper end of the operating range have to be converted as well,
+ * they are counted separately.
+ *
+ * tests/tsensors/tsensors_models.py generates the models with the generator
+ * of the wscript and the reference temperatures. Build and run from the
+ * repository root:
+ *
+ *     python3 tests/tsensors/tsensors_models.py build/tests/tsensors
+ *     G=build/tests/tsensors/embedded-software/mcu-common/src/module/tsensors
+ *     gcc -std=c99 -Wall -Wextra -Itests/tsensors/stubs -I$G -Iembedded-software/mcu-common/src/module/tsensors \
+ *         tests/tsensors/test_tsensors.c embedded-software/mcu-common/src/module/tsensors/tsensors.c \
+ *         $G/tsensors_models_cfg.c -lm -o test_tsensors
+ *     ./test_tsensors
+ */
+
+/*================== Includes =============================================*/
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include "tsensors.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/** accepted deviation from the model in degC */
+#define TEST_MAX_DEVIATION_degC     (0.1)
+
+/** highest tested ADC voltage */
+#define TEST_VMAX_ADC_mV            (3300u)
+
+/**
+ * operating range and temperatures of a sensor calculated from its model
+ */
+typedef struct {
+    uint16_t vmin_mV;               /*!< lowest ADC voltage of the operating range          */
+    uint16_t vmax_mV;               /*!< highest ADC voltage of the operating range         */
+    uint8_t ntcIsR1;                /*!< TRUE: NTC is R1 of the resistor divider            */
+    const float *temperature_degC;  /*!< temperature at vmin_mV + i in degC                 */
+} TEST_REFERENCE_s;
+
+/* generated by tests/tsensors/tsensors_models.py */
+#include "test_tsensors_reference.h"
+
+/*================== Constant and Variable Definitions ====================*/
+
+static uint32_t test_failures = 0;
+
+/*================== Function Prototypes ==================================*/
+
+static void TEST_Sensor(TSENSORS_ID_e sensor);
+static void TEST_Expect(int condition, const char *name, uint32_t value);
+
+/*================== Function Implementations =============================*/
+
+int main(void) {
+    TEST_Expect(sizeof(test_reference)/sizeof(test_reference[0]) == TSENSORS_MAX, "number of sensors", TSENSORS_MAX);
+    for (uint8_t sensor = 0; sensor < TSENSORS_MAX; sensor++) {
+        TEST_Sensor((TSENSORS_ID_e)sensor);
+    }
+
+    if (test_failures == 0u) {
+        printf("test_tsensors: OK\n");
+    } else {
+        printf("test_tsensors: %u failures\n", (unsigned int)test_failures);
+    }
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/**
+ * @brief   compares the conversions of a sensor with its model at every ADC voltage
+ *
+ * @param   sensor  ID of the sensor
+ */
+static void TEST_Sensor(TSENSORS_ID_e sensor) {
+    const TSENSORS_SENSOR_s *model = &tsensors_sensors[sensor];
+    const TEST_REFERENCE_s *reference = &test_reference[sensor];
+    uint16_t last_step_mV = 0;
+    uint16_t edge = 0;
+    float table = 0.0f;
+    float polynomial = 0.0f;
+    float out_of_range = 0.0f;
+    int16_t polynomial_cdegC = 0;
+    STD_RETURN_TYPE_e retval = E_OK;
+    double expected = 0.0;
+    double table_deviation = 0.0;
+    double polynomial_deviation = 0.0;
+
+    TEST_Expect((model->vmin_mV == reference->vmin_mV) && (model->vmax_mV == reference->vmax_mV), "operating range", sensor);
+    TEST_Expect(model->ntcIsR1 == reference->ntcIsR1, "position in the resistor divider", sensor);
+    last_step_mV = model->vmin_mV + ((model->vmax_mV - model->vmin_mV)/model->tableStep_mV)*model->tableStep_mV;
+
+    for (uint16_t v = 0; v <= TEST_VMAX_ADC_mV; v++) {
+        table = TSENSORS_GetTempFromTable(sensor, v);
+        polynomial = TSENSORS_GetTempFromPolynomial(sensor, v);
+        retval = TSENSORS_GetTempFromPolynomial_cdegC(sensor, v, &polynomial_cdegC);
+
+        if ((v >= reference->vmin_mV) && (v <= reference->vmax_mV)) {
+            expected = reference->temperature_degC[v - reference->vmin_mV];
+            table_deviation = fmax(table_deviation, fabs(table - expected));
+            polynomial_deviation = fmax(polynomial_deviation, fabs(polynomial - expected));
+            TEST_Expect(fabs(table - expected) <= TEST_MAX_DEVIATION_degC, "table", v);
+            TEST_Expect(fabs(polynomial - expected) <= TEST_MAX_DEVIATION_degC, "polynomial", v);
+            TEST_Expect((retval == E_OK) && (fabs(polynomial_cdegC*0.01 - expected) <= TEST_MAX_DEVIATION_degC), "polynomial in 0.01 degC", v);
+            if (v > last_step_mV) {
+                edge++;
+            }
+        } else {
+            /* below vmin_mV, an NTC as R2 is hot, an NTC as R1 is cold */
+            out_of_range = ((v < reference->vmin_mV) == (reference->ntcIsR1 == FALSE)) ? FLT_MAX : -FLT_MAX;
+            TEST_Expect(table == out_of_range, "table out of range", v);
+            TEST_Expect(polynomial == out_of_range, "polynomial out of range", v);
+            TEST_Expect(retval == E_NOT_OK, "polynomial in 0.01 degC out of range", v);
+        }
+    }
+    TEST_Expect(edge == (model->vmax_mV - last_step_mV), "voltages after the last table step", edge);
+
+    printf("test_tsensors: sensor %u, %u mV to %u mV (%u mV after the last %u mV step), max. deviation table %.3f degC, polynomial %.3f degC\n",
+            (unsigned int)sensor, (unsigned int)reference->vmin_mV, (unsigned int)reference->vmax_mV, (unsigned int)edge,
+            (unsigned int)model->tableStep_mV, table_deviation, polynomial_deviation);
+}
+
+/**
+ * @brief   counts and prints a failed check
+ *
+ * @param   condition   result of the check
+ * @param   name        name of the check
+ * @param   value       value printed with a failure
+ */
+static void TEST_Expect(int condition, const char *name, uint32_t value) {
+    if (condition == 0) {
+        test_failures++;
+        if (test_failures <= 10u) {
+            printf("FAILED: %s (%u)\n", name, (unsigned int)value);
+        }
+    }
+}
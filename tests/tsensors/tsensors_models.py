@@ -0,0 +1,189 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+
+"""Generates the inputs of the host test of the temperature sensors
+
+Runs the generator of the sensor models of the wscript (tsensorscfg()) and
+writes tsensors_models_cfg.h/.c into the output directory, as waf does into
+the build directory. Writes test_tsensors_reference.h with the operating range
+of every sensor and its temperature at every mV, calculated from the model in
+tsensors_cfg.yml with the same functions.
+"""
+import os
+import sys
+import ast
+import math
+import argparse
+import datetime
+import yaml
+import jinja2
+
+__version__ = 0.1
+__date__ = '2026-10-17'
+__updated__ = '2026-10-17'
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+CFG_DIR = os.path.join('embedded-software', 'mcu-common', 'src', 'module', 'tsensors')
+
+
+class Node(object):
+    """Minimal waf node, paths relative to a base directory"""
+
+    def __init__(self, path):
+        self.path = path
+        self.name = os.path.basename(path)
+
+    def abspath(self):
+        return self.path
+
+    def relpath(self):
+        return os.path.relpath(self.path, ROOT)
+
+    def make_node(self, path):
+        return Node(os.path.join(self.path, path))
+
+    def find_node(self, path):
+        path = os.path.join(self.path, path)
+        return Node(path) if os.path.exists(path) else None
+
+    def mkdir(self):
+        if not os.path.isdir(self.path):
+            os.makedirs(self.path)
+
+    def write(self, text):
+        with open(self.path, 'w') as f:
+            f.write(text)
+
+
+class SourceNode(Node):
+    """Source directory, its build directory is the output directory"""
+
+    def __init__(self, path, out):
+        super(SourceNode, self).__init__(path)
+        self.out = out
+
+    def get_bld(self):
+        return Node(self.out)
+
+
+class Context(object):
+    """Minimal waf build context for tsensorscfg()"""
+
+    def __init__(self, out):
+        self.path = SourceNode(ROOT, out)
+        self.env = type('Env', (object,), {})()
+        self.env.es_dir = 'embedded-software'
+        self.env.common_dir = 'mcu-common'
+        self.env.jinja2_newline = '\n'
+        templates = os.path.join(ROOT, 'tools', 'styleguide', 'file-templates')
+        with open(os.path.join(templates, 'template.c.jinja2')) as f:
+            self.env.FILE_TEMPLATE_C = f.read()
+        with open(os.path.join(templates, 'template.h.jinja2')) as f:
+            self.env.FILE_TEMPLATE_H = f.read()
+
+    def fatal(self, message):
+        sys.exit(message)
+
+
+class Logs(object):
+    """waf logger, only the summary of the sensors is printed"""
+
+    @staticmethod
+    def info(message):
+        if ' mV to ' in message:
+            print(message)
+
+
+def load_generator():
+    """Returns the functions of the model generator of the wscript, which
+    cannot be imported without waf"""
+    with open(os.path.join(ROOT, 'wscript')) as f:
+        module = ast.parse(f.read())
+    functions = [node for node in module.body if isinstance(node, ast.FunctionDef) and
+                 (node.name == 'tsensorscfg' or node.name.startswith(('_ntc_', '_fit_')))]
+    scope = {'os': os, 'math': math, 'yaml': yaml, 'YAMLLoader': yaml.SafeLoader,
+             'jinja2': jinja2, 'datetime': datetime, 'Logs': Logs}
+    exec(compile(ast.Module(body=functions, type_ignores=[]), 'wscript', 'exec'), scope)
+    return scope
+
+
+def write_reference(generator, out):
+    """Writes the operating range and the temperature at every mV of the sensors"""
+    with open(os.path.join(ROOT, CFG_DIR, 'tsensors_cfg.yml')) as f:
+        sensors = yaml.safe_load(f)['sensors']
+    tables = []
+    ranges = []
+    for sensor in sensors:
+        vmin_mV, vmax_mV = generator['_ntc_voltage_range'](sensor)
+        temperatures = [generator['_ntc_temperature'](sensor, v) for v in range(vmin_mV, vmax_mV + 1)]
+        rows = ''.join('   ' + ''.join(' {:.6f}f,'.format(t) for t in temperatures[i:i + 8]) + '\n'
+                       for i in range(0, len(temperatures), 8))
+        tables.append('static const float test_reference_{}_degC[{}] = {{\n{}}};\n'.format(
+            sensor['prefix'].lower(), len(temperatures), rows))
+        ranges.append('    {{{}u, {}u, {}, &test_reference_{}_degC[0]}},\n'.format(
+            vmin_mV, vmax_mV, 'TRUE' if sensor['position_in_resistor_divider_is_r1'] else 'FALSE',
+            sensor['prefix'].lower()))
+    with open(os.path.join(out, 'test_tsensors_reference.h'), 'w') as f:
+        f.write('/* generated by tests/tsensors/tsensors_models.py, do not edit */\n\n'
+                '#ifndef TEST_TSENSORS_REFERENCE_H_\n#define TEST_TSENSORS_REFERENCE_H_\n\n'
+                '/* temperature in degC of every mV of the operating range, from the model in tsensors_cfg.yml */\n' +
+                '\n'.join(tables) +
+                '\n/* operating range of the sensors, indexed by TSENSORS_ID_e */\n'
+                'static const TEST_REFERENCE_s test_reference[{}] = {{\n{}}};\n\n'
+                '#endif /* TEST_TSENSORS_REFERENCE_H_ */\n'.format(len(sensors), ''.join(ranges)))
+
+
+def main():
+    """Generates the sensor models and the reference into the output directory"""
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('out', help='output directory')
+    args = parser.parse_args()
+
+    out = os.path.abspath(args.out)
+    generator = load_generator()
+    generator['tsensorscfg'](Context(out))
+    # tsensorscfg() writes into the source path below the build directory
+    generated = os.path.join(out, CFG_DIR)
+    write_reference(generator, generated)
+    print('Generated {}'.format(generated))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+
+"""Decodes the database history printed by the foxBMS 'dumphistory' command.
+
+The UART log of the dump is read and every recorded data block is written as
+one line: history index, block ID, timestamp (ms) and the data block in hex.
+With '--block ID=FORMAT' the data block is unpacked with the given Python
+struct format instead (e.g. '--block 5=<IIfff' for a block of two timestamps
+and three floats).
+
+The record format is described in
+embedded-software/mcu-common/src/engine/database/database_history.c
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_KEY = 0x4B
+RECORD_DELTA = 0x44
+TAG_UNCHANGED = 0
+TAG_DELTA8 = 1
+TAG_LITERAL = 2
+
+
+def parse_log(lines):
+    """Returns the trigger and the raw records of every history ring"""
+    trigger = None
+    rings = []
+    for line in lines:
+        line = line.strip()
+        match = re.match(r'HISTORY TRIGGER (\d+) AT (\d+)', line)
+        if match:
+            trigger = (int(match.group(1)), int(match.group(2)))
+            continue
+        match = re.match(r'HISTORY (\d+) BLOCK (\d+) LENGTH (\d+) BYTES (\d+) RECORDS (\d+)', line)
+        if match:
+            rings.append({'index': int(match.group(1)), 'block': int(match.group(2)),
+                          'datalength': int(match.group(3)), 'data': bytearray()})
+            continue
+        match = re.match(r'([0-9A-F]{8}):([0-9A-F]*)$', line)
+        if match and rings:
+            if int(match.group(1), 16) != len(rings[-1]['data']):
+                sys.exit(f'history {rings[-1]["index"]}: gap in dump at offset {match.group(1)}')
+            rings[-1]['data'] += bytes.fromhex(match.group(2))
+    return trigger, rings
+
+
+def decode_ring(ring):
+    """Yields the recorded data blocks of a history ring, oldest first"""
+    data = ring['data']
+    datalength = ring['datalength']
+    previous = None
+    position = 0
+    while position + 3 <= len(data):
+        record_type = data[position]
+        payload = data[position + 1] | (data[position + 2] << 8)
+        record = data[position + 3:position + 3 + payload]
+        position += 3 + payload
+        if record_type == RECORD_KEY:
+            previous = bytearray(record)
+        elif record_type == RECORD_DELTA:
+            if previous is None:
+                # reference record already overwritten
+                continue
+            halfwords = datalength // 2
+            tags = record[:(halfwords + 3) // 4]
+            values = record[(halfwords + 3) // 4:]
+            current = bytearray(previous)
+            value = 0
+            for i in range(halfwords):
+                tag = (tags[i // 4] >> (2 * (i % 4))) & 0x3
+                old = previous[2 * i] | (previous[2 * i + 1] << 8)
+                if tag == TAG_UNCHANGED:
+                    new = old
+                elif tag == TAG_DELTA8:
+                    new = (old + struct.unpack('<b', values[value:value + 1])[0]) & 0xFFFF
+                    value += 1
+                elif tag == TAG_LITERAL:
+                    new = values[value] | (values[value + 1] << 8)
+                    value += 2
+                else:
+                    sys.exit(f'history {ring["index"]}: invalid tag {tag}')
+                current[2 * i] = new & 0xFF
+                current[2 * i + 1] = new >> 8
+            previous = current
+        else:
+            sys.exit(f'history {ring["index"]}: invalid record type 0x{record_type:02X}')
+        yield bytes(previous)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('log', type=argparse.FileType('r'), help='UART log of the dumphistory command')
+    parser.add_argument('--block', action='append', default=[], metavar='ID=FORMAT',
+                        help='struct format of a data block')
+    args = parser.parse_args()
+
+    formats = dict((int(b.split('=', 1)[0]), b.split('=', 1)[1]) for b in args.block)
+    trigger, rings = parse_log(args.log)
+    if trigger:
+        print(f'# trigger {trigger[0]} at {trigger[1]} ms')
+    for ring in rings:
+        for block in decode_ring(ring):
+            timestamp = struct.unpack_from('<I', block)[0]
+            if ring['block'] in formats:
+                values = ';'.join(str(x) for x in struct.unpack_from(formats[ring['block']], block))
+            else:
+                values = block.hex()
+            print(f'{ring["index"]};{ring["block"]};{timestamp};{values}')
+
+
+if __name__ == '__main__':
+    main()